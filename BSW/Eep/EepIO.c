@@ -59,7 +59,62 @@
 # define EEP_BUFFER_SIZE 0x100u
 #endif
 
+#if !defined( EEP_BASE_ADDRESS )
 # define EEP_BASE_ADDRESS    ((vuint32)eepData)
+#endif
+
+#if defined( EEP_ENABLE_JOURNAL )
+/*
+   The EEPROM content is kept in a RAM image (eepData), which is rebuilt from a journal on initialization. Writes are
+   appended to the journal instead of overwriting the EEPROM cells. Layout of a journal page:
+   - Page header: sequence number and its complement, big-endian. Written last when a page is set up.
+   - Records, appended in ascending order:
+     - Data record: length, offset in image (big-endian), CRC-8, data padded to write granularity
+     - Commit record: marker, number of preceding uncommitted data records, complement of number, CRC-8
+   Data records only become valid with the commit record following them. If the active page is full, the RAM image is
+   written to the next page (compaction).
+*/
+# define EEP_JOURNAL_HEADER_SIZE          8u
+# define EEP_JOURNAL_COMMIT_MARKER        0x00u
+# define EEP_JOURNAL_CRC_INIT             0xFFu
+# define EEP_JOURNAL_CRC_POLYNOMIAL       0x1Du    /* SAE J1850 */
+# define EEP_JOURNAL_READ_CHUNK_SIZE      0x10u
+
+/* PRQA S 3453 4 */ /* MD_MSR_19.7 */
+# define EepJournalAlign(length)          ((((length) + (EEP_JOURNAL_WRITE_SIZE - 1u)) / EEP_JOURNAL_WRITE_SIZE) * EEP_JOURNAL_WRITE_SIZE)
+# define EepJournalRecordSize(length)     (EEP_JOURNAL_RECORD_HEADER_SIZE + EepJournalAlign(length))
+# define EepJournalPosition(position)     (((IO_PositionType)eepJournalPage * EEP_JOURNAL_PAGE_SIZE) + (position))
+
+# define EEP_JOURNAL_RECORD_HEADER_SIZE   EepJournalAlign(4u)
+# define EEP_JOURNAL_COMMIT_SIZE          EepJournalAlign(4u)
+/** Maximum number of data records needed to store the complete image */
+# define EEP_JOURNAL_MAX_RECORDS          ((EEP_BUFFER_SIZE + (EEP_JOURNAL_MAX_RECORD_LENGTH - 1u)) / EEP_JOURNAL_MAX_RECORD_LENGTH)
+
+# if ( EEP_BUFFER_SIZE > 0x10000u )
+#  error "EEP_BUFFER_SIZE exceeds the offset range of journal records."
+# endif
+# if ( EEP_JOURNAL_MAX_RECORD_LENGTH > 0xFEu ) || ( EEP_JOURNAL_MAX_RECORD_LENGTH == 0u )
+#  error "EEP_JOURNAL_MAX_RECORD_LENGTH has to be in the range 1..0xFE."
+# endif
+# if ( EEP_JOURNAL_WRITE_SIZE < 4u ) || ( EEP_JOURNAL_WRITE_SIZE > EEP_JOURNAL_HEADER_SIZE ) || \
+     ((EEP_JOURNAL_WRITE_SIZE & (EEP_JOURNAL_WRITE_SIZE - 1u)) != 0u)
+#  error "EEP_JOURNAL_WRITE_SIZE has to be 4 or 8."
+# endif
+# if ( EEP_JOURNAL_PAGE_COUNT < 2u ) || ( EEP_JOURNAL_PAGE_COUNT > 0xFFu )
+#  error "EEP_JOURNAL_PAGE_COUNT has to be in the range 2..0xFF."
+# endif
+# if ( EEP_JOURNAL_MAX_RECORDS > 0xFFu ) || \
+     ((EEP_JOURNAL_HEADER_SIZE + (EEP_JOURNAL_MAX_RECORDS * EepJournalRecordSize(EEP_JOURNAL_MAX_RECORD_LENGTH)) \
+       + EEP_JOURNAL_COMMIT_SIZE) > EEP_JOURNAL_PAGE_SIZE)
+#  error "EEP_JOURNAL_PAGE_SIZE too small to hold the complete EEPROM image."
+# endif
+#endif /* EEP_ENABLE_JOURNAL */
+
+#if defined( EEP_ENABLE_TRANSACTION ) && \
+    !defined( EEP_ENABLE_JOURNAL )
+/* Only the journal writes the staged range with a single commit record */
+# error "EEP_ENABLE_TRANSACTION requires EEP_ENABLE_JOURNAL."
+#endif
 
 /***********************************************************************************************************************
  *  GLOBAL DATA
@@ -68,6 +123,27 @@
 #define EEPDUMMY_START_SEC_VAR
 #include "MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_19.1 */
 V_MEMRAM0 static V_MEMRAM1 IO_U8 V_MEMRAM2 eepData[EEP_BUFFER_SIZE];
+#if defined( EEP_ENABLE_JOURNAL )
+# if !defined( EEP_JOURNAL_ENABLE_USER_DEVICE )
+/** Emulated journal device */
+V_MEMRAM0 static V_MEMRAM1 IO_U8 V_MEMRAM2 eepJournalData[EEP_JOURNAL_PAGE_COUNT * EEP_JOURNAL_PAGE_SIZE];
+# endif /* EEP_JOURNAL_ENABLE_USER_DEVICE */
+/** Page holding the valid journal */
+V_MEMRAM0 static V_MEMRAM1 IO_U8 V_MEMRAM2 eepJournalPage;
+/** Sequence number of the valid journal page */
+V_MEMRAM0 static V_MEMRAM1 IO_U32 V_MEMRAM2 eepJournalSequence;
+/** Position of next record in journal page. Page size if page has to be compacted before next write */
+V_MEMRAM0 static V_MEMRAM1 IO_PositionType V_MEMRAM2 eepJournalAppendPos;
+#endif /* EEP_ENABLE_JOURNAL */
+#if defined( EEP_ENABLE_TRANSACTION )
+/** EEPROM content including the modifications staged by the active transaction */
+V_MEMRAM0 static V_MEMRAM1 IO_U8 V_MEMRAM2 eepTransactionData[EEP_BUFFER_SIZE];
+/** Range of staged modifications, empty if begin is not below end */
+V_MEMRAM0 static V_MEMRAM1 IO_PositionType V_MEMRAM2 eepTransactionBegin;
+V_MEMRAM0 static V_MEMRAM1 IO_PositionType V_MEMRAM2 eepTransactionEnd;
+/** Transaction active flag */
+V_MEMRAM0 static V_MEMRAM1 IO_U8 V_MEMRAM2 eepTransactionActive;
+#endif /* EEP_ENABLE_TRANSACTION */
 #define EEPDUMMY_STOP_SEC_VAR
 #include "MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_19.1 */
 
@@ -79,6 +155,24 @@ V_MEMRAM0 static V_MEMRAM1 IO_U8 V_MEMRAM2 eepData[EEP_BUFFER_SIZE];
 #include "MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_19.1 */
 
 static IO_ErrorType EepromDriver_CheckRangeContained( IO_SizeType length, IO_PositionType address );
+static IO_ErrorType EepromDriver_WriteData( IO_MemPtrType writeBuffer, IO_SizeType writeLength, IO_PositionType writeAddress );
+#if defined( EEP_ENABLE_JOURNAL )
+# if !defined( EEP_JOURNAL_ENABLE_USER_DEVICE )
+static IO_ErrorType EepJournalDeviceRead( IO_MemPtrType readBuffer, IO_SizeType readLength, IO_PositionType readPosition );
+static IO_ErrorType EepJournalDeviceWrite( IO_MemPtrType writeBuffer, IO_SizeType writeLength, IO_PositionType writePosition );
+static IO_ErrorType EepJournalDeviceErase( IO_SizeType eraseLength, IO_PositionType erasePosition );
+static IO_ErrorType EepJournalDeviceBlankCheck( IO_SizeType checkLength, IO_PositionType checkPosition );
+# endif /* EEP_JOURNAL_ENABLE_USER_DEVICE */
+static IO_U8 EepJournalCrc( IO_U8 crcInit, const V_MEMRAM1 IO_U8 V_MEMRAM2 V_MEMRAM3 * data, IO_SizeType length );
+static IO_ErrorType EepJournalWriteRecord( IO_PositionType position, IO_PositionType offset, IO_MemPtrType data, IO_SizeType length );
+static IO_ErrorType EepJournalWriteCommit( IO_PositionType position, IO_U8 recordCount );
+static IO_ErrorType EepJournalAppend( IO_PositionType offset, IO_MemPtrType data, IO_SizeType length );
+static IO_ErrorType EepJournalCompact( IO_PositionType offset, IO_MemPtrType data, IO_SizeType length );
+static IO_ErrorType EepJournalApply( IO_PositionType position, IO_U8 recordCount );
+static void EepJournalReplay( void );
+static IO_ErrorType EepJournalInit( void );
+static IO_ErrorType EepJournalWrite( IO_MemPtrType writeBuffer, IO_SizeType writeLength, IO_PositionType offset );
+#endif /* EEP_ENABLE_JOURNAL */
 
 /***********************************************************************************************************************
  *  LOCAL FUNCTIONS
@@ -111,6 +205,625 @@ static IO_ErrorType EepromDriver_CheckRangeContained( IO_SizeType length, IO_Pos
    return result;
 }
 
+#if defined( EEP_ENABLE_JOURNAL )
+# if !defined( EEP_JOURNAL_ENABLE_USER_DEVICE )
+/***********************************************************************************************************************
+ *  EepJournalDeviceRead
+ **********************************************************************************************************************/
+/*! \brief       Read from emulated journal device
+ *  \param[out]  readBuffer Read data buffer
+ *  \param[in]   readLength Number of bytes to be read
+ *  \param[in]   readPosition Position in journal area
+ *  \return      Status of read operation
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalDeviceRead( IO_MemPtrType readBuffer, IO_SizeType readLength, IO_PositionType readPosition )
+{
+   (void)MEMCPY(readBuffer, &eepJournalData[readPosition], readLength);
+
+   return IO_E_OK;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalDeviceWrite
+ **********************************************************************************************************************/
+/*! \brief       Program emulated journal device
+ *  \details     Like flash memory, programming can only clear bits of the erased state.
+ *  \param[in]   writeBuffer Write data buffer
+ *  \param[in]   writeLength Number of bytes to be written
+ *  \param[in]   writePosition Position in journal area
+ *  \return      Status of write operation
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalDeviceWrite( IO_MemPtrType writeBuffer, IO_SizeType writeLength, IO_PositionType writePosition )
+{
+   IO_SizeType i;
+
+   for (i = 0u; i < writeLength; i++)
+   {
+      eepJournalData[writePosition + i] &= writeBuffer[i];
+   }
+
+   return IO_E_OK;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalDeviceErase
+ **********************************************************************************************************************/
+/*! \brief       Erase emulated journal device
+ *  \param[in]   eraseLength Number of bytes to be erased
+ *  \param[in]   erasePosition Position in journal area
+ *  \return      Status of erase operation
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalDeviceErase( IO_SizeType eraseLength, IO_PositionType erasePosition )
+{
+   IO_SizeType i;
+
+   for (i = 0u; i < eraseLength; i++)
+   {
+      eepJournalData[erasePosition + i] = 0xFFu;
+   }
+
+   return IO_E_OK;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalDeviceBlankCheck
+ **********************************************************************************************************************/
+/*! \brief       Check whether area of emulated journal device is erased
+ *  \param[in]   checkLength Number of bytes to be checked
+ *  \param[in]   checkPosition Position in journal area
+ *  \return      IO_E_OK if area is erased, IO_E_NOT_OK otherwise
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalDeviceBlankCheck( IO_SizeType checkLength, IO_PositionType checkPosition )
+{
+   IO_ErrorType result;
+   IO_SizeType i;
+
+   result = IO_E_OK;
+
+   for (i = 0u; i < checkLength; i++)
+   {
+      if (0xFFu != eepJournalData[checkPosition + i])
+      {
+         result = IO_E_NOT_OK;
+      }
+   }
+
+   return result;
+}
+# endif /* EEP_JOURNAL_ENABLE_USER_DEVICE */
+
+/***********************************************************************************************************************
+ *  EepJournalCrc
+ **********************************************************************************************************************/
+/*! \brief       Calculate CRC-8 (SAE J1850 polynomial) of journal record
+ *  \param[in]   crcInit Start value, result of previous calculation
+ *  \param[in]   data Data to be included
+ *  \param[in]   length Number of bytes
+ *  \return      Updated CRC value
+ **********************************************************************************************************************/
+static IO_U8 EepJournalCrc( IO_U8 crcInit, const V_MEMRAM1 IO_U8 V_MEMRAM2 V_MEMRAM3 * data, IO_SizeType length )
+{
+   IO_U8 crc;
+   IO_SizeType i;
+   vuintx bitCount;
+
+   crc = crcInit;
+
+   for (i = 0u; i < length; i++)
+   {
+      crc ^= data[i];
+
+      for (bitCount = 0u; bitCount < 8u; bitCount++)
+      {
+         if ((crc & 0x80u) != 0u)
+         {
+            crc = (IO_U8)((IO_U8)(crc << 1u) ^ EEP_JOURNAL_CRC_POLYNOMIAL);
+         }
+         else
+         {
+            crc = (IO_U8)(crc << 1u);
+         }
+      }
+   }
+
+   return crc;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalWriteRecord
+ **********************************************************************************************************************/
+/*! \brief       Write data record to journal page
+ *  \details     The record header is written first, so an interrupted write is detected by the CRC.
+ *  \param[in]   position Position of record in journal area
+ *  \param[in]   offset Offset of data in RAM image
+ *  \param[in]   data Record data
+ *  \param[in]   length Length of data (at most EEP_JOURNAL_MAX_RECORD_LENGTH)
+ *  \return      Status of write operation
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalWriteRecord( IO_PositionType position, IO_PositionType offset, IO_MemPtrType data, IO_SizeType length )
+{
+   IO_U8 unit[EEP_JOURNAL_WRITE_SIZE];
+   IO_SizeType fullLength;
+   IO_SizeType i;
+   IO_ErrorType result;
+
+   for (i = 0u; i < EEP_JOURNAL_WRITE_SIZE; i++)
+   {
+      unit[i] = 0xFFu;
+   }
+
+   unit[0] = (IO_U8)length;
+   unit[1] = (IO_U8)(offset >> 8u);
+   unit[2] = (IO_U8)offset;
+   unit[3] = EepJournalCrc(EepJournalCrc(EEP_JOURNAL_CRC_INIT, unit, 3u), data, length);
+
+   result = EepJournalDeviceWrite(unit, EEP_JOURNAL_RECORD_HEADER_SIZE, position);
+   position += EEP_JOURNAL_RECORD_HEADER_SIZE;
+
+   /* Data covering complete write units */
+   fullLength = (length / EEP_JOURNAL_WRITE_SIZE) * EEP_JOURNAL_WRITE_SIZE;
+   if ((IO_E_OK == result) && (fullLength > 0u))
+   {
+      result = EepJournalDeviceWrite(data, fullLength, position);
+   }
+
+   /* Remaining data, padded to write unit */
+   if ((IO_E_OK == result) && (fullLength < length))
+   {
+      for (i = 0u; i < EEP_JOURNAL_WRITE_SIZE; i++)
+      {
+         unit[i] = ((fullLength + i) < length) ? data[fullLength + i] : 0xFFu;
+      }
+
+      result = EepJournalDeviceWrite(unit, EEP_JOURNAL_WRITE_SIZE, position + fullLength);
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalWriteCommit
+ **********************************************************************************************************************/
+/*! \brief       Write commit record to journal page
+ *  \param[in]   position Position of record in journal area
+ *  \param[in]   recordCount Number of data records committed
+ *  \return      Status of write operation
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalWriteCommit( IO_PositionType position, IO_U8 recordCount )
+{
+   IO_U8 unit[EEP_JOURNAL_COMMIT_SIZE];
+   IO_SizeType i;
+
+   for (i = 0u; i < EEP_JOURNAL_COMMIT_SIZE; i++)
+   {
+      unit[i] = 0xFFu;
+   }
+
+   unit[0] = EEP_JOURNAL_COMMIT_MARKER;
+   unit[1] = recordCount;
+   unit[2] = (IO_U8)(~recordCount);
+   unit[3] = EepJournalCrc(EEP_JOURNAL_CRC_INIT, unit, 3u);
+
+   return EepJournalDeviceWrite(unit, EEP_JOURNAL_COMMIT_SIZE, position);
+}
+
+/***********************************************************************************************************************
+ *  EepJournalAppend
+ **********************************************************************************************************************/
+/*! \brief       Append data records and commit record to the active journal page
+ *  \pre         Remaining space of the page is sufficient
+ *  \param[in]   offset Offset of data in RAM image
+ *  \param[in]   data Data to be written
+ *  \param[in]   length Length of data
+ *  \return      Status of write operation
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalAppend( IO_PositionType offset, IO_MemPtrType data, IO_SizeType length )
+{
+   IO_PositionType position;
+   IO_SizeType recordLength;
+   IO_U8 recordCount;
+   IO_ErrorType result;
+
+   position    = eepJournalAppendPos;
+   recordCount = 0u;
+   result      = IO_E_OK;
+
+   while ((IO_E_OK == result) && (length > 0u))
+   {
+      recordLength = (length > EEP_JOURNAL_MAX_RECORD_LENGTH) ? EEP_JOURNAL_MAX_RECORD_LENGTH : length;
+
+      result = EepJournalWriteRecord(EepJournalPosition(position), offset, data, recordLength);
+
+      position += EepJournalRecordSize(recordLength);
+      offset   += recordLength;
+      data      = &data[recordLength];
+      length   -= recordLength;
+      recordCount++;
+   }
+
+   if (IO_E_OK == result)
+   {
+      result = EepJournalWriteCommit(EepJournalPosition(position), recordCount);
+      position += EEP_JOURNAL_COMMIT_SIZE;
+   }
+
+   /* Page content after failed write is undefined: compact before next write */
+   eepJournalAppendPos = (IO_E_OK == result) ? position : EEP_JOURNAL_PAGE_SIZE;
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalCompact
+ **********************************************************************************************************************/
+/*! \brief       Write RAM image to the next journal page
+ *  \details     The new page becomes valid with its page header, which is written last. Until then the current page
+ *               stays valid. Pages are used round robin to distribute erase cycles.
+ *  \param[in]   offset Offset of data which replaces RAM image content
+ *  \param[in]   data Data which replaces RAM image content
+ *  \param[in]   length Length of data, 0 if RAM image is written unchanged
+ *  \return      Status of compaction
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalCompact( IO_PositionType offset, IO_MemPtrType data, IO_SizeType length )
+{
+   IO_U8 chunk[EEP_JOURNAL_MAX_RECORD_LENGTH];
+   IO_U8 pageHeader[EEP_JOURNAL_HEADER_SIZE];
+   IO_U8 previousPage;
+   IO_U32 sequence;
+   IO_PositionType position;
+   IO_PositionType chunkOffset;
+   IO_SizeType chunkLength;
+   IO_SizeType i;
+   IO_U8 recordCount;
+   IO_U8 isBlank;
+   IO_ErrorType result;
+
+   previousPage   = eepJournalPage;
+   eepJournalPage = (IO_U8)((eepJournalPage + 1u) % EEP_JOURNAL_PAGE_COUNT);
+   sequence       = eepJournalSequence + 1u;
+
+   result = EepJournalDeviceErase(EEP_JOURNAL_PAGE_SIZE, EepJournalPosition(0u));
+
+   position    = EEP_JOURNAL_HEADER_SIZE;
+   recordCount = 0u;
+
+   for (chunkOffset = 0u; (IO_E_OK == result) && (chunkOffset < EEP_BUFFER_SIZE); chunkOffset += chunkLength)
+   {
+      chunkLength = ((EEP_BUFFER_SIZE - chunkOffset) > EEP_JOURNAL_MAX_RECORD_LENGTH) ?
+                    EEP_JOURNAL_MAX_RECORD_LENGTH : (EEP_BUFFER_SIZE - chunkOffset);
+      isBlank     = 1u;
+
+      for (i = 0u; i < chunkLength; i++)
+      {
+         if (((chunkOffset + i) >= offset) && ((chunkOffset + i) < (offset + length)))
+         {
+            chunk[i] = data[(chunkOffset + i) - offset];
+         }
+         else
+         {
+            chunk[i] = eepData[chunkOffset + i];
+         }
+
+         if (0xFFu != chunk[i])
+         {
+            isBlank = 0u;
+         }
+      }
+
+      /* Erased value is the default content of the image */
+      if (0u == isBlank)
+      {
+         result = EepJournalWriteRecord(EepJournalPosition(position), chunkOffset, chunk, chunkLength);
+         position += EepJournalRecordSize(chunkLength);
+         recordCount++;
+      }
+   }
+
+   if (IO_E_OK == result)
+   {
+      result = EepJournalWriteCommit(EepJournalPosition(position), recordCount);
+      position += EEP_JOURNAL_COMMIT_SIZE;
+   }
+
+   if (IO_E_OK == result)
+   {
+      /* Activate page */
+      for (i = 0u; i < 4u; i++)
+      {
+         pageHeader[i]      = (IO_U8)(sequence >> (24u - (8u * i)));
+         pageHeader[i + 4u] = (IO_U8)(~pageHeader[i]);
+      }
+
+      result = EepJournalDeviceWrite(pageHeader, EEP_JOURNAL_HEADER_SIZE, EepJournalPosition(0u));
+   }
+
+   if (IO_E_OK == result)
+   {
+      eepJournalSequence  = sequence;
+      eepJournalAppendPos = position;
+   }
+   else
+   {
+      /* Previous page stays valid */
+      eepJournalPage = previousPage;
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalApply
+ **********************************************************************************************************************/
+/*! \brief       Copy committed data records into RAM image
+ *  \pre         Records have been checked by EepJournalReplay
+ *  \param[in]   position Position of first record in journal page
+ *  \param[in]   recordCount Number of records
+ *  \return      Status of read operation
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalApply( IO_PositionType position, IO_U8 recordCount )
+{
+   IO_U8 recordHeader[4u];
+   IO_ErrorType result;
+
+   result = IO_E_OK;
+
+   while ((IO_E_OK == result) && (recordCount > 0u))
+   {
+      result = EepJournalDeviceRead(recordHeader, 4u, EepJournalPosition(position));
+
+      if (IO_E_OK == result)
+      {
+         result = EepJournalDeviceRead(&eepData[((IO_PositionType)recordHeader[1] << 8u) | recordHeader[2]],
+                                       recordHeader[0], EepJournalPosition(position + EEP_JOURNAL_RECORD_HEADER_SIZE));
+         position += EepJournalRecordSize(recordHeader[0]);
+         recordCount--;
+      }
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalReplay
+ **********************************************************************************************************************/
+/*! \brief       Rebuild RAM image from the active journal page
+ *  \details     Records are evaluated up to the first erased record position. Uncommitted data records and records
+ *               with an invalid CRC (e.g. interrupted write) end the evaluation and cause a compaction on the next
+ *               write.
+ **********************************************************************************************************************/
+static void EepJournalReplay( void )
+{
+   IO_U8 recordHeader[4u];
+   IO_U8 buffer[EEP_JOURNAL_READ_CHUNK_SIZE];
+   IO_PositionType position;
+   IO_PositionType pendingPosition;
+   IO_PositionType offset;
+   IO_SizeType length;
+   IO_SizeType readLength;
+   IO_SizeType i;
+   IO_U8 pendingCount;
+   IO_U8 crc;
+   IO_ErrorType result;
+
+   position        = EEP_JOURNAL_HEADER_SIZE;
+   pendingPosition = position;
+   pendingCount    = 0u;
+   result          = IO_E_OK;
+
+   while ((IO_E_OK == result) && ((position + EEP_JOURNAL_RECORD_HEADER_SIZE) <= EEP_JOURNAL_PAGE_SIZE))
+   {
+      if (IO_E_OK == EepJournalDeviceBlankCheck(EEP_JOURNAL_RECORD_HEADER_SIZE, EepJournalPosition(position)))
+      {
+         /* End of journal */
+         break;
+      }
+
+      result = EepJournalDeviceRead(recordHeader, 4u, EepJournalPosition(position));
+
+      if (IO_E_OK == result)
+      {
+         crc = EepJournalCrc(EEP_JOURNAL_CRC_INIT, recordHeader, 3u);
+
+         if (EEP_JOURNAL_COMMIT_MARKER == recordHeader[0])
+         {
+            if (   (crc == recordHeader[3])
+                && (pendingCount == recordHeader[1])
+                && ((IO_U8)(~recordHeader[1]) == recordHeader[2]))
+            {
+               result = EepJournalApply(pendingPosition, pendingCount);
+
+               position       += EEP_JOURNAL_COMMIT_SIZE;
+               pendingPosition = position;
+               pendingCount    = 0u;
+            }
+            else
+            {
+               result = IO_E_NOT_OK;
+            }
+         }
+         else
+         {
+            length = recordHeader[0];
+            offset = ((IO_PositionType)recordHeader[1] << 8u) | recordHeader[2];
+
+            if (   (length > EEP_JOURNAL_MAX_RECORD_LENGTH)
+                || (offset > (EEP_BUFFER_SIZE - length))
+                || ((position + EepJournalRecordSize(length)) > EEP_JOURNAL_PAGE_SIZE)
+                || (pendingCount == 0xFFu))
+            {
+               result = IO_E_NOT_OK;
+            }
+
+            for (i = 0u; (IO_E_OK == result) && (i < length); i += readLength)
+            {
+               readLength = ((length - i) > EEP_JOURNAL_READ_CHUNK_SIZE) ? EEP_JOURNAL_READ_CHUNK_SIZE : (length - i);
+               result     = EepJournalDeviceRead(buffer, readLength,
+                                                 EepJournalPosition(position + EEP_JOURNAL_RECORD_HEADER_SIZE + i));
+               crc        = EepJournalCrc(crc, buffer, readLength);
+            }
+
+            if ((IO_E_OK == result) && (crc != recordHeader[3]))
+            {
+               result = IO_E_NOT_OK;
+            }
+
+            position += EepJournalRecordSize(length);
+            pendingCount++;
+         }
+      }
+   }
+
+   eepJournalAppendPos = ((IO_E_OK == result) && (0u == pendingCount)) ? position : EEP_JOURNAL_PAGE_SIZE;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalInit
+ **********************************************************************************************************************/
+/*! \brief       Locate valid journal page and rebuild RAM image
+ *  \details     The page with valid header and highest sequence number is used. If no valid page is found, the
+ *               journal is set up with an erased image.
+ *  \return      Status of initialization
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalInit( void )
+{
+   IO_U8 pageHeader[EEP_JOURNAL_HEADER_SIZE];
+   IO_U32 sequence;
+   IO_U32 sequenceInverse;
+   IO_U8 page;
+   IO_U8 pageFound;
+   IO_SizeType i;
+   IO_ErrorType result;
+
+   for (i = 0u; i < EEP_BUFFER_SIZE; i++)
+   {
+      eepData[i] = 0xFFu;
+   }
+
+   pageFound = 0u;
+
+   for (page = 0u; page < EEP_JOURNAL_PAGE_COUNT; page++)
+   {
+      eepJournalPage = page;
+
+      if (   (IO_E_OK != EepJournalDeviceBlankCheck(EEP_JOURNAL_HEADER_SIZE, EepJournalPosition(0u)))
+          && (IO_E_OK == EepJournalDeviceRead(pageHeader, EEP_JOURNAL_HEADER_SIZE, EepJournalPosition(0u))))
+      {
+         sequence        = 0u;
+         sequenceInverse = 0u;
+         for (i = 0u; i < 4u; i++)
+         {
+            sequence        = (sequence << 8u) | pageHeader[i];
+            sequenceInverse = (sequenceInverse << 8u) | pageHeader[i + 4u];
+         }
+
+         if (((sequence ^ sequenceInverse) == 0xFFFFFFFFul) && ((0u == pageFound) || (sequence > eepJournalSequence)))
+         {
+            pageFound          = page + 1u;
+            eepJournalSequence = sequence;
+         }
+      }
+   }
+
+   if (0u != pageFound)
+   {
+      eepJournalPage = pageFound - 1u;
+      EepJournalReplay();
+      result = IO_E_OK;
+   }
+   else
+   {
+      /* No journal present: first compaction uses page 0 */
+      eepJournalPage      = EEP_JOURNAL_PAGE_COUNT - 1u;
+      eepJournalSequence  = 0u;
+      eepJournalAppendPos = EEP_JOURNAL_PAGE_SIZE;
+      result = EepJournalCompact(0u, V_NULL, 0u);
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalWrite
+ **********************************************************************************************************************/
+/*! \brief       Write data to journal and RAM image
+ *  \details     Unchanged data is not written. If the remaining space of the active page is not sufficient or the
+ *               write fails, the data is stored by a compaction.
+ *  \param[in]   writeBuffer Write data buffer
+ *  \param[in]   writeLength Number of bytes to be written
+ *  \param[in]   offset Offset in RAM image
+ *  \return      Status of write operation
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalWrite( IO_MemPtrType writeBuffer, IO_SizeType writeLength, IO_PositionType offset )
+{
+   IO_SizeType requiredSize;
+   IO_SizeType i;
+   IO_U8 isEqual;
+   IO_ErrorType result;
+
+   isEqual = 1u;
+   for (i = 0u; i < writeLength; i++)
+   {
+      if (eepData[offset + i] != writeBuffer[i])
+      {
+         isEqual = 0u;
+      }
+   }
+
+   result = IO_E_OK;
+
+   if (0u == isEqual)
+   {
+      requiredSize = ((writeLength / EEP_JOURNAL_MAX_RECORD_LENGTH) * EepJournalRecordSize(EEP_JOURNAL_MAX_RECORD_LENGTH))
+                     + EEP_JOURNAL_COMMIT_SIZE;
+      if ((writeLength % EEP_JOURNAL_MAX_RECORD_LENGTH) != 0u)
+      {
+         requiredSize += EepJournalRecordSize(writeLength % EEP_JOURNAL_MAX_RECORD_LENGTH);
+      }
+
+      result = IO_E_NOT_OK;
+
+      if ((eepJournalAppendPos + requiredSize) <= EEP_JOURNAL_PAGE_SIZE)
+      {
+         result = EepJournalAppend(offset, writeBuffer, writeLength);
+      }
+
+      if (IO_E_OK != result)
+      {
+         result = EepJournalCompact(offset, writeBuffer, writeLength);
+      }
+
+      if (IO_E_OK == result)
+      {
+         (void)MEMCPY(&eepData[offset], writeBuffer, writeLength);
+      }
+   }
+
+   return result;
+}
+#endif /* EEP_ENABLE_JOURNAL */
+
+/***********************************************************************************************************************
+ *  EepromDriver_WriteData
+ **********************************************************************************************************************/
+/*! \brief       Write data to EEPROM memory
+ *  \pre         Address range has been checked
+ *  \param[in]   writeBuffer Write data buffer
+ *  \param[in]   writeLength Number of bytes to be written
+ *  \param[in]   writeAddress The write address
+ *  \return      Status of EEPROM programming
+ **********************************************************************************************************************/
+static IO_ErrorType EepromDriver_WriteData( IO_MemPtrType writeBuffer, IO_SizeType writeLength, IO_PositionType writeAddress )
+{
+#if defined( EEP_ENABLE_JOURNAL )
+   /* Append to journal, RAM image is updated on success */
+   return EepJournalWrite(writeBuffer, writeLength, writeAddress - EEP_BASE_ADDRESS); /* PRQA S 0306 */ /* MD_EepIO_0306 */
+#else
+   (void)MEMCPY(&eepData[writeAddress - EEP_BASE_ADDRESS], writeBuffer, writeLength); /* PRQA S 0306 */ /* MD_EepIO_0306 */
+
+   return IO_E_OK;
+#endif /* EEP_ENABLE_JOURNAL */
+}
+
 /***********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  **********************************************************************************************************************/
@@ -124,11 +837,19 @@ static IO_ErrorType EepromDriver_CheckRangeContained( IO_SizeType length, IO_Pos
  **********************************************************************************************************************/
 IO_ErrorType V_API_NEAR EepromDriver_InitSync( void * address )                    /* PRQA S 3673 */ /* MD_EepIO_3673 */
 {
+#if defined( EEP_ENABLE_JOURNAL )
+# if defined( V_ENABLE_USE_DUMMY_STATEMENT )
+   (void)address;                                                                  /* PRQA S 3112 */ /* MD_EepIO_3112 */
+# endif
+
+   /* Rebuild RAM image from journal */
+   return EepJournalInit();
+#else
    IO_SizeType i;
 
-#if defined( V_ENABLE_USE_DUMMY_STATEMENT )
+# if defined( V_ENABLE_USE_DUMMY_STATEMENT )
    (void)address;                                                                  /* PRQA S 3112 */ /* MD_EepIO_3112 */
-#endif
+# endif
 
    /* Check if buffer already initialized */
    if (EEP_INIT_FLAG != eepData[EEP_BUFFER_SIZE - 1u])
@@ -144,6 +865,7 @@ IO_ErrorType V_API_NEAR EepromDriver_InitSync( void * address )
    }
 
    return IO_E_OK;
+#endif /* EEP_ENABLE_JOURNAL */
 }
 
 /***********************************************************************************************************************
@@ -180,8 +902,27 @@ IO_ErrorType V_API_NEAR EepromDriver_RWriteSync( IO_MemPtrType writeBuffer, IO_S
 
    if (IO_E_OK == result)
    {
+#if defined( EEP_ENABLE_TRANSACTION )
+      if (0u != eepTransactionActive)
+      {
+         /* Stage data, written by EepromDriver_TransactionCommit */
+         writeAddress -= EEP_BASE_ADDRESS;                                         /* PRQA S 0306 */ /* MD_EepIO_0306 */
+         (void)MEMCPY(&eepTransactionData[writeAddress], writeBuffer, writeLength);
 
-      (void)MEMCPY((IO_MemPtrType)writeAddress, writeBuffer, writeLength); /* PRQA S 0306 */ /* MD_EepIO_0306 */
+         if (writeAddress < eepTransactionBegin)
+         {
+            eepTransactionBegin = writeAddress;
+         }
+         if ((writeAddress + writeLength) > eepTransactionEnd)
+         {
+            eepTransactionEnd = writeAddress + writeLength;
+         }
+      }
+      else
+#endif /* EEP_ENABLE_TRANSACTION */
+      {
+         result = EepromDriver_WriteData(writeBuffer, writeLength, writeAddress);
+      }
    }
 
    return result;
@@ -228,11 +969,81 @@ IO_ErrorType V_API_NEAR EepromDriver_RReadSync( IO_MemPtrType readBuffer, IO_Siz
 
    if (IO_E_OK == result)
    {
-      (void)MEMCPY(readBuffer, (IO_MemPtrType)readAddress, readLength); /* PRQA S 0306 */ /* MD_EepIO_0306 */
+#if defined( EEP_ENABLE_TRANSACTION )
+      if (0u != eepTransactionActive)
+      {
+         /* Staged data is visible to the transaction */
+         (void)MEMCPY(readBuffer, &eepTransactionData[readAddress - EEP_BASE_ADDRESS], readLength); /* PRQA S 0306 */ /* MD_EepIO_0306 */
+      }
+      else
+#endif /* EEP_ENABLE_TRANSACTION */
+      {
+         (void)MEMCPY(readBuffer, &eepData[readAddress - EEP_BASE_ADDRESS], readLength); /* PRQA S 0306 */ /* MD_EepIO_0306 */
+      }
+   }
+
+   return result;
+}
+
+#if defined( EEP_ENABLE_TRANSACTION )
+/***********************************************************************************************************************
+ *  EepromDriver_TransactionStart
+ **********************************************************************************************************************/
+/*! \brief       Start staging of EEPROM writes
+ *  \details     Subsequent writes are kept in RAM until EepromDriver_TransactionCommit is called. Reads return the
+ *               staged data.
+ *  \pre         EEPROM driver has to be initialized
+ *  \return      IO_E_OK if transaction was started, IO_E_NOT_OK if a transaction is already active
+ **********************************************************************************************************************/
+IO_ErrorType V_API_NEAR EepromDriver_TransactionStart( void )
+{
+   IO_ErrorType result;
+
+   result = IO_E_NOT_OK;
+
+   if (0u == eepTransactionActive)
+   {
+      (void)MEMCPY(eepTransactionData, eepData, EEP_BUFFER_SIZE);
+      eepTransactionBegin  = EEP_BUFFER_SIZE;
+      eepTransactionEnd    = 0u;
+      eepTransactionActive = 1u;
+
+      result = IO_E_OK;
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  EepromDriver_TransactionCommit
+ **********************************************************************************************************************/
+/*! \brief       Write all data staged by the active transaction
+ *  \details     The staged range is written by a single write operation. With the journal enabled this write is
+ *               atomic: after a reset either all or none of the staged data is present.
+ *  \pre         EEPROM driver has to be initialized
+ *  \return      Status of EEPROM programming, IO_E_NOT_OK if no transaction is active
+ **********************************************************************************************************************/
+IO_ErrorType V_API_NEAR EepromDriver_TransactionCommit( void )
+{
+   IO_ErrorType result;
+
+   result = IO_E_NOT_OK;
+
+   if (0u != eepTransactionActive)
+   {
+      eepTransactionActive = 0u;
+      result = IO_E_OK;
+
+      if (eepTransactionBegin < eepTransactionEnd)
+      {
+         result = EepromDriver_WriteData(&eepTransactionData[eepTransactionBegin], eepTransactionEnd - eepTransactionBegin,
+                                         EEP_BASE_ADDRESS + eepTransactionBegin); /* PRQA S 0306 */ /* MD_EepIO_0306 */
+      }
    }
 
    return result;
 }
+#endif /* EEP_ENABLE_TRANSACTION */
 
 /***********************************************************************************************************************
  *  EepromDriver_VerifySync
@@ -62,6 +62,28 @@
                                             (IO_U32)(EEPROM_DRIVER_VERSION_MINOR << 8u)  | \
                                                      EEPROM_DRIVER_VERSION_PATCH)
 
+#if defined( EEP_ENABLE_JOURNAL )
+/* Journal storage: EEP_JOURNAL_PAGE_COUNT pages used round robin, each page erased as a whole.
+ * Without EEP_JOURNAL_ENABLE_USER_DEVICE the journal device is emulated in RAM, which costs
+ * EEP_JOURNAL_PAGE_COUNT * EEP_JOURNAL_PAGE_SIZE bytes (1 KiB with the defaults) on top of the EEPROM image
+ * and does not survive a reset. Enable EEP_JOURNAL_ENABLE_USER_DEVICE and provide the EepJournalDevice functions
+ * (see _Template/_EepJournalDevice.c for a data flash example) to place the journal in non-volatile memory. */
+# if !defined( EEP_JOURNAL_PAGE_COUNT )
+#  define EEP_JOURNAL_PAGE_COUNT          2u
+# endif
+# if !defined( EEP_JOURNAL_PAGE_SIZE )
+#  define EEP_JOURNAL_PAGE_SIZE           0x200u
+# endif
+/** Write granularity of journal device, power of two, at least 4 */
+# if !defined( EEP_JOURNAL_WRITE_SIZE )
+#  define EEP_JOURNAL_WRITE_SIZE          4u
+# endif
+/** Maximum data length of one journal record (at most 0xFE) */
+# if !defined( EEP_JOURNAL_MAX_RECORD_LENGTH )
+#  define EEP_JOURNAL_MAX_RECORD_LENGTH   0x40u
+# endif
+#endif /* EEP_ENABLE_JOURNAL */
+
 /***********************************************************************************************************************
  *  GLOBAL FUNCTION PROTOTYPES
  **********************************************************************************************************************/
@@ -75,6 +97,21 @@ IO_ErrorType V_API_NEAR EepromDriver_RReadSync( IO_MemPtrType, IO_SizeType, IO_P
 IO_ErrorType V_API_NEAR EepromDriver_RWriteSync( IO_MemPtrType, IO_SizeType, IO_PositionType );
 IO_ErrorType V_API_NEAR EepromDriver_REraseSync( IO_SizeType, IO_PositionType );
 
+#if defined( EEP_ENABLE_JOURNAL ) && \
+    defined( EEP_JOURNAL_ENABLE_USER_DEVICE )
+/* Access to journal device (e.g. data flash), positions relative to start of journal area.
+ * Erase is called per journal page, write with multiples of EEP_JOURNAL_WRITE_SIZE. All functions return IO_E_OK on
+ * success, the blank check returns IO_E_OK only if the complete area is erased. */
+IO_ErrorType EepJournalDeviceRead( IO_MemPtrType readBuffer, IO_SizeType readLength, IO_PositionType readPosition );
+IO_ErrorType EepJournalDeviceWrite( IO_MemPtrType writeBuffer, IO_SizeType writeLength, IO_PositionType writePosition );
+IO_ErrorType EepJournalDeviceErase( IO_SizeType eraseLength, IO_PositionType erasePosition );
+IO_ErrorType EepJournalDeviceBlankCheck( IO_SizeType checkLength, IO_PositionType checkPosition );
+#endif /* EEP_ENABLE_JOURNAL && EEP_JOURNAL_ENABLE_USER_DEVICE */
+#if defined( EEP_ENABLE_TRANSACTION )
+IO_ErrorType V_API_NEAR EepromDriver_TransactionStart( void );
+IO_ErrorType V_API_NEAR EepromDriver_TransactionCommit( void );
+#endif /* EEP_ENABLE_TRANSACTION */
+
 #define EEPDUMMY_FULL_STOP_SEC_CODE
 #include "MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_19.1 */
 
@@ -0,0 +1,244 @@
+/***********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/** \file
+ *  \brief         Journal device access for the EEPROM driver (data flash example)
+ *  \details       Implements the EepJournalDevice functions required by EepIO.c if EEP_JOURNAL_ENABLE_USER_DEVICE is
+ *                 set. The journal area is placed in the RH850 data flash and accessed through the Renesas data flash
+ *                 library (FDL T01). Reading uses the memory mapped data flash, programming, erasing and blank checks
+ *                 are executed by the FDL.
+ *
+ *  \note          Please note, that this file contains a collection of callback functions to be used with the
+ *                 Flash Bootloader. These functions may influence the behavior of the bootloader in principle.
+ *                 Therefore, great care must be taken to verify the correctness of the implementation.
+ *                 The contents of this file are only an example resp. an implementation proposal.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  INCLUDES
+ **********************************************************************************************************************/
+
+#include "EepInc.h"
+
+#if defined( EEP_ENABLE_JOURNAL ) && \
+    defined( EEP_JOURNAL_ENABLE_USER_DEVICE )
+
+/* Renesas data flash library and the descriptor generated for the target device */
+#include "r_fdl.h"
+#include "fdl_descriptor.h"
+
+/***********************************************************************************************************************
+ *  DEFINES
+ **********************************************************************************************************************/
+
+/** Memory mapped start address of the journal area in the data flash */
+#if !defined( EEP_JOURNAL_DEVICE_ADDRESS )
+# define EEP_JOURNAL_DEVICE_ADDRESS       0xFF200000ul
+#endif
+/** Offset of the journal area from the start of the data flash (FDL addresses are relative to it) */
+#if !defined( EEP_JOURNAL_DEVICE_OFFSET )
+# define EEP_JOURNAL_DEVICE_OFFSET        0x00000000ul
+#endif
+/** Erase granularity of the data flash */
+#define EEP_JOURNAL_DEVICE_BLOCK_SIZE     0x40u
+/** Program granularity of the data flash */
+#define EEP_JOURNAL_DEVICE_WORD_SIZE      4u
+/** Size of the local buffer used to align write data */
+#define EEP_JOURNAL_DEVICE_BUFFER_SIZE    0x40u
+
+#if ( (EEP_JOURNAL_PAGE_SIZE % EEP_JOURNAL_DEVICE_BLOCK_SIZE) != 0u ) || \
+    ( (EEP_JOURNAL_DEVICE_OFFSET % EEP_JOURNAL_DEVICE_BLOCK_SIZE) != 0u )
+# error "Journal pages have to be aligned to data flash blocks."
+#endif
+#if ( (EEP_JOURNAL_WRITE_SIZE % EEP_JOURNAL_DEVICE_WORD_SIZE) != 0u )
+# error "EEP_JOURNAL_WRITE_SIZE has to be a multiple of the data flash word size."
+#endif
+
+/***********************************************************************************************************************
+ *  LOCAL DATA
+ **********************************************************************************************************************/
+
+#define EEPDUMMY_START_SEC_VAR
+#include "MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_19.1 */
+/** Data flash library initialized flag */
+V_MEMRAM0 static V_MEMRAM1 IO_U8 V_MEMRAM2 eepJournalDeviceReady;
+/** Word aligned copy of the write data handed over to the data flash library */
+V_MEMRAM0 static V_MEMRAM1 IO_U32 V_MEMRAM2 eepJournalDeviceBuffer[EEP_JOURNAL_DEVICE_BUFFER_SIZE / 4u];
+#define EEPDUMMY_STOP_SEC_VAR
+#include "MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_19.1 */
+
+/***********************************************************************************************************************
+ *  LOCAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+
+#define EEPDUMMY_FULL_START_SEC_CODE
+#include "MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_19.1 */
+
+static IO_ErrorType EepJournalDeviceExecute( r_fdl_command_t command, IO_U32 index, IO_U16 count, IO_U32 buffer );
+
+/***********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  EepJournalDeviceExecute
+ **********************************************************************************************************************/
+/*! \brief       Execute data flash library command and wait for its completion
+ *  \details     The data flash library is initialized on first use. The watchdog is triggered while the command
+ *               is busy. The data flash can be operated while code is executed from the code flash.
+ *  \param[in]   command Data flash library command
+ *  \param[in]   index Byte address (write, blank check) or block number (erase) relative to data flash start
+ *  \param[in]   count Number of words (write, blank check) or blocks (erase)
+ *  \param[in]   buffer Address of word aligned write data
+ *  \return      IO_E_OK if the command succeeded, IO_E_NOT_OK otherwise
+ **********************************************************************************************************************/
+static IO_ErrorType EepJournalDeviceExecute( r_fdl_command_t command, IO_U32 index, IO_U16 count, IO_U32 buffer )
+{
+   r_fdl_request_t request;
+   IO_ErrorType result;
+
+   result = IO_E_OK;
+
+   if (0u == eepJournalDeviceReady)
+   {
+      if (R_FDL_OK == R_FDL_Init(&sampleApp_fdlConfig_enu))
+      {
+         eepJournalDeviceReady = 1u;
+      }
+      else
+      {
+         result = IO_E_NOT_OK;
+      }
+   }
+
+   if (IO_E_OK == result)
+   {
+      request.command_enu     = command;
+      request.idx_u32         = index;
+      request.cnt_u16         = count;
+      request.bufAddr_u32     = buffer;
+      request.accessType_enu  = R_FDL_ACCESS_USER;
+      request.status_enu      = R_FDL_BUSY;
+
+      R_FDL_Execute(&request);
+
+      while (R_FDL_BUSY == request.status_enu)
+      {
+         (void)FblLookForWatchdog();
+         R_FDL_Handler();
+      }
+
+      if (R_FDL_OK != request.status_enu)
+      {
+         result = IO_E_NOT_OK;
+      }
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  EepJournalDeviceRead
+ **********************************************************************************************************************/
+/*! \brief       Read from journal area in data flash
+ *  \details     The journal only reads areas which passed the blank check before or which were programmed,
+ *               so the memory mapped read does not access erased data flash cells.
+ *  \param[out]  readBuffer Read data buffer
+ *  \param[in]   readLength Number of bytes to be read
+ *  \param[in]   readPosition Position in journal area
+ *  \return      Status of read operation
+ **********************************************************************************************************************/
+IO_ErrorType EepJournalDeviceRead( IO_MemPtrType readBuffer, IO_SizeType readLength, IO_PositionType readPosition )
+{
+   (void)MEMCPY(readBuffer, (IO_MemPtrType)(EEP_JOURNAL_DEVICE_ADDRESS + readPosition), readLength); /* PRQA S 0306 */ /* MD_EepIO_0306 */
+
+   return IO_E_OK;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalDeviceWrite
+ **********************************************************************************************************************/
+/*! \brief       Program journal area in data flash
+ *  \details     The data is copied to a word aligned buffer in chunks of EEP_JOURNAL_DEVICE_BUFFER_SIZE bytes,
+ *               as the caller's buffer may have any alignment.
+ *  \param[in]   writeBuffer Write data buffer
+ *  \param[in]   writeLength Number of bytes to be written, multiple of EEP_JOURNAL_WRITE_SIZE
+ *  \param[in]   writePosition Position in journal area
+ *  \return      Status of write operation
+ **********************************************************************************************************************/
+IO_ErrorType EepJournalDeviceWrite( IO_MemPtrType writeBuffer, IO_SizeType writeLength, IO_PositionType writePosition )
+{
+   IO_ErrorType result;
+   IO_SizeType offset;
+   IO_SizeType chunkLength;
+
+   result = IO_E_OK;
+   offset = 0u;
+
+   while ((IO_E_OK == result) && (offset < writeLength))
+   {
+      chunkLength = writeLength - offset;
+      if (chunkLength > EEP_JOURNAL_DEVICE_BUFFER_SIZE)
+      {
+         chunkLength = EEP_JOURNAL_DEVICE_BUFFER_SIZE;
+      }
+
+      (void)MEMCPY((IO_MemPtrType)eepJournalDeviceBuffer, &writeBuffer[offset], chunkLength);
+
+      result = EepJournalDeviceExecute(R_FDL_CMD_WRITE,
+                                       EEP_JOURNAL_DEVICE_OFFSET + writePosition + offset,
+                                       (IO_U16)(chunkLength / EEP_JOURNAL_DEVICE_WORD_SIZE),
+                                       (IO_U32)eepJournalDeviceBuffer); /* PRQA S 0306 */ /* MD_EepIO_0306 */
+
+      offset += chunkLength;
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  EepJournalDeviceErase
+ **********************************************************************************************************************/
+/*! \brief       Erase journal area in data flash
+ *  \param[in]   eraseLength Number of bytes to be erased, multiple of the data flash block size
+ *  \param[in]   erasePosition Position in journal area, aligned to data flash block
+ *  \return      Status of erase operation
+ **********************************************************************************************************************/
+IO_ErrorType EepJournalDeviceErase( IO_SizeType eraseLength, IO_PositionType erasePosition )
+{
+   return EepJournalDeviceExecute(R_FDL_CMD_ERASE,
+                                  (EEP_JOURNAL_DEVICE_OFFSET + erasePosition) / EEP_JOURNAL_DEVICE_BLOCK_SIZE,
+                                  (IO_U16)(eraseLength / EEP_JOURNAL_DEVICE_BLOCK_SIZE),
+                                  0u);
+}
+
+/***********************************************************************************************************************
+ *  EepJournalDeviceBlankCheck
+ **********************************************************************************************************************/
+/*! \brief       Check whether area of journal is erased
+ *  \details     Uses the blank check of the data flash library, as erased data flash cells can not be detected
+ *               by reading them.
+ *  \param[in]   checkLength Number of bytes to be checked
+ *  \param[in]   checkPosition Position in journal area
+ *  \return      IO_E_OK if area is erased, IO_E_NOT_OK otherwise
+ **********************************************************************************************************************/
+IO_ErrorType EepJournalDeviceBlankCheck( IO_SizeType checkLength, IO_PositionType checkPosition )
+{
+   return EepJournalDeviceExecute(R_FDL_CMD_BLANKCHECK,
+                                  EEP_JOURNAL_DEVICE_OFFSET + checkPosition,
+                                  (IO_U16)(checkLength / EEP_JOURNAL_DEVICE_WORD_SIZE),
+                                  0u);
+}
+
+#define EEPDUMMY_FULL_STOP_SEC_CODE
+#include "MemMap.h"  /* PRQA S 5087 */ /* MD_MSR_19.1 */
+
+#endif /* EEP_ENABLE_JOURNAL && EEP_JOURNAL_ENABLE_USER_DEVICE */
+
+/***********************************************************************************************************************
+ *  END OF FILE: _EEPJOURNALDEVICE.C
+ **********************************************************************************************************************/
@@ -130,6 +130,20 @@
 
 /* ----------------------------------------------------------------------------------------------------------------- */
 
+#if defined( FBLHW_RXQUEUE_START_SEC_CODE )
+   /* #pragma <enter your compiler specific pragma> */
+# undef FBLHW_RXQUEUE_START_SEC_CODE
+# undef FBL_MEMMAP_ERROR
+#endif
+
+#if defined( FBLHW_RXQUEUE_STOP_SEC_CODE )
+   /* #pragma <enter your compiler specific pragma> */
+# undef FBLHW_RXQUEUE_STOP_SEC_CODE
+# undef FBL_MEMMAP_ERROR
+#endif
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+
 #if defined( FBLLIB_MEM_RAMCODE_START_SEC_CODE ) || \
     defined( FBLLIB_MEM_RAMCODE_START_SEC_CODE_EXPORT )
    /* #pragma <enter your compiler specific pragma> */
@@ -306,6 +320,20 @@
 
 /* ----------------------------------------------------------------------------------------------------------------- */
 
+#if defined( FBL_MAIN_RUNTIME_START_SEC_CODE )
+   /* #pragma <enter your compiler specific pragma> */
+# undef FBL_MAIN_RUNTIME_START_SEC_CODE
+# undef FBL_MEMMAP_ERROR
+#endif
+
+#if defined( FBL_MAIN_RUNTIME_STOP_SEC_CODE )
+   /* #pragma <enter your compiler specific pragma> */
+# undef FBL_MAIN_RUNTIME_STOP_SEC_CODE
+# undef FBL_MEMMAP_ERROR
+#endif
+
+/* ----------------------------------------------------------------------------------------------------------------- */
+
 #if defined( FBL_MAIN_MAGICFLAG_START_SEC_VAR )
    /* #pragma <enter your compiler specific pragma> */
 # undef FBL_MAIN_MAGICFLAG_START_SEC_VAR
@@ -518,6 +518,11 @@ static tFblResult ApplFblSetModulePresence( tBlockDescriptor * blockDescriptor )
 #endif
       (void)FblRealTimeSupport();
 
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+      /* Presence pattern is written directly through memory driver */
+      FblMemDiscardErasedState(presPtnAddress, presPtnLen);
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
+
       /* Write presence pattern */
       if (!ApplFblWritePattern(pFlashHeader, presPtnLen, presPtnAddress))
       {
@@ -598,6 +603,10 @@ static tFblResult ApplFblClrModulePresence( tBlockDescriptor * blockDescriptor )
             pFlashHeader[i] = 0;
          }
 #endif
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+         /* Mask pattern is written directly through memory driver */
+         FblMemDiscardErasedState((presPtnAddress + presPtnLen), presPtnLen);
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
          /* Now write them */
          if (!ApplFblWritePattern(pFlashHeader, presPtnLen, (presPtnAddress + presPtnLen)))
          {
@@ -276,7 +276,9 @@ void V_API_NEAR FblCwTimerTask( void )
          {
 #endif
             /* Call transport layer cyclic function */
+            FblMainRuntimeStart(kFblMainRuntimeTpTask);
             FblTpTask();
+            FblMainRuntimeStop(kFblMainRuntimeTpTask);
 #if ( TpCallCycle > 1 )
             tpCycleCounter = 0u;
          }
@@ -912,6 +914,7 @@ void FblCwPrecopy( pChipDataPtr data )
 {
 #endif
    vuint8 * pFuncBuffer;
+   vuint8 sfDataLength;
 
 #if defined( V_ENABLE_USE_DUMMY_STATEMENT )
    (void)data; /* PRQA S 3112 */ /* MD_MSR_14.2 */
@@ -919,6 +922,11 @@ void FblCwPrecopy( pChipDataPtr data )
 
 #if defined( FBL_TP_ENABLE_FIX_RX_DLC_CHECK )
 # if defined( FBL_TP_ENABLE_VARIABLE_RX_DLC )
+# elif defined( FBL_TP_ENABLE_CAN_FD )
+   if (CanRxActualDLC < 8u)
+   {
+      return;
+   }
 # else
    if (CanRxActualDLC != 8u)
    {
@@ -926,10 +934,24 @@ void FblCwPrecopy( pChipDataPtr data )
    }
 # endif
 #endif
-   if ((pCanData[kTpciPos] != 0u) && (pCanData[kTpciPos] < CanRxActualDLC))
+
+   sfDataLength = pCanData[kTpciPos];
+#if defined( FBL_TP_ENABLE_CAN_FD )
+   if (CanRxActualDLC > 8u)
+   {
+      /* CAN FD frame: SF_DL is stored in the byte following the TPCI (escape sequence) */
+      sfDataLength = 0u;
+      if ((0u == pCanData[kTpciPos]) && (pCanData[kTpciPos + 1u] < (CanRxActualDLC - 1u)))
+      {
+         sfDataLength = pCanData[kTpciPos + 1u];
+      }
+   }
+#endif
+
+   if ((sfDataLength != 0u) && (sfDataLength < CanRxActualDLC))
    {
       /* Try to get the functional request buffer */
-      pFuncBuffer = FblDiagRxGetFuncBuffer(pCanData[kTpciPos]);
+      pFuncBuffer = FblDiagRxGetFuncBuffer(sfDataLength);
 
       /* Physical buffer is available. Service can be processed. */
       if (NULL != pFuncBuffer)
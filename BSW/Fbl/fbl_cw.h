@@ -282,6 +282,11 @@ V_MEMRAM0 extern V_MEMRAM1 vuint8 V_MEMRAM2 fblCwStateStartMsg;
 # error "Error in fbl_cfg.h/fbl_tp.h: Unsupported confirmation handling"
 #endif
 
+#if defined( FBL_TP_ENABLE_CAN_FD ) && \
+  ! defined( FBL_ENABLE_CAN_FD )
+# error "Error in fbl_cfg.h/ftp_cfg.h: CAN FD transport requires CAN FD support of the CAN driver"
+#endif
+
 #endif /* __FBL_CW_H__ */
 
 /***********************************************************************************************************************
@@ -387,6 +387,9 @@ void        DiagExRCRResponsePending( vuint8 forceSend );
 /* Diagnostic task functions */
 void        FblDiagTimerTask( void );
 void        FblDiagStateTask( void );
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+tFblResult  FblDiagIsStateTaskPending( void );
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
 /* Diagnostic response after reset handling */
 void        FblDiagInitStartFromAppl( void );
 #if defined( FBL_ENABLE_RESPONSE_AFTER_RESET )
@@ -401,6 +404,9 @@ V_MEMRAM1 vuint8 V_MEMRAM2 V_MEMRAM3 * FblDiagMemGetActiveBuffer(void);
 /* Callback functions from FblLib_Mem */
 tFblResult  FblDiagMemPreWrite( void );
 tFblResult  FblDiagMemPostWrite( void );
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+void        FblDiagMemPreUnblock( void );
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
 
 /* Start section to execute code from RAM */
 #define FBLDIAG_RAMCODE_START_SEC_CODE
@@ -105,6 +105,13 @@
 # define kDiagRqlSpsFromAppl kDiagRqlDiagnosticSessionControl
 #endif
 
+#if defined( FBL_DIAG_ENABLE_SERVICE_INDEX )
+/* Service table index, opt-in as it takes kDiagServiceIndexSize bytes of RAM */
+# define kDiagServiceIndexSize            0x100u               /**< One entry per service ID */
+# define kDiagServiceIndexInvalid         0x00u                /**< Service ID not contained in service table */
+# define kDiagServiceIndexMaxEntries      0xFFu                /**< Number of service table entries which can be indexed */
+#endif /* FBL_DIAG_ENABLE_SERVICE_INDEX */
+
 /* Specific service responses */
 /* RoutineControl status for eraseMemory */
 #if !defined( kDiagEraseSucceeded )
@@ -207,6 +214,12 @@ V_MEMRAM0 static V_MEMROM1 tFblDiagServiceTable V_MEMROM2 V_MEMROM3 * V_MEMRAM1
 /** Pointer to current service's sub table */
 V_MEMRAM0 static V_MEMROM1 tFblDiagServiceSubTable V_MEMROM2 V_MEMROM3 * V_MEMRAM1 V_MEMRAM2 subServiceInfo;
 
+#if defined( FBL_DIAG_ENABLE_SERVICE_INDEX )
+/** Service table index, addressed by service ID: position in kFblDiagServiceTable + 1, kDiagServiceIndexInvalid if
+ *  service is not supported */
+V_MEMRAM0 static V_MEMRAM1 vuint8 V_MEMRAM2 serviceIndexTable[kDiagServiceIndexSize];
+#endif /* FBL_DIAG_ENABLE_SERVICE_INDEX */
+
 #if defined( FBL_DIAG_ENABLE_SERVICE_PREHANDLER )
 /** Pre handler of current request */
 V_MEMRAM0 static V_MEMRAM1 tFblDiagPreHandler V_MEMRAM2 fblDiagServicePreHandler;
@@ -260,6 +273,9 @@ static void       FblDiagDiscardReception(void);
 static void       FblDiagResponseProcessor(void);
 
 static V_MEMROM1 tFblDiagServiceTable V_MEMROM2 V_MEMROM3 * FblDiagGetServiceInfo(vuint8 receivedServiceId);
+#if defined( FBL_DIAG_ENABLE_SERVICE_INDEX )
+static void FblDiagInitServiceIndex(void);
+#endif /* FBL_DIAG_ENABLE_SERVICE_INDEX */
 
 static vuint32 FblDiagCheckServiceTableEntry(V_MEMROM1 tFblDiagServiceTable V_MEMROM2 V_MEMROM3* pServiceInfo,
                                              vuint8 *pbDiagData,
@@ -862,6 +878,23 @@ static void FblDiagResponseProcessor( void )
    }
 }  /* PRQA S 6080 */ /* MD_MSR_STMIF */
 
+#if defined( FBL_DIAG_ENABLE_CORE_EARLY_RESPONSE )
+/***********************************************************************************************************************
+ *  FblDiagSendEarlyResponse
+ **********************************************************************************************************************/
+/*! \brief       Transmit the response of the current service while its main handler is still executed.
+ *  \details     The remaining operations of the main handler must not change the response. Service processing is
+ *               concluded, i.e. the main handler must not report any other result afterwards.
+ *  \pre         Response has been prepared by DiagProcessingDone.
+ **********************************************************************************************************************/
+void FblDiagSendEarlyResponse( void )
+{
+   assertFblInternal((diagResponseFlag & kDiagPutPosResponse) != 0u, kFblSysAssertParameterOutOfRange);  /* PRQA S 2214 */ /* MD_FblDiag_2214 */
+
+   FblDiagResponseProcessor();
+}
+#endif /* FBL_DIAG_ENABLE_CORE_EARLY_RESPONSE */
+
 /***********************************************************************************************************************
  *  ChkSuppressPosRspMsgIndication
  **********************************************************************************************************************/
@@ -1039,6 +1072,11 @@ void FblDiagInitPowerOn(void)
    /* Initialize diagnostic session */
    FblDiagSetDefaultSession();   /* PRQA S 3109 */ /* MD_FblDiag_3109 */
 
+#if defined( FBL_DIAG_ENABLE_SERVICE_INDEX )
+   /* Build lookup table for service dispatcher */
+   FblDiagInitServiceIndex();
+#endif /* FBL_DIAG_ENABLE_SERVICE_INDEX */
+
    /* Stop tester present timer */
    StopTesterTimeout();
 
@@ -1266,6 +1304,25 @@ static tFblResult FblDiagServiceProcessingTask(vuint8 *pbDiagData, tCwDataLength
          serviceProcessingErrors = kFblDiagServiceNotFound;
          fblDiagServiceNrcHandler = FblDiagDefaultNrcHandler;
       }
+#if defined( FBL_DIAG_ENABLE_OEM_TRANSFERDATA_FASTPATH )
+      /* TransferData request of an active download: session and security access are checked against the service
+       * table entry, the request format has been checked by the OEM layer. Sub-table search and length checks of
+       * the service table are skipped. */
+      else if ( (diagServiceCurrent == kDiagSidTransferData)
+             && ((serviceInfo->serviceOptions & GetCurrentSession()) != 0u)
+             && (((serviceInfo->serviceOptions & kFblDiagOptionSecuredService) == 0u) || (FblDiagGetSecurityUnlock()))
+             && (FblDiagOemCheckTransferDataFastPath(pbDiagData, diagReqDataLen) == kFblOk) )
+      {
+# if defined( FBL_DIAG_ENABLE_SERVICE_PREHANDLER )
+         fblDiagServicePreHandler = serviceInfo->servicePreHandler;
+# endif /* FBL_DIAG_ENABLE_SERVICE_PREHANDLER */
+         fblDiagServiceMainHandler = serviceInfo->serviceMainHandler;
+# if defined( FBL_DIAG_ENABLE_SERVICE_POSTHANDLER )
+         fblDiagServicePostHandler = serviceInfo->servicePostHandler;
+# endif /* FBL_DIAG_ENABLE_SERVICE_POSTHANDLER */
+         fblDiagServiceNrcHandler = serviceInfo->serviceNrcHandler;
+      }
+#endif /* FBL_DIAG_ENABLE_OEM_TRANSFERDATA_FASTPATH */
       else
       {
          serviceProcessingErrors = FblDiagCheckServiceTableEntry(serviceInfo, pbDiagData, diagReqDataLen);
@@ -1310,18 +1367,18 @@ static tFblResult FblDiagServiceProcessingTask(vuint8 *pbDiagData, tCwDataLength
             /* No sub-table used. Remove error bit. */
             serviceProcessingErrors &= kFblDiagServiceLevelErrors;
          }
+      }
 
 #if defined( FBL_DIAG_ENABLE_SERVICE_PREHANDLER )
-         /* Use service pre-handler to check service preconditions. */
-         if (((serviceProcessingErrors & kFblDiagServiceErrorMask) == 0u) && (fblDiagServicePreHandler != (tFblDiagPreHandler)V_NULL))
+      /* Use service pre-handler to check service preconditions. */
+      if (((serviceProcessingErrors & kFblDiagServiceErrorMask) == 0u) && (fblDiagServicePreHandler != (tFblDiagPreHandler)V_NULL))
+      {
+         if ((*fblDiagServicePreHandler)(pbDiagData, diagReqDataLen) == kFblFailed)
          {
-            if ((*fblDiagServicePreHandler)(pbDiagData, diagReqDataLen) == kFblFailed)
-            {
-               serviceProcessingErrors |= kFblDiagServicePrehandlerFailure;
-            }
+            serviceProcessingErrors |= kFblDiagServicePrehandlerFailure;
          }
-#endif /* FBL_DIAG_ENABLE_SERVICE_PREHANDLER */
       }
+#endif /* FBL_DIAG_ENABLE_SERVICE_PREHANDLER */
    }
 
    /* Call service main handler or NRC handler */
@@ -1358,6 +1415,8 @@ static tFblResult FblDiagServiceProcessingTask(vuint8 *pbDiagData, tCwDataLength
  **********************************************************************************************************************/
 void FblDiagStateTask( void )
 {
+   FblMainRuntimeStart(kFblMainRuntimeDiagStateTask);
+
 #if defined( FBL_DIAG_ENABLE_TASK_LOCKS )
    if (!GetDiagStateTaskRunning())
    {
@@ -1377,6 +1436,14 @@ void FblDiagStateTask( void )
       FblMemResumeIndication();
 #endif /* FBL_MEM_ENABLE_PIPELINING */
 
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+      /* Continue pending programming operations while no service is processed */
+      if (diagResponseFlag == kDiagResponseIdle)
+      {
+         FblMemTask();
+      }
+#endif /* FBL_MEM_ENABLE_PIPELINING */
+
       /* Check for reset request
        * The following preconditions have to be fulfilled:
          * Reset message confirmed
@@ -1409,7 +1476,36 @@ void FblDiagStateTask( void )
       ClrFblDiagStateTaskRunning();
    }
 #endif /* FBL_DIAG_ENABLE_TASK_LOCKS */
+
+   FblMainRuntimeStop(kFblMainRuntimeDiagStateTask);
+}
+
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+/***********************************************************************************************************************
+ *  FblDiagIsStateTaskPending
+ **********************************************************************************************************************/
+/*! rief       Check if the state task has to be executed independent of main loop events
+ *  eturn      kFblOk if a service is processed, a response is pending or an ECU reset is pending, kFblFailed otherwise
+ **********************************************************************************************************************/
+tFblResult FblDiagIsStateTaskPending( void )
+{
+   tFblResult result;
+
+# if defined( FBL_DIAG_ENABLE_OEM_STATETASK )
+   /* OEM state task may have work pending at any time */
+   result = kFblOk;
+# else
+   result = kFblFailed;
+
+   if ((diagResponseFlag != kDiagResponseIdle) || (FblDiagGetWaitEcuReset()))
+   {
+      result = kFblOk;
+   }
+# endif /* FBL_DIAG_ENABLE_OEM_STATETASK */
+
+   return result;
 }
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
 
 /***********************************************************************************************************************
  *  Diagnostic tasks
@@ -1778,6 +1874,15 @@ static V_MEMROM1 tFblDiagServiceTable V_MEMROM2 V_MEMROM3 * FblDiagGetServiceInf
    /* Initialize variables */
    serviceTableEntry = (V_MEMROM1 tFblDiagServiceTable V_MEMROM2 V_MEMROM3 *)V_NULL;
 
+#if defined( FBL_DIAG_ENABLE_SERVICE_INDEX )
+   /* Look up service information */
+   serviceIndex = serviceIndexTable[receivedServiceId];
+
+   if (serviceIndex != kDiagServiceIndexInvalid)
+   {
+      serviceTableEntry = &kFblDiagServiceTable[serviceIndex - 1u];
+   }
+#else
    /* Search for service information */
    for (serviceIndex = 0u; serviceIndex < kSizeOfServiceTable; serviceIndex++)
    {
@@ -1789,10 +1894,46 @@ static V_MEMROM1 tFblDiagServiceTable V_MEMROM2 V_MEMROM3 * FblDiagGetServiceInf
          break;
       }
    }
+#endif /* FBL_DIAG_ENABLE_SERVICE_INDEX */
 
    return serviceTableEntry;
 }
 
+#if defined( FBL_DIAG_ENABLE_SERVICE_INDEX )
+/***********************************************************************************************************************
+ *  FblDiagInitServiceIndex
+ **********************************************************************************************************************/
+/*! \brief       Build service table index
+ *  \details     Each service ID is mapped to its entry in the service table, so the service dispatcher does not have
+ *               to search the table for every request (e.g. for each TransferData request during download).
+ *               If a service ID is configured multiple times, the first entry is used.
+ **********************************************************************************************************************/
+static void FblDiagInitServiceIndex(void)
+{
+   vuintx serviceIndex;
+
+   /* Service table has to fit into index */
+   assertFblUser(kSizeOfServiceTable <= kDiagServiceIndexMaxEntries, kFblSysAssertParameterOutOfRange);  /* PRQA S 2214 */ /* MD_FblDiag_2214 */
+
+   for (serviceIndex = 0u; serviceIndex < kDiagServiceIndexSize; serviceIndex++)
+   {
+      serviceIndexTable[serviceIndex] = kDiagServiceIndexInvalid;
+   }
+
+   /* Table is processed backwards, so first entry of a service ID takes precedence */
+   serviceIndex = kSizeOfServiceTable;
+   while (serviceIndex > 0u)
+   {
+      serviceIndex--;
+
+      if (serviceIndex < kDiagServiceIndexMaxEntries)
+      {
+         serviceIndexTable[kFblDiagServiceTable[serviceIndex].serviceId] = (vuint8)(serviceIndex + 1u);
+      }
+   }
+}
+#endif /* FBL_DIAG_ENABLE_SERVICE_INDEX */
+
 /***********************************************************************************************************************
  *  Callback functions from fbl_main
  **********************************************************************************************************************/
@@ -2099,6 +2240,10 @@ void FblDiagRxIndication(vuint8* pbDiagBuffer, tCwDataLengthType rxDataLength)
    /* Request received - reload sleep counter */
    FblSleepCounterReload();
 #endif
+
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+   FblMainSetEvent(kFblMainEventRx);
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
 }
 
 /***********************************************************************************************************************
@@ -2166,6 +2311,10 @@ void FblDiagRxErrorIndication(void)
 {
    /* Clear all other flags for service management */
    FblDiagConfirmation();
+
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+   FblMainSetEvent(kFblMainEventRx);
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
 }
 
 /***********************************************************************************************************************
@@ -2185,6 +2334,10 @@ void FblDiagTxErrorIndication(vuint8 cwMsgType)
       /* Clear all other flags for service management */
       FblDiagConfirmation();
    }
+
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+   FblMainSetEvent(kFblMainEventTx);
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
 }
 
 /***********************************************************************************************************************
@@ -2209,6 +2362,10 @@ void FblDiagTxConfirmation(vuint8 cwMsgType)
    {
       FblDiagSetResetMsgConfirmed();
    }
+
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+   FblMainSetEvent(kFblMainEventTx);
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
 }
 /* End section to execute code from RAM */
 # define FBLDIAG_RAMCODE_STOP_SEC_CODE
@@ -365,6 +365,9 @@ V_MEMRAM0 extern V_MEMRAM1 vuint16 V_MEMRAM2 fblDiagTimeP2Max;    /**< P2 base v
 #if defined( FBL_DIAG_ENABLE_CORE_SEGMENTHANDLING )
 vuint8 FblDiagSegmentNext(void);
 #endif /* FBL_DIAG_ENABLE_CORE_SEGMENTHANDLING */
+#if defined( FBL_DIAG_ENABLE_CORE_EARLY_RESPONSE )
+void FblDiagSendEarlyResponse(void);
+#endif /* FBL_DIAG_ENABLE_CORE_EARLY_RESPONSE */
 #if defined( FBL_DIAG_ENABLE_CORE_RANGECHECKS )
 tFblResult FblCheckAddressRange(tFblAddress address, tFblAddress rangeStart, tFblLength rangeLength);
 tFblResult FblCheckRangeContained(tFblAddress address, tFblLength length, tFblAddress rangeStart, tFblLength rangeLength);
@@ -407,6 +410,9 @@ void FblDiagOemStateTask(void);
 #if defined( FBL_DIAG_ENABLE_OEM_TIMERTASK )
 void FblDiagOemTimerTask(void);
 #endif /* FBL_DIAG_ENABLE_OEM_TIMERTASK */
+#if defined( FBL_DIAG_ENABLE_OEM_TRANSFERDATA_FASTPATH )
+tFblResult FblDiagOemCheckTransferDataFastPath(const vuint8 *pbDiagData, tCwDataLengthType diagReqDataLen);
+#endif /* FBL_DIAG_ENABLE_OEM_TRANSFERDATA_FASTPATH */
 
 #if defined( FBL_DIAG_ENABLE_OEM_SESSION_TIMEOUT )
 void FblDiagSessionTimeout(void);
@@ -208,6 +208,7 @@ static tFblResult FblDiagRequestDownloadLengthCheck(vuint8 *pbDiagData, tCwDataL
 static tFblResult FblDiagRequestDownloadMainHandler(vuint8 *pbDiagData, tCwDataLengthType diagReqDataLen);
 static tFblResult FblDiagTransferDataLengthCheck(vuint8 *pbDiagData, tCwDataLengthType diagReqDataLen);
 static tFblResult FblDiagTransferDataMainHandler(vuint8 *pbDiagData, tCwDataLengthType diagReqDataLen);
+static void FblDiagTransferDataAccept(void);
 static tFblResult FblDiagReqTransferExitMainHandler(vuint8 *pbDiagData, tCwDataLengthType diagReqDataLen);
 
 /* Service pre-handler functions */
@@ -252,6 +253,12 @@ V_MEMRAM0 static V_MEMRAM1 tBlockDescriptor     V_MEMRAM2      downloadBlockDesc
 V_MEMRAM0 static V_MEMRAM1 tFblLength           V_MEMRAM2      transferRemainder;
 /** Block sequence counter */
 V_MEMRAM0 static V_MEMRAM1 vuint8               V_MEMRAM2      expectedSequenceCnt;
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+/** Positive response of current TransferData request has already been sent */
+V_MEMRAM0 static V_MEMRAM1 vuint8               V_MEMRAM2      transferDataResponseSent;
+/** Programming error of an already acknowledged TransferData request */
+V_MEMRAM0 static V_MEMRAM1 tFblDiagNrc          V_MEMRAM2      transferDataDeferredNrc;
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
 
 /***********************************************************************************************************************
  *  Diagnostic handler function call table
@@ -699,23 +706,38 @@ static vuint8 FblDiagDownloadCheck(vuint8 *pbDiagData, tCwDataLengthType diagReq
       if (FblDiagGetTransferTypeFlash())
       {
          (void)FblRealTimeSupport();
-#if defined( SEC_ENABLE_CRC_TOTAL )
-         (void)ApplFblWriteCRCTotal(&downloadBlockDescriptor,
-                                    (vuint32)verifyParam.blockStartAddress,
-                                    (vuint32)verifyParam.blockLength,
-                                    (vuint32)verifyParam.crcTotal
-                                   );
-#endif /* SEC_ENABLE_CRC_TOTAL */
 
-         /* Call validation function to inform application */
-         if (ApplFblValidateBlock(downloadBlockDescriptor) != kFblOk)
+         /* Stage NV bookkeeping of the downloaded block, it is written at once on commit */
+         if (ApplFblNvTransactionStart() != kFblOk)
          {
+            /* Bookkeeping could not be written consistently */
             result = kDiagCheckVerificationFailed;
          }
          else
          {
-            /* Increment programming success counter */
-            (void)ApplFblIncProgCounts(downloadBlockDescriptor);
+#if defined( SEC_ENABLE_CRC_TOTAL )
+            (void)ApplFblWriteCRCTotal(&downloadBlockDescriptor,
+                                       (vuint32)verifyParam.blockStartAddress,
+                                       (vuint32)verifyParam.blockLength,
+                                       (vuint32)verifyParam.crcTotal
+                                      );
+#endif /* SEC_ENABLE_CRC_TOTAL */
+
+            /* Call validation function to inform application */
+            if (ApplFblValidateBlock(downloadBlockDescriptor) != kFblOk)
+            {
+               result = kDiagCheckVerificationFailed;
+            }
+            else
+            {
+               /* Increment programming success counter */
+               (void)ApplFblIncProgCounts(downloadBlockDescriptor);
+            }
+
+            if (ApplFblNvTransactionCommit() != kFblOk)
+            {
+               result = kDiagCheckVerificationFailed;
+            }
          }
       }
 #if defined( FBL_DIAG_ENABLE_FLASHDRV_DOWNLOAD )
@@ -1022,7 +1044,12 @@ static tFblResult FblDiagCheckRequestDownloadPreconditions(V_MEMRAM1 vuint8 V_ME
 # if defined( FBL_ENABLE_COMPRESSION_MODE )
 # else
    /* No compressed data supported */
-   else if (FblDiagGetCompressionMode(pSegmentInfo->dataFormat) != kDiagSubNoCompression)
+   else if ( (FblDiagGetCompressionMode(pSegmentInfo->dataFormat) != kDiagSubNoCompression)
+#  if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+          /* Delta patch stream handled by memory library */
+          && (kFblOk != __ApplFblMemIsDeltaDownloadRequired(pSegmentInfo->dataFormat))
+#  endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
+           )
    {
       DiagNRCRequestOutOfRange();
       result = kFblFailed;
@@ -1286,6 +1313,12 @@ static tFblResult FblDiagPrepareFirstDownloadSegment(V_MEMRAM1 tFblMemBlockInfo
       pBlockInfo->logicalLength = downloadBlockDescriptor.blockLength;
 
       pBlockInfo->readFct = (tFblMemVerifyReadFct)FblReadProm;
+
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+      /* Calculate CRC total while programming, verification only has to read back gaps between segments */
+      (void)SecM_InitCrcTotal((SecM_AddrType)downloadBlockDescriptor.blockStartAddress,
+                              (FL_ReadMemoryFctType)FblReadProm, (FL_WDTriggerFctType)FblLookForWatchdog); /* PRQA S 0313 */ /* MD_FblDiag_0313 */
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
    }
 #if defined( FBL_DIAG_ENABLE_FLASHDRV_DOWNLOAD )
    else
@@ -1361,6 +1394,10 @@ static void FblDiagSessionControlParamInit(vuint8 *pbDiagData, tCwDataLengthType
 void FblDiagOemInitPowerOn(void)
 {
    expectedSequenceCnt = 0;
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+   transferDataResponseSent = 0u;
+   transferDataDeferredNrc = kDiagErrorNone;
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
 }
 
 /***********************************************************************************************************************
@@ -2430,6 +2467,11 @@ static tFblResult FblDiagRequestDownloadMainHandler(vuint8 *pbDiagData, tCwDataL
          /* Init current sequence counter for TransferData */
          currentSequenceCnt = kDiagInitSequenceNum;
 
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+         /* No programming error pending for new segment */
+         transferDataDeferredNrc = kDiagErrorNone;
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
+
          /* Now allow reception of TransferData */
          FblDiagSetTransferDataAllowed();
          FblDiagClrTransferDataSucceeded();
@@ -2484,6 +2526,39 @@ static tFblResult FblDiagTransferDataLengthCheck(vuint8 *pbDiagData, tCwDataLeng
    return result;
 }
 
+#if defined( FBL_DIAG_ENABLE_OEM_TRANSFERDATA_FASTPATH )
+/***********************************************************************************************************************
+ *  FblDiagOemCheckTransferDataFastPath
+ **********************************************************************************************************************/
+/*! \brief       Check if a TransferData request can skip the generic service checks
+ *  \details     The request is accepted if a download is active and the request would pass the functional request
+ *               check, the length check and the sequence counter check of the main handler. Session and security
+ *               access are checked by the diagnostic core against the service table entry, pre- and post-handler
+ *               are called as for the generic path. All other requests (including retransmissions) are processed by
+ *               the generic path, which reports the matching NRC.
+ *  \param[in]   pbDiagData Pointer to the data in the diagBuffer (without SID)
+ *  \param[in]   diagReqDataLen Length of data (without SID)
+ *  \return      kFblOk: Request can be passed to the main handler directly; kFblFailed: Use generic processing
+ **********************************************************************************************************************/
+tFblResult FblDiagOemCheckTransferDataFastPath(const vuint8 *pbDiagData, tCwDataLengthType diagReqDataLen)
+{
+   tFblResult result;
+
+   result = kFblFailed;
+
+   if ( (FblDiagGetTransferDataAllowed())
+     && (!FblDiagGetFunctionalRequest())
+     && (diagReqDataLen > kDiagRqlTransferData)
+     && (diagReqDataLen <= (tTpDataType)(FBL_DIAG_RESPONSE_BUFFER_SIZE - 1u))
+     && (pbDiagData[kDiagLocFmtSubparam] == expectedSequenceCnt) )
+   {
+      result = kFblOk;
+   }
+
+   return result;
+}
+#endif /* FBL_DIAG_ENABLE_OEM_TRANSFERDATA_FASTPATH */
+
 /***********************************************************************************************************************
  *  FblDiagTransferDataMainHandler
  **********************************************************************************************************************/
@@ -2505,6 +2580,15 @@ static tFblResult FblDiagTransferDataMainHandler(vuint8 *pbDiagData, tCwDataLeng
       DiagNRCRequestSequenceError();
       result = kFblFailed;
    }
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+   /* Report programming error of a previously acknowledged request */
+   else if (transferDataDeferredNrc != kDiagErrorNone)
+   {
+      FblDiagSetError(transferDataDeferredNrc);
+      FblDiagClrTransferDataAllowed();
+      result = kFblFailed;
+   }
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
    /* Check if the requested sequence number is expected */
    else if (pbDiagData[kDiagLocFmtSubparam] != expectedSequenceCnt)
    {
@@ -2530,19 +2614,26 @@ static tFblResult FblDiagTransferDataMainHandler(vuint8 *pbDiagData, tCwDataLeng
 
       /* Indicate data to FblLib_Mem */
       FblDiagClrEraseSucceeded();
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+      transferDataResponseSent = 0u;
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
       libMemResult = FblMemRemapStatus(FblMemDataIndication(DiagBuffer, kDiagFmtDataOffset, transferDataLength));
 
       /* Caution: Depending on configuration, DiagBuffer pointer may change. */
       pbDiagData = FblDiagMemGetActiveBuffer(); /* PRQA S 3199 */ /* MD_FblDiag_319x */
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+      if (transferDataResponseSent != 0u)
+      {
+         /* Positive response has been sent by FblDiagMemPreUnblock already.
+          * A programming error is reported by the next TransferData or RequestTransferExit request. */
+         transferDataDeferredNrc = libMemResult;
+         result = kFblOk;
+      }
+      else
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
       if (libMemResult == kDiagErrorNone)
       {
-         /* Memorize current counter */
-         currentSequenceCnt = expectedSequenceCnt;
-         /* Sequence counter value of next transferData request
-          * Note: We do not rely on an implicit 8-bit caused overflow at 256, which does not happen on certain platforms */
-         expectedSequenceCnt = ((expectedSequenceCnt + 1u) & 0xFFu);
-
-         DiagProcessingDone(kDiagRslTransferData);
+         FblDiagTransferDataAccept();
          result = kFblOk;
       }
       else
@@ -2556,10 +2647,51 @@ static tFblResult FblDiagTransferDataMainHandler(vuint8 *pbDiagData, tCwDataLeng
    return result;
 }
 
+/***********************************************************************************************************************
+ *  FblDiagTransferDataAccept
+ **********************************************************************************************************************/
+/*! \brief       Advance block sequence counter and prepare positive response of TransferData
+ **********************************************************************************************************************/
+static void FblDiagTransferDataAccept(void)
+{
+   /* Memorize current counter */
+   currentSequenceCnt = expectedSequenceCnt;
+   /* Sequence counter value of next transferData request
+    * Note: We do not rely on an implicit 8-bit caused overflow at 256, which does not happen on certain platforms */
+   expectedSequenceCnt = ((expectedSequenceCnt + 1u) & 0xFFu);
+
+   DiagProcessingDone(kDiagRslTransferData);
+}
+
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+/***********************************************************************************************************************
+ *  FblDiagMemPreUnblock
+ **********************************************************************************************************************/
+/*! \brief       Send positive response of TransferData before queued data is programmed
+ *  \details     Called by FblLib_Mem when the data of the current TransferData request has been queued, but all
+ *               input buffers are in use. The response is sent before the oldest pending buffer is programmed, so the
+ *               tester can prepare the next request in parallel. The next request is not received before a free
+ *               input buffer is available, as requests are only passed to the transport layer in the idle task.
+ *  \pre         Called during processing of TransferData
+ **********************************************************************************************************************/
+void FblDiagMemPreUnblock( void )
+{
+   FblDiagTransferDataAccept();
+   FblDiagSendEarlyResponse();
+
+   transferDataResponseSent = 1u;
+}
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
+
 /***********************************************************************************************************************
  *  FblDiagReqTransferExitMainHandler
  **********************************************************************************************************************/
 /*! \brief         RequestTransferExit service function
+ *  \details       With FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE a programming error of an already acknowledged
+ *                 TransferData request is reported instead of finalizing the segment. FblMemSegmentEndIndication is
+ *                 not called in this case, equal to a failed TransferData request without early response: FblLib_Mem
+ *                 no longer accepts the segment end after a failed data indication, the download has to be
+ *                 restarted by RequestDownload.
  *  \param[in,out] pbDiagData Pointer to the data in the diagBuffer (without SID)
  *  \param[in]     diagReqDataLen Length of data (without SID)
  *  \return        kFblOk: service processed successfully (goto next state), kFblFailed: Service processing failed.
@@ -2587,9 +2719,20 @@ static tFblResult FblDiagReqTransferExitMainHandler(vuint8 *pbDiagData, tCwDataL
    {
       FblDiagClrTransferDataAllowed();
 
-      /* Finalize programming of current segment */
-      libMemResult = FblMemRemapStatus((FblMemSegmentEndIndication(&totalProgramLength)));
-      pbDiagData = FblDiagMemGetActiveBuffer(); /* PRQA S 3199 */ /* MD_FblDiag_319x */
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+      /* Report programming error of a previously acknowledged TransferData request
+       * Segment is not finalized, as after a failed TransferData request without early response */
+      if (transferDataDeferredNrc != kDiagErrorNone)
+      {
+         libMemResult = transferDataDeferredNrc;
+      }
+      else
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
+      {
+         /* Finalize programming of current segment */
+         libMemResult = FblMemRemapStatus((FblMemSegmentEndIndication(&totalProgramLength)));
+         pbDiagData = FblDiagMemGetActiveBuffer(); /* PRQA S 3199 */ /* MD_FblDiag_319x */
+      }
 
       if (libMemResult == kDiagErrorNone)
       {
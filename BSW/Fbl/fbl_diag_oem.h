@@ -70,6 +70,13 @@
 #define FBL_ENABLE_TRANSFER_VERIFICATION_CHECK
 #define FBL_ENABLE_EXCEEDED_RETRIES_REJECT
 
+/* Positive response of TransferData is sent as soon as the data is queued for pipelined programming.
+ * Programming errors are reported by the next TransferData or RequestTransferExit request. */
+#if !defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE ) && \
+    !defined( FBL_DIAG_DISABLE_TRANSFERDATA_EARLY_RESPONSE )
+# define FBL_DIAG_DISABLE_TRANSFERDATA_EARLY_RESPONSE
+#endif
+
 /* Select set of features from diagnostic core */
 #define FBL_DIAG_ENABLE_CORE_GETBLOCKFROMADDR
 #define FBL_DIAG_ENABLE_OEM_INITPOWERON
@@ -81,6 +88,14 @@
 #define FBL_DIAG_ENABLE_CORE_STAYINBOOT
 #define FBL_DIAG_ENABLE_CORE_WRITE_SECACCESSDELAY_FLAG
 
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+# define FBL_DIAG_ENABLE_CORE_EARLY_RESPONSE
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
+
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_FASTPATH )
+# define FBL_DIAG_ENABLE_OEM_TRANSFERDATA_FASTPATH
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_FASTPATH */
+
 #define FBL_DIAG_ENABLE_SERVICE_PREHANDLER
 #define FBL_DIAG_ENABLE_SERVICE_POSTHANDLER
 
@@ -413,4 +428,16 @@ V_MEMRAM0 extern V_MEMRAM1      tBlockDescriptor   V_MEMRAM2      errStatDescrip
 # error "At least one verification method must be activated."
 #endif
 
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+# if !defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+#  error "Early TransferData response requires pipelined programming."
+# endif
+/* The next request must not be passed to the transport layer while the early acknowledged data is still processed */
+# if defined( FBL_CW_ENABLE_TASK_CODE_IN_RAM ) || \
+     defined( FBL_CW_ENABLE_RECEPTION_IN_STATE_TASK ) || \
+   ( defined( FBL_ENABLE_COM_RX_INTERRUPT ) && !defined( FBL_ENABLE_CAN_RX_QUEUE ) )
+#  error "Early TransferData response requires reception of requests in the idle task."
+# endif
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
+
 #endif /* __FBL_DIAG_OEM_H__ */
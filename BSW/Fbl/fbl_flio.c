@@ -118,6 +118,14 @@ V_MEMRAM0 V_MEMRAM1 vuint8 V_MEMRAM2 flashCode[FLASH_SIZE];
 
 static tFlashParam flashParam; /**< Data structure used as interface to flash driver. */
 
+/***********************************************************************************************************************
+ *  LOCAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+
+#if defined( FLASH_ENABLE_ASYNC_API )
+static IO_ErrorType FblFlashGetAsyncResult ( void );
+#endif /* FLASH_ENABLE_ASYNC_API */
+
 /***********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  **********************************************************************************************************************/
@@ -247,7 +255,9 @@ IO_ErrorType FlashDriver_RWriteSync ( IO_MemPtrType writeBuffer, IO_SizeType wri
       FBL_FHVE3 = 0x01ul;
 
       /* Call flash driver in RAM */
+      FblMainRuntimeStart(kFblMainRuntimeFlashWrite);
       FLASH_DRIVER_WRITE(flashCode, &flashParam); /* PRQA S 3305, 0305, 0310 */ /* MD_FblWrapperFlash_3305, MD_FblWrapperFlash_0305_FlashHisAPI, MD_FblWrapperFlash_0310_FlashHisAPI */
+      FblMainRuntimeStop(kFblMainRuntimeFlashWrite);
       retVal = flashParam.errorCode;
 
       /* Disable flash write access */
@@ -284,7 +294,9 @@ IO_ErrorType FlashDriver_REraseSync ( IO_SizeType eraseLength, IO_PositionType e
    FBL_FHVE3  = 0x01ul;
 
    /* Call flash driver in RAM */
+   FblMainRuntimeStart(kFblMainRuntimeFlashErase);
    FLASH_DRIVER_ERASE(flashCode, &flashParam); /* PRQA S 3305, 0305, 0310 */ /* MD_FblWrapperFlash_3305, MD_FblWrapperFlash_0305_FlashHisAPI, MD_FblWrapperFlash_0310_FlashHisAPI */
+   FblMainRuntimeStop(kFblMainRuntimeFlashErase);
    /* Store return value from flash driver */
    retValue   = flashParam.errorCode;
 
@@ -296,6 +308,143 @@ IO_ErrorType FlashDriver_REraseSync ( IO_SizeType eraseLength, IO_PositionType e
    /* PRQA L: TAG_0303_HWaccess */
 }
 
+#if defined( FLASH_ENABLE_ASYNC_API )
+/***********************************************************************************************************************
+ *  FblFlashGetAsyncResult
+ **********************************************************************************************************************/
+/*! \brief       Evaluate result of asynchronous flash driver operation.
+ *  \details     Pending operations are reported as IO_E_PENDING. Flash write access is disabled as soon as the
+ *               operation has finished.
+ *  \return      IO_E_PENDING while operation is in progress, result of operation otherwise.
+ **********************************************************************************************************************/
+static IO_ErrorType FblFlashGetAsyncResult ( void )
+{
+   /* PRQA S 0303 TAG_0303_HWaccess */ /* MD_FblWrapperFlash_0303_HWaccess */
+   IO_ErrorType retVal;
+
+   if ((kFlashWritePending == flashParam.errorCode) || (kFlashErasePending == flashParam.errorCode))
+   {
+      retVal = IO_E_PENDING;
+   }
+   else
+   {
+      retVal = flashParam.errorCode;
+
+      /* Disable flash write access */
+      FBL_FHVE15 = 0x00ul;
+      FBL_FHVE3  = 0x00ul;
+   }
+
+   return retVal;
+   /* PRQA L: TAG_0303_HWaccess */
+}
+
+/***********************************************************************************************************************
+ *  FlashDriver_RWriteAsync
+ **********************************************************************************************************************/
+/*! \brief       Start writing data to flash memory.
+ *  \details     This function starts the write operation of the flash driver stored in RAM and returns without
+ *               waiting for completion. The write buffer has to remain unchanged until FlashDriver_RPoll reports
+ *               the end of the operation.
+ *  \pre         Flash driver is initialized, memory to be programmed is erased.
+ *  \param[in]   writeBuffer Pointer to input data buffer.
+ *  \param[in]   writeLength Data length.
+ *  \param[in]   writeAddress Write target address ( in flash memory ).
+ *  \return      IO_E_PENDING if the operation has been started, otherwise write success or error code.
+ **********************************************************************************************************************/
+IO_ErrorType FlashDriver_RWriteAsync ( IO_MemPtrType writeBuffer, IO_SizeType writeLength, IO_PositionType writeAddress )
+{
+   /* PRQA S 0303 TAG_0303_HWaccess */ /* MD_FblWrapperFlash_0303_HWaccess */
+   IO_ErrorType retVal;
+
+   /* Check alignment of write address and write length. */
+   if ((writeAddress & (FLASH_SEGMENT_SIZE - 1)) != 0x00u)
+   {
+      retVal = kFlashWriteInvalidAddr;
+   }
+   else if ((writeLength & (FLASH_SEGMENT_SIZE - 1)) != 0x00u)
+   {
+      retVal = kFlashWriteInvalidSize;
+   }
+   else
+   {
+      retVal = kFlashOk;
+   }
+
+   if ( (retVal == kFlashOk) && (writeLength > 0) )
+   {
+      /* Initialize parameters */
+      flashParam.address = (tFlashAddress)writeAddress;
+      flashParam.length = (tFlashLength)writeLength;
+      flashParam.data = (tFlashData*)writeBuffer; /* PRQA S 3305, 0310 */ /* MD_FblWrapperFlash_writeBuffer_3305, MD_FblWrapperFlash_0310_FlashHisAPI */
+
+      /* Enable flash write access */
+      FBL_FHVE15 = 0x01ul;
+      FBL_FHVE3 = 0x01ul;
+
+      /* Start write operation of flash driver in RAM */
+      FblMainRuntimeStart(kFblMainRuntimeFlashWrite);
+      FLASH_DRIVER_WRITE_START(flashCode, &flashParam); /* PRQA S 3305, 0305, 0310 */ /* MD_FblWrapperFlash_3305, MD_FblWrapperFlash_0305_FlashHisAPI, MD_FblWrapperFlash_0310_FlashHisAPI */
+      FblMainRuntimeStop(kFblMainRuntimeFlashWrite);
+      retVal = FblFlashGetAsyncResult();
+   }
+
+   return retVal;
+   /* PRQA L: TAG_0303_HWaccess */
+}
+
+/***********************************************************************************************************************
+ *  FlashDriver_REraseAsync
+ **********************************************************************************************************************/
+/*! \brief       Start erasing area in flash memory.
+ *  \details     This function starts the erase operation of the flash driver stored in RAM and returns without
+ *               waiting for completion. Completion has to be polled by FlashDriver_RPoll.
+ *  \pre         Flash driver is initialized.
+ *  \param[in]   eraseLength Length of memory to be erased. The length has to be aligned to the length
+ *               of one or more flash sectors.
+ *  \param[in]   eraseAddress Start address of erase area. The start address has to be the start
+ *               address of a logical flash sector.
+ *  \return      IO_E_PENDING if the operation has been started, otherwise erase success or error code.
+ **********************************************************************************************************************/
+IO_ErrorType FlashDriver_REraseAsync ( IO_SizeType eraseLength, IO_PositionType eraseAddress )
+{
+   /* PRQA S 0303 TAG_0303_HWaccess */ /* MD_FblWrapperFlash_0303_HWaccess */
+   flashParam.address = eraseAddress;
+   flashParam.length  = eraseLength;
+
+   /* Enable flash write access */
+   FBL_FHVE15 = 0x01ul;
+   FBL_FHVE3  = 0x01ul;
+
+   /* Start erase operation of flash driver in RAM */
+   FblMainRuntimeStart(kFblMainRuntimeFlashErase);
+   FLASH_DRIVER_ERASE_START(flashCode, &flashParam); /* PRQA S 3305, 0305, 0310 */ /* MD_FblWrapperFlash_3305, MD_FblWrapperFlash_0305_FlashHisAPI, MD_FblWrapperFlash_0310_FlashHisAPI */
+   FblMainRuntimeStop(kFblMainRuntimeFlashErase);
+
+   return FblFlashGetAsyncResult();
+   /* PRQA L: TAG_0303_HWaccess */
+}
+
+/***********************************************************************************************************************
+ *  FlashDriver_RPoll
+ **********************************************************************************************************************/
+/*! \brief       Poll pending asynchronous flash operation.
+ *  \details     Performs a single handler step of the flash driver and reports whether the operation started by
+ *               FlashDriver_RWriteAsync or FlashDriver_REraseAsync is still in progress.
+ *  \pre         Flash driver is initialized.
+ *  \return      IO_E_PENDING while operation is in progress, result of operation otherwise.
+ **********************************************************************************************************************/
+IO_ErrorType FlashDriver_RPoll ( void )
+{
+   /* Poll flash driver in RAM */
+   FblMainRuntimeStart(kFblMainRuntimeFlashPoll);
+   FLASH_DRIVER_POLL(flashCode, &flashParam); /* PRQA S 3305, 0305, 0310 */ /* MD_FblWrapperFlash_3305, MD_FblWrapperFlash_0305_FlashHisAPI, MD_FblWrapperFlash_0310_FlashHisAPI */
+   FblMainRuntimeStop(kFblMainRuntimeFlashPoll);
+
+   return FblFlashGetAsyncResult();
+}
+#endif /* FLASH_ENABLE_ASYNC_API */
+
 #if defined ( FBL_ENABLE_USR_RREAD_SYNC )
 #else
 /***********************************************************************************************************************
@@ -82,6 +82,11 @@ IO_ErrorType FlashDriver_SetResetVector ( IO_PositionType, IO_SizeType );
 IO_ErrorType FlashDriver_GetOptionByte ( IO_U32 *, IO_SizeType );
 IO_ErrorType FlashDriver_SetOptionByte ( IO_U32 *, IO_SizeType );
 # endif /* FLASH_ENABLE_OPTIONBYTE_API */
+#if defined( FLASH_ENABLE_ASYNC_API )
+IO_ErrorType FlashDriver_RWriteAsync ( IO_MemPtrType, IO_SizeType, IO_PositionType );
+IO_ErrorType FlashDriver_REraseAsync ( IO_SizeType, IO_PositionType );
+IO_ErrorType FlashDriver_RPoll ( void );
+#endif /* FLASH_ENABLE_ASYNC_API */
 
 /***********************************************************************************************************************
  *  GLOBAL DATA
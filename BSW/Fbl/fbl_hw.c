@@ -164,6 +164,14 @@
 #define kFblCanDlcShift   28u
 #endif
 
+#if defined( FBL_ENABLE_BUSTYPE_CAN )
+#  if defined( FBL_ENABLE_CAN_FD )
+/* Read mode of FblCanFdReadRxFifo */
+#   define kFblCanFdRxReadHeader    0x00u   /**< Only provide length and identifier */
+#   define kFblCanFdRxReadData      0x01u   /**< Additionally copy the data to CanRxActualData */
+#  endif /* FBL_ENABLE_CAN_FD */
+#endif /* FBL_ENABLE_BUSTYPE_CAN */
+
 /**< Requests a on a physical channel */
 #define CanLL_ModeReq_Phys(pch,mode) \
    (Can->ChCtrl[pch].CR = ((Can->ChCtrl[pch].CR & kCanModeMask) | (mode)))
@@ -207,12 +215,49 @@
 # error "Unsupported number of CAN RX identifiers."
 #endif
 
+#if defined( FBL_ENABLE_CAN_RX_QUEUE )
+# if ( (kFblCanRxQueueSize & kFblCanRxQueueMask) != 0u ) || ( kFblCanRxQueueSize < 2u )
+#  error "Error in fbl_hw.c: Size of CAN receive queue has to be a power of two."
+# endif
+# if defined( FBL_ENABLE_CAN_RX_DIRECT_ACCESS )
+#  error "Error in fbl_hw.c: CAN receive queue and direct receive FIFO access cannot be used together."
+# endif
+# if defined( FBL_ENABLE_COM_RX_INTERRUPT )
+#  error "Error in fbl_hw.c: CAN receive queue is filled by polling only."
+# endif
+#endif /* FBL_ENABLE_CAN_RX_QUEUE */
+
 #endif /* FBL_ENABLE_BUSTYPE_CAN */
 
 /***********************************************************************************************************************
  *  LOCAL DATA
  **********************************************************************************************************************/
 
+#if defined( FBL_ENABLE_BUSTYPE_CAN )
+#  if defined( FBL_ENABLE_CAN_FD )
+/** Number of data bytes of a CAN FD frame per data length code */
+V_MEMROM0 static V_MEMROM1 vuint8 V_MEMROM2 kFblCanFdDlcToLength[16u] =
+{
+   0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 12u, 16u, 20u, 24u, 32u, 48u, 64u
+};
+#  endif /* FBL_ENABLE_CAN_FD */
+
+#  if defined( FBL_ENABLE_CAN_RX_QUEUE )
+/**
+ * Software receive queue (single producer, single consumer)
+ * Entries are written by FblCanRxQueueFill and released by FblCanProcessRxMsg. Each index is only modified by one side,
+ * therefore no locks are required. Indices are free running and masked on access.
+ */
+V_MEMRAM0 static volatile V_MEMRAM1 tFblCanRxQueueEntry V_MEMRAM2 fblCanRxQueue[kFblCanRxQueueSize];
+/** Write index of receive queue, modified by producer only */
+V_MEMRAM0 static volatile V_MEMRAM1 vuintx V_MEMRAM2 fblCanRxQueueWriteIdx;
+/** Read index of receive queue, modified by consumer only */
+V_MEMRAM0 static volatile V_MEMRAM1 vuintx V_MEMRAM2 fblCanRxQueueReadIdx;
+/** Overflow counters and fill level of receive queue */
+V_MEMRAM0 static V_MEMRAM1 tFblCanRxQueueStatistics V_MEMRAM2 fblCanRxQueueStatistics;
+#  endif /* FBL_ENABLE_CAN_RX_QUEUE */
+#endif /* FBL_ENABLE_BUSTYPE_CAN */
+
 /***********************************************************************************************************************
  *  GLOBAL DATA
  **********************************************************************************************************************/
@@ -229,7 +274,7 @@ volatile tCanCellPtr Can;
 
 V_MEMRAM0 V_MEMRAM1 vuint32 V_MEMRAM2 CanRxActualId;        /* Current received ID */
 V_MEMRAM0 V_MEMRAM1 vuint8 V_MEMRAM2  CanRxActualDLC;       /* Current received DLC    */
-V_MEMRAM0 V_MEMRAM1 vuint8 V_MEMRAM2  CanRxActualData[8u];  /* Current received data   */
+V_MEMRAM0 V_MEMRAM1 vuint8 V_MEMRAM2  CanRxActualData[kFblCanMaxDataLength];  /* Current received data   */
 
 #  if defined( FBL_ENABLE_CAN_CONFIRMATION )
 static void (*confirmationFunction)(CanTransmitHandle txObject);
@@ -240,6 +285,9 @@ static void (*confirmationFunction)(CanTransmitHandle txObject);
 V_MEMROM0 V_MEMROM1 tFblCanIdTable V_MEMROM2 kFblCanIdTable =
 {
    CAN_BCFG,
+#  if defined( FBL_ENABLE_CAN_FD )
+   CAN_DCFG,
+#  endif
 
 #   if (FBL_CAN_NUMBER_OF_ID_TABLE_ENTRIES > 0)
    {
@@ -374,6 +422,35 @@ vuint16 FblGetTimerValue(void)
    /* return the free running 16-bit counter value */
    return FBL_TAUX0CNT2;
 }
+
+# if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+/***********************************************************************************************************************
+ *  FblGetRuntimeTimerValue
+ **********************************************************************************************************************/
+/*! \brief       Returns a timer value with a resolution of one tick of the 1ms timer
+ *  \details     The value is composed of the millisecond counter (timer 1) and the 1ms interval timer (timer 0).
+ *               Both count downwards. The returned value counts upwards and wraps around after
+ *               kFblHwRuntimeTimerPeriod ticks.
+ *  \pre         Timer must be running
+ *  \return      Current timer value
+ **********************************************************************************************************************/
+vuint32 FblGetRuntimeTimerValue(void)
+{
+   vuint16 msCount;
+   vuint16 tickCount;
+
+   /* Sample again if the millisecond counter changed in between */
+   do
+   {
+      msCount   = FBL_TAUX0CNT1;
+      tickCount = FBL_TAUX0CNT0;
+   }
+   while (msCount != FBL_TAUX0CNT1);
+
+   return (((vuint32)0xFFFFu - (vuint32)msCount) * ((vuint32)(FBL_TIMER_RELOAD_VALUE) + 1u))
+          + ((vuint32)(FBL_TIMER_RELOAD_VALUE) - (vuint32)tickCount);
+}
+# endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
 #endif /* V_CPU_RH850 */
 
 #define FBLHW_STOP_SEC_CODE
@@ -414,6 +491,11 @@ void FblCanInit( void )
       ;
    }
 
+#  if defined( FBL_ENABLE_CAN_FD )
+   /* Select CAN FD interface mode (only writable in global reset mode) */
+   mFdGRMCFG = kCanFdGrmCfgFdMode;
+#  endif
+
    /* Iterate physical channels to make sure all of them are in stop mode (currently in reset or stop) */
    for (canPhysChannel = 0u; canPhysChannel < kFblCanMaxPhysChannels; canPhysChannel++)
    {
@@ -469,7 +551,19 @@ void FblCanInit( void )
 #  endif
 
    /* Configure FIFO buffer depth - use 64 (RH850) / 16 (RL78) buffers per default */
+#  if defined( FBL_ENABLE_CAN_FD )
+   Can->CRFCR[0] = (vuint32)(kCanCrFifoDepth << 8u) | kCanCrFifoPayload64;
+#  else
    Can->CRFCR[0] = (vuint32)(kCanCrFifoDepth << 8u);
+#  endif
+#  if defined( FBL_ENABLE_CAN_RX_QUEUE )
+   /* Receive queue is empty */
+   fblCanRxQueueWriteIdx = 0u;
+   fblCanRxQueueReadIdx = 0u;
+   fblCanRxQueueStatistics.fifoLost = 0u;
+   fblCanRxQueueStatistics.queueFull = 0u;
+   fblCanRxQueueStatistics.maxFill = 0u;
+#  endif /* FBL_ENABLE_CAN_RX_QUEUE */
 
    /* Global operating mode and global error interrupt enable/disable */
 
@@ -483,6 +577,11 @@ void FblCanInit( void )
 
    /* Set bus-timing */
    Can->ChCtrl[canPhysChannel].BCFG = fblCanIdTable.BCFG;
+#  if defined( FBL_ENABLE_CAN_FD )
+   /* Set data phase bit-timing and CAN FD operation */
+   mFdChDCFG(canPhysChannel) = fblCanIdTable.DCFG;
+   mFdChFDCFG(canPhysChannel) = kCanFdChConfig;
+#  endif
 
    /* Set bus-off behavior */
    Can->ChCtrl[canPhysChannel].CR |= kCanHaltAtBusoff;
@@ -528,6 +627,69 @@ void FblCanParamInit( void )
 
 #   define FBLHW_START_SEC_CODE
 #   include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+#  if defined( FBL_ENABLE_CAN_FD )
+/***********************************************************************************************************************
+ *  FblCanFdLengthToDlc
+ **********************************************************************************************************************/
+/*! \brief       Convert a frame length into a CAN FD data length code
+ *  \param[in]   length Frame length in bytes (0..64)
+ *  \return      Data length code of the smallest frame which is able to hold the given number of bytes
+ **********************************************************************************************************************/
+static vuint8 FblCanFdLengthToDlc( vuint8 length )
+{
+   vuint8 dlc;
+
+   dlc = length;
+   if (length > 8u)
+   {
+      dlc = 9u;
+      while ((dlc < kCanActDlcMask) && (kFblCanFdDlcToLength[dlc] < length))
+      {
+         dlc++;
+      }
+   }
+
+   return dlc;
+}
+
+/***********************************************************************************************************************
+ *  FblCanFdReadRxFifo
+ **********************************************************************************************************************/
+/*! \brief       Copy the oldest message of the receive FIFO to the current receive message data
+ *  \details     The message is not released from the FIFO.
+ *  \pre         CAN hardware has to be initialized before call; FIFO has to hold at least one message
+ *  \param[in]   readMode kFblCanFdRxReadData: copy the message data to CanRxActualData,
+ *                        kFblCanFdRxReadHeader: only provide length and identifier
+ *  \return      Receive rule label (message handle) of the message
+ **********************************************************************************************************************/
+static vuint32 FblCanFdReadRxFifo( vuint8 readMode )
+{
+   vuint32 messageSts;
+   vuint8 messageDlc;
+   vuintx i;
+
+   messageSts = mFdRxFifo(0u).FdSts;
+   messageDlc = (vuint8)((mFdRxFifo(0u).Ptr >> kFblCanDlcShift) & ((vuint32)kCanActDlcMask));
+   if (((messageSts & kCanFdStsFdf) == 0u) && (messageDlc > 8u))
+   {
+      /* Classic CAN frame: DLC values 9..15 indicate eight data bytes */
+      messageDlc = 8u;
+   }
+
+   CanRxActualDLC = kFblCanFdDlcToLength[messageDlc];
+   if (kFblCanFdRxReadData == readMode)
+   {
+      for (i = 0u; i < CanRxActualDLC; i++)
+      {
+         CanRxActualData[i] = mFdRxFifo(0u).u.bData[i];
+      }
+   }
+   CanRxActualId = mFdRxFifo(0u).Id;
+
+   return (messageSts >> kCanFdLabelShift);
+}
+#  endif /* FBL_ENABLE_CAN_FD */
+
 /***********************************************************************************************************************
  *  FblCanTransmit
  **********************************************************************************************************************/
@@ -561,6 +723,24 @@ vuint8 FblCanTransmit( tMsgObject * tmtObject ) /* PRQA S 3673 */ /* MD_FblHw_36
 
    if (kFblCanTxOk == result)
    {
+#  if defined( FBL_ENABLE_CAN_FD )
+      vuint8 dlc;
+      vuintx i;
+
+      /* Set transmit ID */
+      mFdTxBuf(kCanFdTxMsgBuffer).Id = tmtObject->msgObject.Id;
+
+      /* Set DLC, frame length is rounded up to the next valid CAN FD frame length */
+      dlc = FblCanFdLengthToDlc(tmtObject->msgObject.DLC);
+      mFdTxBuf(kCanFdTxMsgBuffer).Ptr = (((kCanRegSize)dlc) << kFblCanDlcShift);
+      mFdTxBuf(kCanFdTxMsgBuffer).FdSts = kCanFdTxFrameFormat;
+
+      /* Copy message data */
+      for (i = 0u; i < kFblCanFdDlcToLength[dlc]; i++)
+      {
+         mFdTxBuf(kCanFdTxMsgBuffer).u.bData[i] = tmtObject->msgObject.DataFld[i];
+      }
+#  else
       /* Set transmit ID */
       mBufId(kCanTxMsgBuffer)= tmtObject->msgObject.Id;
 
@@ -576,6 +756,7 @@ vuint8 FblCanTransmit( tMsgObject * tmtObject ) /* PRQA S 3673 */ /* MD_FblHw_36
       mBufbData(kCanTxMsgBuffer,5) = tmtObject->msgObject.DataFld[5];
       mBufbData(kCanTxMsgBuffer,6) = tmtObject->msgObject.DataFld[6];
       mBufbData(kCanTxMsgBuffer,7) = tmtObject->msgObject.DataFld[7];
+#  endif /* FBL_ENABLE_CAN_FD */
 
       /* Tx request */
       Can->ChBC[kFblCanChannel].TBCR[0] |= kCanCrTxBufReq;
@@ -626,6 +807,123 @@ vuint8 FblCanMsgTransmitted( void )
 
    return result;
 }
+#  if defined( FBL_ENABLE_CAN_RX_QUEUE )
+#   define FBLHW_STOP_SEC_CODE
+#   include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+
+#   define FBLHW_RXQUEUE_START_SEC_CODE
+#   include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+/***********************************************************************************************************************
+ *  FblCanRxQueueFill
+ **********************************************************************************************************************/
+/*! \brief       Move all messages of the hardware receive FIFO to the software receive queue
+ *  \details     This function is the only producer of the receive queue. Besides FblCanReceive it is called by
+ *               FblLookForWatchdog, so the hardware FIFO is drained while flash operations are in progress as well.
+ *               Therefore the function has to be located in RAM and must not access any constant data or code
+ *               located in flash memory. The data length code is converted by the consumer.
+ *               Messages remain in the hardware FIFO while the receive queue is full.
+ *  \pre         CAN hardware has to be initialized before call
+ **********************************************************************************************************************/
+void FblCanRxQueueFill( void )
+{
+   V_MEMRAM1 volatile tFblCanRxQueueEntry V_MEMRAM2 V_MEMRAM3 * rxEntry;
+   vuintx writeIdx;
+   vuintx queueFill;
+   vuint32 messageDlc;
+   vuintx i;
+#   if defined( FBL_ENABLE_CAN_FD )
+   vuint32 messageSts;
+#   endif
+
+   /* Messages lost because the hardware FIFO was full */
+   if ((Can->CRFSR[0] & kCanSrFifoMsgLost) != 0u)
+   {
+      Can->CRFSR[0] &= FblInvert32Bit(kCanSrFifoMsgLost);
+      if (fblCanRxQueueStatistics.fifoLost < 0xFFFFu)
+      {
+         fblCanRxQueueStatistics.fifoLost++;
+      }
+   }
+
+   writeIdx = fblCanRxQueueWriteIdx;
+   while ((Can->CRFSR[0] & kCanSrFifoEmpty) == 0u)
+   {
+      queueFill = writeIdx - fblCanRxQueueReadIdx;
+      if (queueFill >= kFblCanRxQueueSize)
+      {
+         /* No free entry: keep remaining messages in hardware FIFO */
+         if (fblCanRxQueueStatistics.queueFull < 0xFFFFu)
+         {
+            fblCanRxQueueStatistics.queueFull++;
+         }
+         break;
+      }
+
+      rxEntry = &fblCanRxQueue[writeIdx & kFblCanRxQueueMask];
+
+#   if defined( FBL_ENABLE_CAN_FD )
+      messageSts = mFdRxFifo(0u).FdSts;
+      messageDlc = (mFdRxFifo(0u).Ptr >> kFblCanDlcShift) & ((vuint32)kCanActDlcMask);
+      if (((messageSts & kCanFdStsFdf) == 0u) && (messageDlc > 8u))
+      {
+         /* Classic CAN frame: DLC values 9..15 indicate eight data bytes */
+         messageDlc = 8u;
+      }
+      rxEntry->Dlc = (vuint8)messageDlc;
+      /* Length table is located in flash: copy complete payload */
+      for (i = 0u; i < kCanFdMaxDataLength; i++)
+      {
+         rxEntry->Data[i] = mFdRxFifo(0u).u.bData[i];
+      }
+      rxEntry->Id = mFdRxFifo(0u).Id;
+      rxEntry->Handle = (vuint16)((messageSts >> kCanFdLabelShift) & 0xFFFu);
+#   else
+      for (i = 0u; i < 8u; i++)
+      {
+         rxEntry->Data[i] = mBufbData(kCanFifoBufIdx,i);
+      }
+      messageDlc = mBufDlc(kCanFifoBufIdx);
+      rxEntry->Dlc = (vuint8)((messageDlc >> kFblCanDlcShift) & ((vuint32)kCanActDlcMask));
+      rxEntry->Id = mBufId(kCanFifoBufIdx);
+#    if defined( V_CPU_RH850 )
+      rxEntry->Handle = (vuint16)((messageDlc >> 16u) & 0xFFFu);
+#    endif
+#   endif /* FBL_ENABLE_CAN_FD */
+
+#if defined( FBL_ENABLE_STDID_OPTIMIZATION )
+      rxEntry->Id = rxEntry->Id & kCanStdIdMask;
+#elif defined( FBL_ENABLE_EXTID_OPTIMIZATION )
+      rxEntry->Id = rxEntry->Id & kCanExtIdMask;
+#else
+      if (CanRxActualIdType(rxEntry->Id) == kCanIdTypeExt)
+      {
+         rxEntry->Id = rxEntry->Id & kCanExtIdMask;
+      }
+      else
+      {
+         rxEntry->Id = rxEntry->Id & kCanStdIdMask;
+      }
+#endif
+
+      /* Point to next msg in fifo */
+      Can->CRFPCR[0] = kCanPcrFifoPC; 
+
+      /* Publish entry to consumer */
+      writeIdx++;
+      fblCanRxQueueWriteIdx = writeIdx;
+
+      if ((queueFill + 1u) > fblCanRxQueueStatistics.maxFill)
+      {
+         fblCanRxQueueStatistics.maxFill = (vuint16)(queueFill + 1u);
+      }
+   }
+}
+#   define FBLHW_RXQUEUE_STOP_SEC_CODE
+#   include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+
+#   define FBLHW_START_SEC_CODE
+#   include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+#  endif /* FBL_ENABLE_CAN_RX_QUEUE */
 /***********************************************************************************************************************
  *  FblCanReceive
  **********************************************************************************************************************/
@@ -637,8 +935,15 @@ vuint32 FblCanReceive( void )
 {
    vuint32 rxIndicationFlag;
 
+#  if defined( FBL_ENABLE_CAN_RX_QUEUE )
+   FblCanRxQueueFill();
+
+   /* Check if receive queue is not empty */
+   if (fblCanRxQueueReadIdx != fblCanRxQueueWriteIdx)
+#  else
    /* Check if FIFO is not empty */
    if ((Can->CRFSR[0] & kCanSrFifoEmpty) == 0u)
+#  endif /* FBL_ENABLE_CAN_RX_QUEUE */
    {
       /* Indicate message reception */
       rxIndicationFlag = 0x01u;
@@ -657,12 +962,56 @@ vuint32 FblCanReceive( void )
 /*! \brief       Processing of the Id of the received CAN messages.
  *  \details     After the type of the message is determined, the right RxCanMsg-Handle is passed to FblHandleRxMsg()
  *               Finally the receive buffer is released.
+ *               With FBL_ENABLE_CAN_RX_DIRECT_ACCESS the message data is not copied to CanRxActualData. The transport
+ *               layer copies the payload directly from the receive FIFO into the diagnostic buffer, which is the
+ *               active input buffer of FblLib_Mem during TransferData. The FIFO entry is released afterwards.
+ *               With FBL_ENABLE_CAN_RX_QUEUE all messages of the software receive queue are processed in one call.
  *  \pre         CAN hardware has to be initialized before call
  **********************************************************************************************************************/
 void FblCanProcessRxMsg( void )
 {
-   vuint32 messageDlc;
+#  if defined( FBL_ENABLE_CAN_RX_QUEUE )
+   V_MEMRAM1 volatile tFblCanRxQueueEntry V_MEMRAM2 V_MEMRAM3 * rxEntry;
+   vuintx rxQueueEnd;
 
+   FblCanRxQueueFill();
+
+   /* Process all messages which are currently stored in the receive queue */
+   rxQueueEnd = fblCanRxQueueWriteIdx;
+   while (fblCanRxQueueReadIdx != rxQueueEnd)
+   {
+      rxEntry = &fblCanRxQueue[fblCanRxQueueReadIdx & kFblCanRxQueueMask];
+#   if defined( FBL_ENABLE_CAN_FD )
+      CanRxActualDLC = kFblCanFdDlcToLength[rxEntry->Dlc];
+#   else
+      CanRxActualDLC = rxEntry->Dlc;
+#   endif /* FBL_ENABLE_CAN_FD */
+      CanRxActualId  = rxEntry->Id;
+
+      FblHandleRxMsg((vuint8)rxEntry->Handle, rxEntry->Data);
+
+      /* Release entry to producer */
+      fblCanRxQueueReadIdx++;
+   }
+#  else
+   vuint32 messageDlc;
+   pChipDataPtr rxDataPtr;
+
+#  if defined( FBL_ENABLE_CAN_FD )
+#   if defined( FBL_ENABLE_CAN_RX_DIRECT_ACCESS )
+   /* Returns the message handle, data remains in the receive FIFO */
+   messageDlc = FblCanFdReadRxFifo(kFblCanFdRxReadHeader);
+   rxDataPtr = &mFdRxFifo(0u).u.bData[0];
+#   else
+   /* Returns the message handle */
+   messageDlc = FblCanFdReadRxFifo(kFblCanFdRxReadData);
+   rxDataPtr = CanRxActualData;
+#   endif /* FBL_ENABLE_CAN_RX_DIRECT_ACCESS */
+#  else
+#   if defined( FBL_ENABLE_CAN_RX_DIRECT_ACCESS )
+   /* Data is read by the transport layer directly from the receive FIFO */
+   rxDataPtr = &mBufbData(kCanFifoBufIdx,0);
+#   else
    CanRxActualData[0] =  mBufbData(kCanFifoBufIdx,0);
    CanRxActualData[1] =  mBufbData(kCanFifoBufIdx,1);
    CanRxActualData[2] =  mBufbData(kCanFifoBufIdx,2);
@@ -671,13 +1020,19 @@ void FblCanProcessRxMsg( void )
    CanRxActualData[5] =  mBufbData(kCanFifoBufIdx,5);
    CanRxActualData[6] =  mBufbData(kCanFifoBufIdx,6);
    CanRxActualData[7] =  mBufbData(kCanFifoBufIdx,7);
+   rxDataPtr = CanRxActualData;
+#   endif /* FBL_ENABLE_CAN_RX_DIRECT_ACCESS */
 
    messageDlc = mBufDlc(kCanFifoBufIdx);
    CanRxActualDLC = (vuint8)((messageDlc >> kFblCanDlcShift) & ((vuint32)kCanActDlcMask));
    CanRxActualId  = mBufId(kCanFifoBufIdx);
+#  endif /* FBL_ENABLE_CAN_FD */
 
+#  if defined( FBL_ENABLE_CAN_RX_DIRECT_ACCESS )
+#  else
    /* Point to next msg in fifo */
    Can->CRFPCR[0] = kCanPcrFifoPC; 
+#  endif /* FBL_ENABLE_CAN_RX_DIRECT_ACCESS */
 
 #if defined( FBL_ENABLE_STDID_OPTIMIZATION )
    CanRxActualId = CanRxActualId & kCanStdIdMask;
@@ -695,10 +1050,19 @@ void FblCanProcessRxMsg( void )
 #endif
 
 #if defined( V_CPU_RH850 )
+#  if defined( FBL_ENABLE_CAN_FD )
+#  else
    messageDlc >>= 16u;
+#  endif
 #endif
    /* DLC register contains the correct message handle */
-   FblHandleRxMsg((vuint8)(messageDlc & 0xFFFu) ,CanRxActualData);
+   FblHandleRxMsg((vuint8)(messageDlc & 0xFFFu) ,rxDataPtr);
+
+#  if defined( FBL_ENABLE_CAN_RX_DIRECT_ACCESS )
+   /* Message data has been consumed: point to next msg in fifo */
+   Can->CRFPCR[0] = kCanPcrFifoPC; 
+#  endif /* FBL_ENABLE_CAN_RX_DIRECT_ACCESS */
+#  endif /* FBL_ENABLE_CAN_RX_QUEUE */
 }
 
 #   define FBLHW_STOP_SEC_CODE
@@ -716,14 +1080,63 @@ void FblCanProcessRxMsg( void )
  **********************************************************************************************************************/
 vuint8 FblCanStartMsg( void )
 {
+#   if defined( FBL_ENABLE_CAN_RX_QUEUE )
+   V_MEMRAM1 volatile tFblCanRxQueueEntry V_MEMRAM2 V_MEMRAM3 * rxEntry;
+   vuintx i;
+#   else
    vuint32 messageDlc;
+#   endif
    vuint32 messageHandle;
    vuint8 result;
 
+#   if defined( FBL_ENABLE_CAN_RX_QUEUE )
+   /* Oldest message of the receive queue (filled by FblCanReceive) */
+   rxEntry = &fblCanRxQueue[fblCanRxQueueReadIdx & kFblCanRxQueueMask];
+   messageHandle = rxEntry->Handle;
+
+   if ((CAN_RX_SLOT_STARTMSG  == messageHandle)
+#    if defined( CAN_RX_SLOT_STARTMSG2 )
+      || (CAN_RX_SLOT_STARTMSG2 == messageHandle)
+#    endif
+      )
+   {
+#   if defined( FBL_ENABLE_CAN_FD )
+      CanRxActualDLC = kFblCanFdDlcToLength[rxEntry->Dlc];
+#   else
+      CanRxActualDLC = rxEntry->Dlc;
+#   endif /* FBL_ENABLE_CAN_FD */
+      for (i = 0u; i < CanRxActualDLC; i++)
+      {
+         CanRxActualData[i] = rxEntry->Data[i];
+      }
+      CanRxActualId = rxEntry->Id;
+      fblCanRxQueueReadIdx++;
+
+      result = FblCheckOwnStartMsg(CanRxActualData);
+      if (result == kFblOk)
+      {
+         /* Discard FIFO and receive queue contents after start message has been accepted */
+         Can->CRFCR[0] &= FblInvert32Bit(kCanCrFifoEnable);
+         Can->CRFCR[0] |= kCanCrFifoEnable;
+         fblCanRxQueueReadIdx = fblCanRxQueueWriteIdx;
+      }
+   }
+   else
+   {
+      fblCanRxQueueReadIdx++;
+
+      result = kFblFailed;
+   }
+#   else
+#  if defined( FBL_ENABLE_CAN_FD )
+   messageDlc = mFdRxFifo(0u).FdSts;
+   messageHandle = (messageDlc >> kCanFdLabelShift) & 0xFFFu;
+#  else
    messageDlc = mBufDlc(kCanFifoBufIdx);
 #if defined( V_CPU_RH850 )
    messageHandle =  (messageDlc >> 16u) & 0xFFFu;
 #endif
+#  endif /* FBL_ENABLE_CAN_FD */
 
    /* Check for start message handle*/
    if ((CAN_RX_SLOT_STARTMSG  == messageHandle)
@@ -732,6 +1145,9 @@ vuint8 FblCanStartMsg( void )
 #   endif
       )
    {
+#  if defined( FBL_ENABLE_CAN_FD )
+      (void)FblCanFdReadRxFifo(kFblCanFdRxReadData);
+#  else
       CanRxActualData[0] =  mBufbData(kCanFifoBufIdx,0);
       CanRxActualData[1] =  mBufbData(kCanFifoBufIdx,1);
       CanRxActualData[2] =  mBufbData(kCanFifoBufIdx,2);
@@ -744,6 +1160,7 @@ vuint8 FblCanStartMsg( void )
       CanRxActualDLC = (vuint8)((messageDlc >> kFblCanDlcShift) & ((vuint32)kCanActDlcMask));
 
       CanRxActualId  = mBufId(kCanFifoBufIdx);
+#  endif /* FBL_ENABLE_CAN_FD */
 
       /* Point to next msg in fifo */
       Can->CRFPCR[0] = kCanPcrFifoPC; 
@@ -777,6 +1194,7 @@ vuint8 FblCanStartMsg( void )
 
       result = kFblFailed;
    }
+#   endif /* FBL_ENABLE_CAN_RX_QUEUE */
    return result;
 }
 #  endif
@@ -797,6 +1215,20 @@ void FblCanErrorTask(void)
    }
 }
 
+#  if defined( FBL_ENABLE_CAN_RX_QUEUE )
+/***********************************************************************************************************************
+ *  FblCanGetRxQueueStatistics
+ **********************************************************************************************************************/
+/*! \brief       Read overflow counters and maximum fill level of the software receive queue
+ *  \pre         CAN hardware has to be initialized before call
+ *  \param[out]  statistics Pointer to statistics structure
+ **********************************************************************************************************************/
+void FblCanGetRxQueueStatistics( V_MEMRAM1 tFblCanRxQueueStatistics V_MEMRAM2 V_MEMRAM3 * statistics )
+{
+   *statistics = fblCanRxQueueStatistics;
+}
+#  endif /* FBL_ENABLE_CAN_RX_QUEUE */
+
 #  if defined( FBL_ENABLE_SLEEPMODE )
 /***********************************************************************************************************************
  *  FblCanSleep
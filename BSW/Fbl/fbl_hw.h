@@ -197,6 +197,13 @@
 #  define kCanExtIdMask         0x1FFFFFFFul
 #  define kCanActDlcMask        0x0Fu
 
+/* Maximum payload of a CAN frame */
+#  if defined( FBL_ENABLE_CAN_FD )
+#   define kFblCanMaxDataLength  kCanFdMaxDataLength
+#  else
+#   define kFblCanMaxDataLength  8u
+#  endif
+
 /* Standard CAN driver macros */
 #  define FBL_CAN_RX_ID_MASK    kCanRuleExtMustMatch
 
@@ -290,7 +297,11 @@
 #  define kCanSrTxBufMaskTReq          0x08u
 
 #  define kCanCrFifoEnable             0x00000001u
+#  if defined( FBL_ENABLE_CAN_FD )
+#   define kCanCrFifoPayload64         0x00000070u /* RFPLS: 64 bytes payload storage per FIFO entry */
+#  endif
 #  define kCanSrFifoEmpty              0x00000001u
+#  define kCanSrFifoMsgLost            0x00000004u
 #  define kCanPcrFifoPC                0x000000FFu
 
 #  if defined( V_CPU_RH850 )
@@ -299,10 +310,21 @@
 
 #  if !defined( kCanCrFifoDepth )
 #   if defined( V_CPU_RH850 )
-#    define kCanCrFifoDepth            0x06u    /* FIFO depth of 64 messages */
+#    if defined( FBL_ENABLE_CAN_FD )
+#     define kCanCrFifoDepth           0x03u    /* FIFO depth of 16 messages (64 byte entries share the CAN RAM) */
+#    else
+#     define kCanCrFifoDepth           0x06u    /* FIFO depth of 64 messages */
+#    endif
 #   endif
 #  endif /* #if !defined( kCanCrFifoDepth ) */
 
+#  if defined( FBL_ENABLE_CAN_RX_QUEUE )
+#   if !defined( kFblCanRxQueueSize )
+#    define kFblCanRxQueueSize         32u      /* Number of entries of the software receive queue (power of two) */
+#   endif
+#   define kFblCanRxQueueMask          (kFblCanRxQueueSize - 1u)
+#  endif /* FBL_ENABLE_CAN_RX_QUEUE */
+
 #  if defined( V_CPU_RH850 )
 #   define kCanHwTxStartIndex          160u
 #  endif
@@ -311,11 +333,37 @@
 #  define kCanTxMsgBuffer              (kCanHwTxStartIndex + (16u * kFblCanChannel))
 #  endif
 
+#  if defined( FBL_ENABLE_CAN_FD )
+/* CAN FD mode: transmit buffer index within relocated transmit buffer area */
+#   define kCanFdTxMsgBuffer           (16u * kFblCanChannel)
+
+/* CAN FD frame format bits (FDSTS/FDCTR register) */
+#   define kCanFdStsEsi                0x00000001ul
+#   define kCanFdStsBrs                0x00000002ul
+#   define kCanFdStsFdf                0x00000004ul
+#   define kCanFdLabelShift            16u
+
+/* Frame format of transmitted frames */
+#   if defined( FBL_CAN_FD_ENABLE_BRS )
+#    define kCanFdTxFrameFormat        (kCanFdStsFdf | kCanFdStsBrs)
+#   else
+#    define kCanFdTxFrameFormat        kCanFdStsFdf
+#   endif
+
+/* Interface mode: CAN FD (mixed reception of classic CAN and CAN FD frames) */
+#   define kCanFdGrmCfgFdMode          0x00000001ul
+#   if !defined( kCanFdChConfig )
+#    define kCanFdChConfig             0x00000000ul /* CFDCmFDCFG: CAN FD mixed mode, no TDC */
+#   endif
+#  endif /* FBL_ENABLE_CAN_FD */
+
 #endif /* FBL_ENABLE_BUSTYPE_CAN */
 
 #if defined( V_CPU_RH850 ) 
 /* Compatibility to older tool versions */
-# if defined( FBL_USE_OWN_MEMCPY )
+# if defined( MEMCPY )
+/* Overwritten in configuration */
+# elif defined( FBL_USE_OWN_MEMCPY )
 #  define MEMCPY(dst, src, len) \
           ownmemcpy((void *)(dst), (V_MEMRAM1_FAR void V_MEMRAM2_FAR V_MEMRAM3 const *)(src), (tFblLength)(len))
 # else
@@ -330,7 +378,9 @@
 #define FblCheckBootVectTableIsValid()    (((volatile vuint32*)ApplIntJmpTable)[0u] == APPLVECT_FROM_BOOT)
 
 /* Macros for jumps */
-#define JSR(x) (*((void(*)(void))x))()   /* Jump to SubRoutine */
+#if !defined( JSR )
+# define JSR(x) (*((void(*)(void))x))()   /* Jump to SubRoutine */
+#endif
 
 #define JSR_APPL()         JSR(APPLSTART)
 #define JSR_RESET()        JSR(RESETVECT)
@@ -362,6 +412,13 @@
 #define FblTimerGet()                ((FBL_ICTAUX0I0 & 0x1000) == 0x1000u)
 #define FblTimerReset()              FBL_ICTAUX0I0 &= (vuint16)~0x1000u
 
+# if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+/** Ticks of FblGetRuntimeTimerValue per microsecond */
+#  define kFblHwRuntimeTicksPerUs     (((vuint32)(FBL_TIMER_RELOAD_VALUE) + 1u) / 1000u)
+/** FblGetRuntimeTimerValue wraps around after 0x10000 ms */
+#  define kFblHwRuntimeTimerPeriod    (((vuint32)(FBL_TIMER_RELOAD_VALUE) + 1u) * 0x10000ul)
+# endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
+
 # if defined( V_COMP_RENESAS )
 #define FblInterruptDisable()        __DI()
 #define FblInterruptEnable()         __EI()
@@ -390,6 +447,9 @@ typedef volatile unsigned char * pChipDataPtr;
 typedef struct tagFblCanIdTable
 {
    vuint32  BCFG;                           /**< Channel configuration register  */
+#  if defined( FBL_ENABLE_CAN_FD )
+   vuint32  DCFG;                           /**< Channel data bit rate configuration register */
+#  endif
 #   if ( FBL_CAN_NUMBER_OF_ID_TABLE_ENTRIES > 0 )
    vuint32 CanRxId[FBL_CAN_NUMBER_OF_ID_TABLE_ENTRIES];/**< Receive IDs for full CAN        */
    vuint32 CanRxMask[FBL_CAN_NUMBER_OF_ID_TABLE_ENTRIES];/**< Receive mask for full CAN        */
@@ -400,8 +460,8 @@ typedef struct tagFblCanIdTable
 typedef volatile struct
 {
    vuint32 Id;               /**< Complete ID                                    */
-   vuint8  DLC;              /**< Data length reg.:  X X X X DLC3 DLC2 DLC1 DLC0 */
-   vuint8  DataFld[8];       /**< Data 0 .. 7                                    */
+   vuint8  DLC;              /**< Data length reg.:  X X X X DLC3 DLC2 DLC1 DLC0 (CAN FD: length in bytes) */
+   vuint8  DataFld[kFblCanMaxDataLength]; /**< Data 0 .. 7 (CAN FD: 0 .. 63)      */
 } tInternalMsgObject;
 
 typedef volatile struct
@@ -410,6 +470,25 @@ typedef volatile struct
    void (*ConfirmationFct)(CanTransmitHandle txObject);
 } tMsgObject;
 
+#  if defined( FBL_ENABLE_CAN_RX_QUEUE )
+/** Entry of the software receive queue */
+typedef struct
+{
+   vuint32 Id;                               /**< Received identifier            */
+   vuint16 Handle;                           /**< Receive rule label (message handle) */
+   vuint8  Dlc;                              /**< Received DLC (CAN FD: data length code) */
+   vuint8  Data[kFblCanMaxDataLength];       /**< Received data                  */
+} tFblCanRxQueueEntry;
+
+/** Statistics of the software receive queue */
+typedef struct
+{
+   vuint16 fifoLost;                         /**< Number of message lost events of the hardware receive FIFO */
+   vuint16 queueFull;                        /**< Number of fill requests which found the receive queue full */
+   vuint16 maxFill;                          /**< Maximum number of entries used in the receive queue */
+} tFblCanRxQueueStatistics;
+#  endif /* FBL_ENABLE_CAN_RX_QUEUE */
+
 #endif /* FBL_ENABLE_BUSTYPE_CAN */
 
 /***********************************************************************************************************************
@@ -423,6 +502,9 @@ void FblTimerInit( void );
 #include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
 #if defined( V_CPU_RH850 )
 vuint16 FblGetTimerValue( void );
+# if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+vuint32 FblGetRuntimeTimerValue( void );
+# endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
 #endif
 #define FBLHW_STOP_SEC_CODE
 #include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
@@ -454,6 +536,15 @@ vuint8 FblCanMsgTransmitted( void );
 #   define FBLHW_STOP_SEC_CODE
 #   include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
 
+#  if defined( FBL_ENABLE_CAN_RX_QUEUE )
+#   define FBLHW_RXQUEUE_START_SEC_CODE
+#   include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+/* Move received messages from hardware FIFO to software receive queue (located in RAM) */
+void FblCanRxQueueFill( void );
+#   define FBLHW_RXQUEUE_STOP_SEC_CODE
+#   include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+#  endif /* FBL_ENABLE_CAN_RX_QUEUE */
+
 #  if defined( FBL_ENABLE_CAN_CONFIRMATION )
 /* Function to handle tx confirmation*/
 void FblCanConfirmation(void);
@@ -461,6 +552,11 @@ void FblCanConfirmation(void);
 
 void FblCanErrorTask( void );
 
+#  if defined( FBL_ENABLE_CAN_RX_QUEUE )
+/* Read statistics of the software receive queue */
+void FblCanGetRxQueueStatistics( V_MEMRAM1 tFblCanRxQueueStatistics V_MEMRAM2 V_MEMRAM3 * statistics );
+#  endif /* FBL_ENABLE_CAN_RX_QUEUE */
+
 #  if defined( FBL_ENABLE_SLEEPMODE )
 /** Function to enter sleep mode */
 vuint8 FblCanSleep( void );
@@ -501,9 +597,9 @@ V_MEMROM0 extern V_MEMROM1 vuint32 V_MEMROM2 CanRxId[FBL_NUMBER_OF_NODES];
 
 /* CAN driver interface */
 V_MEMRAM0 extern V_MEMRAM1 vuint32 V_MEMRAM2 CanRxActualId;
-/** Current received DLC */
+/** Current received DLC (CAN FD: length in bytes) */
 V_MEMRAM0 extern V_MEMRAM1 vuint8 V_MEMRAM2 CanRxActualDLC;
-V_MEMRAM0 extern V_MEMRAM1 vuint8 V_MEMRAM2 CanRxActualData[8u];
+V_MEMRAM0 extern V_MEMRAM1 vuint8 V_MEMRAM2 CanRxActualData[kFblCanMaxDataLength];
 
 V_MEMROM0 extern V_MEMROM1 tFblCanIdTable V_MEMROM2 kFblCanIdTable;
 #endif /* FBL_ENABLE_BUSTYPE_CAN */
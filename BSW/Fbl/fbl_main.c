@@ -143,6 +143,18 @@ V_MEMRAM0 static V_MEMRAM1 vuint16 V_MEMRAM2 startMessageDelay;
 # endif
 
 V_MEMRAM0 V_MEMRAM1_NEAR tFblStateBitmap V_MEMRAM2_NEAR fblMainStates[FBL_STATE_INDEX(kFblMainNumberOfStates - 1u) + 1u];
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+/** Events posted since last execution of the state tasks */
+V_MEMRAM0 V_MEMRAM1_NEAR vuint8 V_MEMRAM2_NEAR fblMainEvents;
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
+#if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+/** Runtime statistic of all measured tasks */
+V_MEMRAM0 static V_MEMRAM1 tFblMainRuntimeStatistic V_MEMRAM2 fblMainRuntimeStatistic[kFblMainRuntimeNumberOfTasks];
+/** Timer value at start of the running measurement */
+V_MEMRAM0 static V_MEMRAM1 vuint32 V_MEMRAM2 fblMainRuntimeStartTime[kFblMainRuntimeNumberOfTasks];
+/** Nesting depth of measurement. Only the outermost call of a task is measured */
+V_MEMRAM0 static V_MEMRAM1 vuint8 V_MEMRAM2 fblMainRuntimeDepth[kFblMainRuntimeNumberOfTasks];
+#endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
 
 /***********************************************************************************************************************
  *  LOCAL FUNCTION PROTOTYPES
@@ -283,6 +295,12 @@ static void FblInitPowerOn(void)
    {
       fblMainStates[i] = (tFblStateBitmap)0x00u;
    }
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+   fblMainEvents = kFblMainEventNone;
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
+#if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+   FblMainRuntimeInit();
+#endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
 # if defined( FBL_ENABLE_STAY_IN_BOOT )
    startMessageDelay = 0u;
 # endif
@@ -465,34 +483,75 @@ static void FblRepeatCheckForStartMsg( void )
 /*! \brief       This function contains the main loop of the FBL.
  *  \details     In this loop, the Bus is polled and the watchdog is triggered.
  *               This function is used by the boot procedure for the start delay and for the real operation.
+ *               With the event scheduler the state tasks are only executed if an event has been posted since the last
+ *               cycle or the diagnostic layer still has work pending. Otherwise the idle task is called.
  *  \pre         Hardware has to be initialized before.
  *  \return      The return value is used by the boot procedure to determine whether to stay in FBL or start the appl.
  **********************************************************************************************************************/
 static void FblRepeat( void )
 {
+# if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+   vuint8 pendingEvents;
+# endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
+
    /* This loop will be left only for reset */
    while (!FblMainGetFblShutdownRequest())
    {
+      FblMainRuntimeStart(kFblMainRuntimeRepeat);
+
       /* Check if 1ms hardware timer expired */
       if ((FblLookForWatchdog() & FBL_TM_TRIGGERED) == FBL_TM_TRIGGERED)
       {
          /* Run 1ms based tasks */
-          FblDiagTimerTask();
+         FblDiagTimerTask();
 
 # if defined( FBL_ENABLE_APPL_TIMER_TASK )
-            /* Call cyclic function of fbl application module (if configured) */
-            ApplFblTask();
+         /* Call cyclic function of fbl application module (if configured) */
+         ApplFblTask();
 # endif /* FBL_ENABLE_APPL_TIMER_TASK */
       }
+# if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+      /* Poll communication, reception and transmission post their events */
+      FblCwIdleTask();
+
+#  if defined( FBL_MEM_ENABLE_PIPELINING )
+      if (FblMemTaskIsPending())
+      {
+         /* Continue pipelined programming (e.g. poll completion of pending flash write) */
+         FblMainSetEvent(kFblMainEventMemory);
+      }
+#  endif /* FBL_MEM_ENABLE_PIPELINING */
+
+      pendingEvents = fblMainEvents;
+      fblMainEvents = kFblMainEventNone;
+
+      if ((pendingEvents != kFblMainEventNone) || (FblDiagIsStateTaskPending() == kFblOk))
+      {
+         /* Run non-timer relevant operations */
+         FblDiagStateTask();
+
+#  if defined( FBL_ENABLE_APPL_STATE_TASK )
+         /* Call background function of fbl application module (if configured) */
+         ApplFblStateTask();
+#  endif /* FBL_ENABLE_APPL_STATE_TASK */
+      }
+      else
+      {
+         /* Nothing to do until next event */
+         ApplFblIdleTask();
+      }
+# else
       /* Run non-timer relevant operations */
       FblDiagStateTask();
       FblCwIdleTask();
 
-# if defined( FBL_ENABLE_APPL_STATE_TASK )
+#  if defined( FBL_ENABLE_APPL_STATE_TASK )
       /* Call background function of fbl application module (if configured) */
       ApplFblStateTask();
-# endif /* FBL_ENABLE_APPL_STATE_TASK */
+#  endif /* FBL_ENABLE_APPL_STATE_TASK */
+# endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
 
+      FblMainRuntimeStop(kFblMainRuntimeRepeat);
    }
 }
 
@@ -585,6 +644,182 @@ void FblStart( void )
 #  include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
 # endif /* FBL_ENABLE_FBL_START */
 
+# if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+#  define FBL_MAIN_RUNTIME_START_SEC_CODE
+#  include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+/***********************************************************************************************************************
+ *  FblMainRuntimeInit
+ **********************************************************************************************************************/
+/*! \brief       Reset the runtime statistic of all tasks
+ **********************************************************************************************************************/
+void FblMainRuntimeInit( void )
+{
+   vuintx task;
+   vuintx histClass;
+
+   for (task = 0u; task < kFblMainRuntimeNumberOfTasks; task++)
+   {
+      fblMainRuntimeStatistic[task].count = 0u;
+      fblMainRuntimeStatistic[task].sum   = 0u;
+      fblMainRuntimeStatistic[task].min   = 0xFFFFFFFFul;
+      fblMainRuntimeStatistic[task].max   = 0u;
+
+      for (histClass = 0u; histClass < kFblMainRuntimeNumberOfClasses; histClass++)
+      {
+         fblMainRuntimeStatistic[task].classCount[histClass] = 0u;
+      }
+
+      fblMainRuntimeDepth[task] = 0u;
+   }
+}
+
+/***********************************************************************************************************************
+ *  FblMainRuntimeMeasureStart
+ **********************************************************************************************************************/
+/*! \brief       Start runtime measurement of a task
+ *  \details     Nested calls for the same task are counted, only the outermost call is measured.
+ *  \pre         Timer is initialized
+ *  \param[in]   task Measured task (kFblMainRuntime*)
+ **********************************************************************************************************************/
+void FblMainRuntimeMeasureStart( vuint8 task )
+{
+   assertFblInternal((task < kFblMainRuntimeNumberOfTasks), kFblSysAssertParameterOutOfRange); /* PRQA S 2214 */ /* MD_FblMain_2214 */
+
+   if (0u == fblMainRuntimeDepth[task])
+   {
+      fblMainRuntimeStartTime[task] = FblGetRuntimeTimerValue();
+   }
+
+   fblMainRuntimeDepth[task]++;
+}
+
+/***********************************************************************************************************************
+ *  FblMainRuntimeMeasureStop
+ **********************************************************************************************************************/
+/*! \brief       Stop runtime measurement of a task and update its statistic
+ *  \pre         FblMainRuntimeMeasureStart called for same task
+ *  \param[in]   task Measured task (kFblMainRuntime*)
+ **********************************************************************************************************************/
+void FblMainRuntimeMeasureStop( vuint8 task )
+{
+   V_MEMRAM1 tFblMainRuntimeStatistic V_MEMRAM2 V_MEMRAM3 * statistic;
+   vuint32 stopTime;
+   vuint32 duration;
+   vuint32 classLimit;
+   vuintx  histClass;
+
+   assertFblInternal((task < kFblMainRuntimeNumberOfTasks), kFblSysAssertParameterOutOfRange); /* PRQA S 2214 */ /* MD_FblMain_2214 */
+
+   if (fblMainRuntimeDepth[task] > 0u)
+   {
+      fblMainRuntimeDepth[task]--;
+
+      /* Outermost call finished */
+      if (0u == fblMainRuntimeDepth[task])
+      {
+         stopTime = FblGetRuntimeTimerValue();
+
+         /* Timer value wraps around after kFblHwRuntimeTimerPeriod ticks */
+         if (stopTime >= fblMainRuntimeStartTime[task])
+         {
+            duration = stopTime - fblMainRuntimeStartTime[task];
+         }
+         else
+         {
+            duration = (kFblHwRuntimeTimerPeriod - fblMainRuntimeStartTime[task]) + stopTime;
+         }
+         duration /= kFblHwRuntimeTicksPerUs;
+
+         statistic = &fblMainRuntimeStatistic[task];
+
+         statistic->count++;
+         if (statistic->sum <= (0xFFFFFFFFul - duration))
+         {
+            statistic->sum += duration;
+         }
+         else
+         {
+            statistic->sum = 0xFFFFFFFFul;
+         }
+         if (duration < statistic->min)
+         {
+            statistic->min = duration;
+         }
+         if (duration > statistic->max)
+         {
+            statistic->max = duration;
+         }
+
+         /* Class n covers durations below 4^(n+1) us */
+         histClass  = 0u;
+         classLimit = 4u;
+         while ((histClass < (kFblMainRuntimeNumberOfClasses - 1u)) && (duration >= classLimit))
+         {
+            histClass++;
+            classLimit <<= 2u;
+         }
+         if (statistic->classCount[histClass] < 0xFFFFu)
+         {
+            statistic->classCount[histClass]++;
+         }
+      }
+   }
+}
+
+/***********************************************************************************************************************
+ *  FblMainRuntimeDump
+ **********************************************************************************************************************/
+/*! \brief       Copy the runtime statistic of all tasks into a buffer
+ *  \details     For each task, in order of the kFblMainRuntime* indices, the following big-endian values are stored:
+ *               count (4 bytes), min, max and mean duration in us (4 bytes each), histogram class counters (2 bytes
+ *               each). Min is reported as 0 if the task has not been measured yet.
+ *  \param[out]  buffer Output buffer
+ *  \param[in]   bufferSize Size of output buffer
+ *  \return      Number of bytes written (kFblMainRuntimeDumpSize), 0 if the buffer is too small
+ **********************************************************************************************************************/
+tFblLength FblMainRuntimeDump( V_MEMRAM1 vuint8 V_MEMRAM2 V_MEMRAM3 * buffer, tFblLength bufferSize )
+{
+   const V_MEMRAM1 tFblMainRuntimeStatistic V_MEMRAM2 V_MEMRAM3 * statistic;
+   tFblLength dumpLength;
+   vuintx task;
+   vuintx histClass;
+
+   dumpLength = 0u;
+
+   if (bufferSize >= kFblMainRuntimeDumpSize)
+   {
+      for (task = 0u; task < kFblMainRuntimeNumberOfTasks; task++)
+      {
+         statistic = &fblMainRuntimeStatistic[task];
+
+         FblMemSetInteger(4u, statistic->count, &buffer[dumpLength]);
+         if (0u == statistic->count)
+         {
+            FblMemSetInteger(4u, 0u, &buffer[dumpLength + 4u]);
+            FblMemSetInteger(4u, 0u, &buffer[dumpLength + 12u]);
+         }
+         else
+         {
+            FblMemSetInteger(4u, statistic->min, &buffer[dumpLength + 4u]);
+            FblMemSetInteger(4u, (statistic->sum / statistic->count), &buffer[dumpLength + 12u]);
+         }
+         FblMemSetInteger(4u, statistic->max, &buffer[dumpLength + 8u]);
+         dumpLength += 16u;
+
+         for (histClass = 0u; histClass < kFblMainRuntimeNumberOfClasses; histClass++)
+         {
+            FblMemSetInteger(2u, statistic->classCount[histClass], &buffer[dumpLength]);
+            dumpLength += 2u;
+         }
+      }
+   }
+
+   return dumpLength;
+}
+#  define FBL_MAIN_RUNTIME_STOP_SEC_CODE
+#  include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+# endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
+
 /***********************************************************************************************************************
  *  MISRA DEVIATIONS
  **********************************************************************************************************************/
@@ -89,6 +89,49 @@
 #define FblMainClrFblShutdownRequest()          ClrFblMainState( kFblMainStateFblShutdownRequest )
 #define FblSetShutdownRequest()                 FblMainSetFblShutdownRequest()
 
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+/***********************************************************************************************************************
+ *  Main loop events
+ **********************************************************************************************************************/
+#define kFblMainEventNone                       0x00u
+#define kFblMainEventTimer                      FBL_BIT0 /**< Timer task left work for the state task (OEM or application) */
+#define kFblMainEventRx                         FBL_BIT1 /**< Diagnostic request received or reception failed */
+#define kFblMainEventTx                         FBL_BIT2 /**< Diagnostic response transmitted or transmission failed */
+#define kFblMainEventMemory                     FBL_BIT3 /**< Memory operation pending (pipelined programming) */
+
+/* PRQA S 3453 1 */ /* MD_MSR_19.7 */
+#define FblMainSetEvent(event)                  (fblMainEvents |= (vuint8)(event))  /**< Post main loop event */
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
+
+/***********************************************************************************************************************
+ *  Runtime measurement
+ **********************************************************************************************************************/
+#define kFblMainRuntimeRepeat                   0u /**< One cycle of the main loop */
+#define kFblMainRuntimeDiagStateTask            1u /**< FblDiagStateTask */
+#define kFblMainRuntimeMemTask                  2u /**< FblMemTask */
+#define kFblMainRuntimeTpTask                   3u /**< FblTpTask */
+#define kFblMainRuntimeSecMVerify               4u /**< Input and output verification routines of security module */
+#define kFblMainRuntimeFlashWrite               5u /**< Flash driver write (synchronous or start of asynchronous write) */
+#define kFblMainRuntimeFlashErase               6u /**< Flash driver erase (synchronous or start of asynchronous erase) */
+#define kFblMainRuntimeFlashPoll                7u /**< Flash driver poll of asynchronous operation */
+#define kFblMainRuntimeNumberOfTasks            8u
+
+#if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+/** Number of histogram classes per task. Class n counts durations below 4^(n+1) us, last class counts the rest */
+# define kFblMainRuntimeNumberOfClasses         8u
+/** Size of the statistic of one task in the dump: count, min, max, mean (4 bytes each) and class counters */
+# define kFblMainRuntimeRecordSize              (16u + (2u * kFblMainRuntimeNumberOfClasses))
+/** Size of the complete dump of the runtime statistic */
+# define kFblMainRuntimeDumpSize                (kFblMainRuntimeNumberOfTasks * kFblMainRuntimeRecordSize)
+
+/* PRQA S 3453 2 */ /* MD_MSR_19.7 */
+# define FblMainRuntimeStart(task)              FblMainRuntimeMeasureStart(task)   /**< Start measurement of task */
+# define FblMainRuntimeStop(task)               FblMainRuntimeMeasureStop(task)    /**< Stop measurement of task */
+#else
+# define FblMainRuntimeStart(task)
+# define FblMainRuntimeStop(task)
+#endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
+
 /***********************************************************************************************************************
  *  Initialization steps
  **********************************************************************************************************************/
@@ -220,10 +263,25 @@ typedef struct
 #endif /* FBL_ENABLE_FBL_START */
 } tFblHeader;
 
+#if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+/** Runtime statistic of one task, all durations in microseconds */
+typedef struct
+{
+   vuint32 count;                                        /**< Number of completed measurements */
+   vuint32 sum;                                          /**< Sum of all durations (saturated) */
+   vuint32 min;                                          /**< Shortest duration */
+   vuint32 max;                                          /**< Longest duration */
+   vuint16 classCount[kFblMainRuntimeNumberOfClasses];   /**< Histogram of durations (saturated) */
+} tFblMainRuntimeStatistic;
+#endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
+
 /***********************************************************************************************************************
  *  GLOBAL DATA
  **********************************************************************************************************************/
 V_MEMRAM0 extern V_MEMRAM1_NEAR tFblStateBitmap V_MEMRAM2_NEAR fblMainStates[FBL_STATE_INDEX(kFblMainNumberOfStates - 1u) + 1u];
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+V_MEMRAM0 extern V_MEMRAM1_NEAR vuint8 V_MEMRAM2_NEAR fblMainEvents;
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
 
 # define FBLHEADER_START_SEC_CONST
 # include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
@@ -259,10 +317,30 @@ void V_CALLBACK_NEAR FblStart( void );
 #  include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
 # endif /* FBL_ENABLE_FBL_START */
 
+# if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+#  define FBL_MAIN_RUNTIME_START_SEC_CODE
+#  include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+void FblMainRuntimeInit( void );
+void FblMainRuntimeMeasureStart( vuint8 task );
+void FblMainRuntimeMeasureStop( vuint8 task );
+tFblLength FblMainRuntimeDump( V_MEMRAM1 vuint8 V_MEMRAM2 V_MEMRAM3 * buffer, tFblLength bufferSize );
+#  define FBL_MAIN_RUNTIME_STOP_SEC_CODE
+#  include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+# endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
+
 /***********************************************************************************************************************
  *  CONFIGURATION CHECKS
  **********************************************************************************************************************/
 
+#if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+# if !defined( V_CPU_RH850 )
+#  error "Runtime measurement requires the timer configuration of RH850."
+# endif
+# if ((((FBL_TIMER_RELOAD_VALUE) + 1) % 1000) != 0)
+#  error "Runtime measurement requires a timer clock which is a multiple of 1MHz."
+# endif
+#endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
+
 /* Check diagnostic task call cycle */
 #if defined( kDiagCallCycle )
 # if( kDiagCallCycle != 1u )
@@ -200,7 +200,8 @@
 
 /*-- Remap configuration switches--------------------------------------------*/
 
-#if defined( FBL_ENABLE_UNALIGNED_DATA_TRANSFER )
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING ) || \
+    defined( FBL_ENABLE_UNALIGNED_DATA_TRANSFER )
 /** Input buffer changed after data indication: Store and restore preamble */
 # define FBL_MEM_ENABLE_PREAMBLE_HANDLING
 #endif /* FBL_ENABLE_PIPELINED_PROGRAMMING || FBL_ENABLE_UNALIGNED_DATA_TRANSFER */
@@ -214,12 +215,14 @@
 # endif /* FBL_MEM_SEGMENT_SIZE > 1u */
 #endif /* FBL_ENABLE_DATA_PROCESSING || FBL_ENABLE_UNALIGNED_DATA_TRANSFER */
 
-#if defined( FBL_ENABLE_ADAPTIVE_DATA_TRANSFER_RCRRP )
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING ) || \
+    defined( FBL_ENABLE_ADAPTIVE_DATA_TRANSFER_RCRRP )
 /** Split buffer operations (write, data processing, verification and pass-through) into smaller pieces */
 # define FBL_MEM_ENABLE_SEGMENTATION
 #endif /* FBL_ENABLE_PIPELINED_PROGRAMMING || FBL_ENABLE_ADAPTIVE_DATA_TRANSFER_RCRRP */
 
-#if defined( FBL_ENABLE_PROCESSED_DATA_LENGTH )
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING ) || \
+    defined( FBL_ENABLE_PROCESSED_DATA_LENGTH )
 /** Keep track of running remaining length of input data */
 #  define FBL_MEM_ENABLE_INPUT_LENGTH
 #endif /* FBL_ENABLE_PIPELINED_PROGRAMMING || FBL_ENABLE_PROCESSED_DATA_LENGTH */
@@ -230,6 +233,15 @@
 # define FBL_MEM_WRITE_SEGMENTATION    (FBL_MEM_BUFFER_SIZE + FBL_MEM_SEGMENT_SIZE)
 #endif /* FBL_MEM_WRITE_SEGMENTATION */
 
+#if defined( FLASH_ENABLE_ASYNC_API )
+/** Memory driver operations are started asynchronously and polled until completion */
+# define FBL_MEM_ENABLE_ASYNC_DRIVER
+# if defined( FBL_MEM_ENABLE_PIPELINING )
+/** Background task returns while write operation is still in progress */
+#  define FBL_MEM_ENABLE_ASYNC_WRITE
+# endif /* FBL_MEM_ENABLE_PIPELINING */
+#endif /* FLASH_ENABLE_ASYNC_API */
+
 #if defined( FBL_ENABLE_DATA_PROCESSING )
 # if defined( FBL_MEM_ENABLE_SEGMENTATION )
 #  define FBL_MEM_INTERNAL_PROC_SEGMENTATION       FBL_MEM_PROC_SEGMENTATION
@@ -251,6 +263,13 @@
 # define FBL_MEM_ENABLE_VERIFICATION
 #endif /* FBL_MEM_ENABLE_VERIFY_STREAM | FBL_MEM_ENABLE_VERIFY_OUTPUT */
 
+#if defined( FBL_MEM_ENABLE_VERIFY_OUTPUT_READ_BUFFER ) && \
+    defined( FBL_MEM_ENABLE_VERIFY_OUTPUT ) && \
+    defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+/** Input buffer not holding the verification data is idle during verification on output data */
+# define FBL_MEM_ENABLE_VERIFY_READ_BUFFER
+#endif /* FBL_MEM_ENABLE_VERIFY_OUTPUT_READ_BUFFER && FBL_MEM_ENABLE_VERIFY_OUTPUT && FBL_ENABLE_PIPELINED_PROGRAMMING */
+
 #if defined( FBL_MEM_VERIFY_SEGMENTATION )
 # if defined( FBL_MEM_VERIFY_INPUT_SEGMENTATION )
 # else
@@ -279,8 +298,12 @@
 /** Response pending handling */
 # define FBL_MEM_ENABLE_RESPONSE_PENDING
 
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+/* Input data processed in background task (FblMemTask) */
+#else
 /** Flush input data in data indication function */
 # define FBL_MEM_ENABLE_INPUT_DATA_FLUSH
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
 
 #if defined( FBL_MEM_ENABLE_GAP_FILL )
 # if defined( FBL_MEM_GAP_FILL_SEGMENTATION )
@@ -328,10 +351,68 @@
 # endif /* FBL_MEM_PROGRESS_THRESHOLD_PERCENTAGE */
 #endif /* FBL_MEM_ENABLE_PROGRESS_INFO */
 
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+# if defined( FBL_MEM_ERASED_VALUE )
+# else
+#  if defined( FBL_FLASH_DELETED )
+/** Value of erased memory as defined by flash driver */
+#   define FBL_MEM_ERASED_VALUE                    FBL_FLASH_DELETED
+#  else
+/** Default value of erased memory */
+#   define FBL_MEM_ERASED_VALUE                    0xFFu
+#  endif /* FBL_FLASH_DELETED */
+# endif /* FBL_MEM_ERASED_VALUE */
+# if defined( FBL_MEM_BLANK_CHECK_SEGMENTATION )
+# else
+/** Length of memory read back per cycle during blank check */
+#  define FBL_MEM_BLANK_CHECK_SEGMENTATION         64u
+# endif /* FBL_MEM_BLANK_CHECK_SEGMENTATION */
+# if defined( FBL_MEM_ERASED_STATE_COUNT )
+# else
+/** Number of flash blocks (from start of flash block table) for which the erased state is recorded */
+#  define FBL_MEM_ERASED_STATE_COUNT               64u
+# endif /* FBL_MEM_ERASED_STATE_COUNT */
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
+
+#if defined( FBL_ENABLE_DATA_PROCESSING )
+# if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+/*
+   Delta patch stream: sequence of records, each one starting with a header
+     Byte 0:     Opcode
+     Byte 1..2:  Length of output data produced by record (big endian, non-zero)
+     Byte 3..6:  Source address of reference data (big endian, copy record only)
+   Insert records are followed by the literal output data
+*/
+/** Copy record: output data read from currently programmed memory */
+#  define FBL_MEM_DELTA_OPCODE_COPY                0x01u
+/** Insert record: output data contained in patch stream */
+#  define FBL_MEM_DELTA_OPCODE_INSERT              0x02u
+/** Header length of insert record */
+#  define FBL_MEM_DELTA_HEADER_SIZE_INSERT         3u
+/** Header length of copy record */
+#  define FBL_MEM_DELTA_HEADER_SIZE_COPY           7u
+# else
+/** Data processing completely handled by user callback functions */
+#  define FblMemInitDataProcessing(procParam)      ApplFblInitDataProcessing(procParam)
+#  define FblMemDataProcessing(procParam)          ApplFblDataProcessing(procParam)
+#  define FblMemDeinitDataProcessing(procParam)    ApplFblDeinitDataProcessing(procParam)
+# endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
+#endif /* FBL_ENABLE_DATA_PROCESSING */
+
 /*-- Processing queue -------------------------------------------------------*/
 /* Number of input buffers */
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+# if defined( FBL_MEM_QUEUE_ENTRIES_INPUT )
+# else
+/** Pipelined programming: next buffer is received while previous ones are processed (double buffering by default) */
+#  define FBL_MEM_QUEUE_ENTRIES_INPUT              2u
+# endif /* FBL_MEM_QUEUE_ENTRIES_INPUT */
+/** Size of data structure for input queue, including free and used head */
+# define FBL_MEM_INPUT_QUEUE_SIZE                  (FBL_MEM_RESERVED_QUEUE_ENTRIES + FBL_MEM_QUEUE_ENTRIES_INPUT)
+#else
 /** Single buffer use-case */
 # define FBL_MEM_QUEUE_ENTRIES_INPUT               1u
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
 /** Actual buffer count
  *  Input queue shared amongst all input sources */
 #define FBL_MEM_BUFFER_COUNT_INPUT                 ((FBL_MEM_QUEUE_ENTRIES_INPUT + FBL_MEM_SOURCE_COUNT) - 1u)
@@ -440,8 +521,13 @@
 /** Null job pointer */
 # define FBL_MEM_JOB_NULL                       ((V_MEMRAM1 tFblMemJob V_MEMRAM2 V_MEMRAM3 *)V_NULL)
 
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+/** Fill buffer is referenced by first free entry of input queue */
+# define FblMemGetPendingInputJob()             (FblMemQueueGetFirstFreeEntry(FBL_MEM_INPUT_QUEUE).job)
+#else
 /** Remap fill buffer for single input buffer use-case */
 # define FblMemGetPendingInputJob()             (&FBL_MEM_INPUT_JOB[0])
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
 
 /*-- Verification -----------------------------------------------------------*/
 /** Null verification status pointer */
@@ -569,6 +655,10 @@
 
 /** Substitution macro to access input buffers depending on active input source */
 #define FBL_MEM_INPUT_JOB                    gInputJobs[FBL_MEM_ACTIVE_SOURCE]
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+/** Substitution macro to access input queue depending on active input source */
+# define FBL_MEM_INPUT_QUEUE                 gInputQueues[FBL_MEM_ACTIVE_SOURCE]
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
 
 /** Helper macro to get number of array entries */
 #define FBL_MEM_ARRAY_SIZE(arr)              (sizeof(arr) / sizeof((arr)[0]))
@@ -595,6 +685,31 @@
 /** Null buffer pointer */
 # define FBL_MEM_BUFFER_NULL                 ((tFblMemRamData)V_NULL)
 
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+# if defined( __ApplFblMemBlankCheck )
+# else
+/*
+   Read back only detects erased state of memories without ECC. On RH850 code flash ECC protected cells
+   programmed with the erased value also read back as erased, so a device specific blank check is required.
+   Read back has to be selected explicitly for memories where it is reliable.
+*/
+#  if defined( FBL_MEM_ENABLE_READBACK_BLANK_CHECK )
+/** Blank check by reading back memory contents */
+#   define __ApplFblMemBlankCheck(address, length)  FblMemBlankCheck((address), (length))
+#  else
+#   error "Erase blank check requires __ApplFblMemBlankCheck (device blank check) or FBL_MEM_ENABLE_READBACK_BLANK_CHECK"
+#  endif /* FBL_MEM_ENABLE_READBACK_BLANK_CHECK */
+# endif /* __ApplFblMemBlankCheck */
+
+/** Size of erased state record (one bit per flash block) */
+# define FBL_MEM_ERASED_STATE_SIZE           ((FBL_MEM_ERASED_STATE_COUNT + 7u) / 8u)
+/** Index and mask of flash block in erased state record */
+# define FBL_MEM_ERASED_STATE_INDEX(segment) ((vuintx)(segment) >> 3u)
+# define FBL_MEM_ERASED_STATE_MASK(segment)  ((vuint8)(1u << ((vuintx)(segment) & 0x07u)))
+/** Flash block covered by erased state record */
+# define FblMemHasErasedState(segment)       (((segment) >= 0) && ((vuintx)(segment) < FBL_MEM_ERASED_STATE_COUNT))
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
+
 /*-- Indication function order ----------------------------------------------*/
 /*
    Allowed indication order:
@@ -878,6 +993,48 @@ typedef struct
 } tFblMemProgressInfoInternal;
 #endif /* FBL_MEM_ENABLE_PROGRESS_INFO */
 
+/*-- Background operation ---------------------------------------------------*/
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+/** Execution context of memory operations */
+typedef enum
+{
+   kFblMemContext_Service,       /**< Called during service processing, RCR-RP may be generated */
+   kFblMemContext_Background     /**< Called from background task, no service pending */
+} tFblMemContext;
+#endif /* FBL_MEM_ENABLE_PIPELINING */
+
+#if defined( FBL_MEM_ENABLE_ASYNC_WRITE )
+/** State of write operation in progress */
+typedef struct
+{
+   tFblAddress    address;       /**< Target address of write operation */
+   tFblLength     length;        /**< Length of write operation including padding, zero if no operation in progress */
+   tFblLength     padOffset;     /**< Offset of last data byte in front of padding, relative to start of write data */
+   tFblLength     padLength;     /**< Length of padding */
+} tFblMemAsyncWriteInfo;
+#endif /* FBL_MEM_ENABLE_ASYNC_WRITE */
+
+#if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+/*-- Delta download ---------------------------------------------------------*/
+/** Decoder state of delta patch stream */
+typedef enum
+{
+   kFblMemDeltaState_Header = 0u,   /**< Collect record header */
+   kFblMemDeltaState_Copy,          /**< Read reference data from memory */
+   kFblMemDeltaState_Insert         /**< Pass literal data of patch stream */
+} tFblMemDeltaState;
+
+/** Delta patch stream decoder */
+typedef struct
+{
+   tFblAddress       sourceAddress; /**< Current address of reference data (copy record) */
+   tFblLength        remainder;     /**< Remaining output length of active record */
+   vuintx            headerLength;  /**< Number of record header bytes received so far */
+   tFblMemDeltaState state;         /**< Decoder state */
+   vuint8            header[FBL_MEM_DELTA_HEADER_SIZE_COPY];   /**< Record header */
+} tFblMemDeltaInfo;
+#endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
+
 /*-- Resumable programming --------------------------------------------------*/
 
 /*-- Error handling ---------------------------------------------------------*/
@@ -940,6 +1097,10 @@ V_MEMRAM0 static V_MEMRAM1 vuint8                  V_MEMRAM2 gPaddingBuffer[FBL_
 V_MEMRAM0 static V_MEMRAM1 tFblMemInputBuffer      V_MEMRAM2 gBasicInputBuffer[FBL_MEM_BUFFER_COUNT_INPUT];
 /** Input jobs */
 V_MEMRAM0 static V_MEMRAM1 tFblMemJob              V_MEMRAM2 gInputJobs[FBL_MEM_SOURCE_COUNT][FBL_MEM_QUEUE_ENTRIES_INPUT];
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+/** Input queues: free entries available for reception, used entries pending for processing */
+V_MEMRAM0 static V_MEMRAM1 tFblMemQueueEntry       V_MEMRAM2 gInputQueues[FBL_MEM_SOURCE_COUNT][FBL_MEM_INPUT_QUEUE_SIZE];
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
 
 #if defined( FBL_MEM_ENABLE_REMAINDER_HANDLING )
 /** Write finalization job */
@@ -964,6 +1125,12 @@ V_MEMRAM0 static V_MEMRAM1 tFblMemQueueHandle      V_MEMRAM2 gProcHandle;
 # endif /* FBL_MEM_ENABLE_PROC_SEGMENTATION */
 #endif /* FBL_ENABLE_DATA_PROCESSING */
 
+#if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+/*-- Delta download ---------------------------------------------------------*/
+/** State of delta patch stream decoder */
+V_MEMRAM0 static V_MEMRAM1 tFblMemDeltaInfo        V_MEMRAM2 gDeltaInfo;
+#endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
+
 #if defined( FBL_MEM_ENABLE_STREAM_OUTPUT )
 /*-- Stream output ----------------------------------------------------------*/
 V_MEMRAM0 static V_MEMRAM1 tFblMemStreamProcessing V_MEMRAM2 gStreamParam;
@@ -995,6 +1162,23 @@ V_MEMRAM0 static V_MEMRAM1 tFblMemProgressInfoInternal   V_MEMRAM2 gProgressInfo
 V_MEMRAM0 static V_MEMRAM1 vuint32                       V_MEMRAM2 gProgressPrevRemainder;
 #endif /* FBL_MEM_ENABLE_PROGRESS_INFO */
 
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+/*-- Erase blank check ------------------------------------------------------*/
+/** Flash blocks known to be in erased state (one bit per flash block) */
+V_MEMRAM0 static V_MEMRAM1 vuint8                  V_MEMRAM2 gErasedState[FBL_MEM_ERASED_STATE_SIZE];
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
+
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+/** Current execution context */
+V_MEMRAM0 static V_MEMRAM1 tFblMemContext          V_MEMRAM2 gMemContext;
+#endif /* FBL_MEM_ENABLE_PIPELINING */
+
+#if defined( FBL_MEM_ENABLE_ASYNC_WRITE )
+/*-- Asynchronous write -----------------------------------------------------*/
+/** Write operation started in background task, continued on next call of FblMemProgramBufferInternal */
+V_MEMRAM0 static V_MEMRAM1 tFblMemAsyncWriteInfo   V_MEMRAM2 gAsyncWriteInfo;
+#endif /* FBL_MEM_ENABLE_ASYNC_WRITE */
+
 #if defined( FBL_MEM_ENABLE_PROC_QUEUE )
 /*-- Processing queue -------------------------------------------------------*/
 /** Processing queue */
@@ -1095,6 +1279,9 @@ static void FblMemInitStates( void );
 static tFblMemRamData FblMemInitInternal( void );
 static tFblMemStatus FblMemQueueBuffer( tFblMemConstRamData buffer, tFblLength offset, tFblLength length );
 static void FblMemProcessQueue( tFblMemOperationMode mode );
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+static void FblMemUnblockQueue( void );
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
 static void FblMemFlushQueueByPrio( tFblMemQueuePrio prio );
 #if defined( FBL_MEM_ENABLE_VERIFY_STREAM )
 static tFblMemStatus FblMemVerifyInput( V_MEMRAM1 tFblMemVerifyRoutineInput V_MEMRAM2 V_MEMRAM3 * routine,
@@ -1102,6 +1289,13 @@ static tFblMemStatus FblMemVerifyInput( V_MEMRAM1 tFblMemVerifyRoutineInput V_ME
    V_MEMRAM1 tFblMemVerifyStatus V_MEMRAM2 V_MEMRAM3 * result );
 static tFblMemStatus FblMemInitVerifyInput( void );
 #endif /* FBL_MEM_ENABLE_VERIFY_STREAM */
+#if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+static tFblResult FblMemDeltaCheckSource( tFblAddress address, tFblLength length );
+static tFblResult FblMemDeltaProcessing( V_MEMRAM1 tProcParam V_MEMRAM2 V_MEMRAM3 * procParam );
+static tFblResult FblMemInitDataProcessing( V_MEMRAM1 tProcParam V_MEMRAM2 V_MEMRAM3 * procParam );
+static tFblResult FblMemDataProcessing( V_MEMRAM1 tProcParam V_MEMRAM2 V_MEMRAM3 * procParam );
+static tFblResult FblMemDeinitDataProcessing( V_MEMRAM1 tProcParam V_MEMRAM2 V_MEMRAM3 * procParam );
+#endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
 static tFblMemStatus FblMemProcessJob( V_MEMRAM1 tFblMemJob V_MEMRAM2 V_MEMRAM3 * activeJob, tFblMemOperationMode mode );
 static tFblMemStatus FblMemProgramStream( const V_MEMRAM1 tFblMemJob V_MEMRAM2 V_MEMRAM3 * programJob,
    V_MEMRAM1 tFblLength V_MEMRAM2 V_MEMRAM3 * programLength, tFblMemOperationMode mode );
@@ -1112,7 +1306,17 @@ static void FblMemUnpadBuffer( tFblMemRamData data, tFblLength padLen );
 #endif /* FBL_MEM_ENABLE_SEGMENTED_INPUT_BUFFER */
 static tFblMemStatus FblMemCopyBuffer( tFblAddress programAddress,
    const V_MEMRAM1 tFblLength V_MEMRAM2 V_MEMRAM3 * programLength, tFblMemConstRamData programData );
+#if defined( FBL_MEM_ENABLE_ASYNC_DRIVER )
+static IO_ErrorType FblMemWaitDriverResult( IO_ErrorType driverResult );
+#endif /* FBL_MEM_ENABLE_ASYNC_DRIVER */
 static tFblMemStatus FblMemEraseRegionInternal( tFblAddress eraseAddress, tFblLength eraseLength ); /* PRQA S 1505 */ /* MD_FblMem_1505 */
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+# if defined( FBL_MEM_ENABLE_READBACK_BLANK_CHECK )
+static tFblResult FblMemBlankCheck( tFblAddress address, tFblLength length );
+# endif /* FBL_MEM_ENABLE_READBACK_BLANK_CHECK */
+static tFblResult FblMemCheckErased( tFblAddress eraseAddress, tFblLength eraseLength );
+static void FblMemSetErasedState( tFblAddress eraseAddress, tFblLength eraseLength );
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
 static tFblMemStatus FblMemProgramBufferInternal( tFblAddress programAddress, /* PRQA S 1505 */ /* MD_FblMem_1505 */
    V_MEMRAM1 tFblLength V_MEMRAM2 V_MEMRAM3 * programLength, tFblMemRamData programData,
    tFblMemProgState checkPointState );
@@ -1160,6 +1364,9 @@ static tFblMemQueueHandle FblMemQueueDefaultPrioInsert( V_MEMRAM1 tFblMemQueueEn
 
 static void FblMemInitJob( V_MEMRAM1 tFblMemJob V_MEMRAM2 V_MEMRAM3 * job, tFblMemRamData buffer,
    tFblLength size, tFblMemJobType type );
+#if defined( FBL_MEM_ENABLE_VERIFY_READ_BUFFER )
+static void FblMemSetupVerifyReadBuffer( V_MEMRAM1 tFblMemVerifyParamOutput V_MEMRAM2 V_MEMRAM3 * param );
+#endif /* FBL_MEM_ENABLE_VERIFY_READ_BUFFER */
 
 #if defined( FBL_MEM_ENABLE_PROGRESS_INFO )
 vuint8 FblMemCalculateProgress( vuint32 current, vuint32 total, vuint8 percentage );
@@ -1206,6 +1413,19 @@ static tFblMemTriggerStatus FblMemTriggerWatchdogExt( void )
 {
    tFblMemTriggerStatus result;
 
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+   if (kFblMemContext_Background == gMemContext)
+   {
+# if defined( __ApplFblMemWdTrigger )
+      /* Background operation: only trigger watchdog, no RCR-RP outside of service context */
+      result = __ApplFblMemWdTrigger();
+# else
+      /* Callback not configured, return default value */
+      result = FBL_MEM_WD_TRIGGER_DEFAULT;
+# endif /* __ApplFblMemWdTrigger */
+   }
+   else
+#endif /* FBL_MEM_ENABLE_PIPELINING */
    {
 #if defined( __ApplFblMemAdaptiveRcrRp )
       /* Trigger watchdog and dynamically generate RCR-RP */
@@ -1241,6 +1461,10 @@ static void FblMemTriggerWatchdog( void )
 static void FblMemResponsePending( void )
 {
 # if defined( __ApplFblMemForcedRcrRp )
+#  if defined( FBL_MEM_ENABLE_PIPELINING )
+   /* Only force RCR-RP in service context */
+   if (kFblMemContext_Service == gMemContext)
+#  endif /* FBL_MEM_ENABLE_PIPELINING */
    {
 #  if defined( __ApplFblMemIsRcrRpActive )
       /* Do not force RCR-RP if already active */
@@ -1619,12 +1843,22 @@ static void FblMemInitInputQueue( void )
 {
    vuintx idx;
    vuintx actualBasicIdx;
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+   tFblMemQueueHandle handle;
+
+   /* Setup input queue, all entries free */
+   FblMemQueueInit(FBL_MEM_INPUT_QUEUE, FBL_MEM_ARRAY_SIZE(FBL_MEM_INPUT_QUEUE));
+   handle = FblMemQueueGetFirstFreeHandle(FBL_MEM_INPUT_QUEUE);
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
 
    /* First input buffer assigned to specified input source */
    actualBasicIdx = FBL_MEM_ACTIVE_SOURCE;
 
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+   for (idx = 0u; idx < FBL_MEM_QUEUE_ENTRIES_INPUT; idx++)
+#else
    idx = 0u;
-
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
    {
       /* Reset job information and assign actual buffers */
       FblMemInitJob( &FBL_MEM_INPUT_JOB[idx], gBasicInputBuffer[actualBasicIdx].data,
@@ -1634,8 +1868,58 @@ static void FblMemInitInputQueue( void )
       /* Default offset to align actual data to platform requirements */
       FBL_MEM_INPUT_JOB[idx].offset    = FBL_MEM_PREAMBLE_OFFSET(FBL_MEM_PREAMBLE_LENGTH);
 
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+      /* Assign job to free entry of input queue */
+      FBL_MEM_INPUT_QUEUE[handle].job = &FBL_MEM_INPUT_JOB[idx];
+      handle = FBL_MEM_INPUT_QUEUE[handle].next;
+
+      /* Remaining input buffers shared amongst all input sources, located behind source specific ones */
+      actualBasicIdx = FBL_MEM_SOURCE_COUNT + idx;
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
+   }
+}
+
+#if defined( FBL_MEM_ENABLE_VERIFY_READ_BUFFER )
+/***********************************************************************************************************************
+ *  FblMemSetupVerifyReadBuffer
+ **********************************************************************************************************************/
+/*! \brief         Pass idle input buffer to verification on output data, used for memory readback
+ *  \details       Active input buffer holds the verification data (diagnostic request) and is skipped.
+ *                 All other input buffers are idle once all data has been programmed.
+ *  \param[in,out] param Verification parameter structure
+ **********************************************************************************************************************/
+static void FblMemSetupVerifyReadBuffer( V_MEMRAM1 tFblMemVerifyParamOutput V_MEMRAM2 V_MEMRAM3 * param )
+{
+   tFblMemRamData activeBuffer;
+   tFblLength     bufferSize;
+   vuintx         idx;
+
+   /* Default: use internal buffer of verification */
+   param->readBuffer.data = SEC_DEFAULT_WORKSPACE;
+   param->readBuffer.size = 0u;
+
+   activeBuffer = FblMemGetPendingInputJob()->buffer;
+
+   for (idx = 0u; idx < FBL_MEM_ARRAY_SIZE(gBasicInputBuffer); idx++)
+   {
+      if (activeBuffer != gBasicInputBuffer[idx].data)
+      {
+         /* Buffer size limited by range of size member */
+         bufferSize = FBL_MEM_ARRAY_SIZE(gBasicInputBuffer[idx].data);
+         if (bufferSize > 0xFFFFu)
+         {
+            bufferSize = 0xFFFFu;
+         }
+
+         /* Buffer is aligned to platform requirements */
+         param->readBuffer.data = (SecM_WorkspacePtrType)gBasicInputBuffer[idx].data; /* PRQA S 0310 */ /* MD_FblMem_0310 */
+         param->readBuffer.size = (SecM_LengthType)bufferSize;
+
+         break;
+      }
    }
 }
+#endif /* FBL_MEM_ENABLE_VERIFY_READ_BUFFER */
 
 /***********************************************************************************************************************
  *  FblMemInitStates
@@ -1649,6 +1933,18 @@ static void FblMemInitStates( void )
    fblMemProgState   = kFblMemProgState_Idle;
    gErrorStatus      = kFblMemStatus_Ok;
 
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+   gMemContext          = kFblMemContext_Service;
+#endif /* FBL_MEM_ENABLE_PIPELINING */
+#if defined( FBL_MEM_ENABLE_ASYNC_WRITE )
+   if (0u != gAsyncWriteInfo.length)
+   {
+      /* Finish write operation still in progress, result no longer relevant */
+      (void)FblMemWaitDriverResult(IO_E_PENDING);
+   }
+   gAsyncWriteInfo.length = 0u;
+#endif /* FBL_MEM_ENABLE_ASYNC_WRITE */
+
    /* No operations allowed */
    FblMemResetAllowed();
 }
@@ -1928,6 +2224,35 @@ static tFblMemStatus FblMemCopyBuffer( tFblAddress programAddress,
    return kFblMemStatus_Ok;
 }
 
+#if defined( FBL_MEM_ENABLE_ASYNC_DRIVER )
+/***********************************************************************************************************************
+ *  FblMemWaitDriverResult
+ **********************************************************************************************************************/
+/*! \brief       Wait for completion of asynchronous memory driver operation
+ *  \details     Memory driver is polled until the operation is finished. Watchdog and response pending handling are
+ *               executed between two polling cycles. The loop itself is executed from ROM, which is only possible
+ *               with FLASH_ENABLE_READ_WHILE_WRITE (checked by fbl_mio).
+ *  \param[in]   driverResult Result returned by start or previous poll of the operation
+ *  \return      Final result of memory driver operation
+ **********************************************************************************************************************/
+static IO_ErrorType FblMemWaitDriverResult( IO_ErrorType driverResult )
+{
+   IO_ErrorType result;
+
+   result = driverResult;
+
+   while (IO_E_PENDING == result)
+   {
+      FblMemTriggerWatchdog();
+
+      /* Continue operation */
+      result = MemDriver_RPoll();
+   }
+
+   return result;
+}
+#endif /* FBL_MEM_ENABLE_ASYNC_DRIVER */
+
 /***********************************************************************************************************************
  *  FblMemEraseRegionInternal
  **********************************************************************************************************************/
@@ -2015,23 +2340,45 @@ static tFblMemStatus FblMemEraseRegionInternal( tFblAddress eraseAddress, tFblLe
             eraseRemainder = 0u;
          }
 
-#if defined( __ApplFblMemPreErase )
-         /* Perform actions directly before memory driver write */
-         if (kFblOk != __ApplFblMemPreErase())
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+         /* Skip erase operation if memory is already in erased state */
+         if (kFblOk == FblMemCheckErased(eraseAddress, currentLength))
          {
-            FBL_MEM_SET_STATUS(ErasePreErase, retVal); /* PRQA S 3109 */ /* MD_MSR_14.3 */
-            return retVal;
+            flashErrorCode = IO_E_OK;
          }
+         else
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
+         {
+#if defined( __ApplFblMemPreErase )
+            /* Perform actions directly before memory driver write */
+            if (kFblOk != __ApplFblMemPreErase())
+            {
+               FBL_MEM_SET_STATUS(ErasePreErase, retVal); /* PRQA S 3109 */ /* MD_MSR_14.3 */
+               return retVal;
+            }
 #endif /* __ApplFblMemPreErase */
-         flashErrorCode = MemDriver_REraseSync(currentLength, eraseAddress);
+#if defined( FBL_MEM_ENABLE_ASYNC_DRIVER )
+            /* Start erase operation and wait for completion */
+            flashErrorCode = FblMemWaitDriverResult(MemDriver_REraseAsync(currentLength, eraseAddress));
+#else
+            flashErrorCode = MemDriver_REraseSync(currentLength, eraseAddress);
+#endif /* FBL_MEM_ENABLE_ASYNC_DRIVER */
 #if defined( __ApplFblMemPostErase )
-         /* Perform actions directly after memory driver write */
-         if (kFblOk != __ApplFblMemPostErase())
-         {
-            FBL_MEM_SET_STATUS(ErasePostErase, retVal);   /* PRQA S 3109 */ /* MD_MSR_14.3 */
-            return retVal;
-         }
+            /* Perform actions directly after memory driver write */
+            if (kFblOk != __ApplFblMemPostErase())
+            {
+               FBL_MEM_SET_STATUS(ErasePostErase, retVal);   /* PRQA S 3109 */ /* MD_MSR_14.3 */
+               return retVal;
+            }
 #endif /* __ApplFblMemPostErase */
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+            if (IO_E_OK == flashErrorCode)
+            {
+               /* Remember erased state of flash block */
+               FblMemSetErasedState(eraseAddress, currentLength);
+            }
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
+         }
 
          if (IO_E_OK != flashErrorCode)
          {
@@ -2057,6 +2404,124 @@ static tFblMemStatus FblMemEraseRegionInternal( tFblAddress eraseAddress, tFblLe
    return retVal;
 }  /* PRQA S 2006 */ /* MD_MSR_14.7 */
 
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+# if defined( FBL_MEM_ENABLE_READBACK_BLANK_CHECK )
+/***********************************************************************************************************************
+ *  FblMemBlankCheck
+ **********************************************************************************************************************/
+/*! \brief      Check whether memory range is in erased state
+ *  \details    Memory contents are read back through the memory driver and compared against the erased value.
+ *              Read failures reported as IO_E_ERASED (e.g. ECC error on erased cells) are treated as erased memory.
+ *  \pre        memSegment references flash block containing given range
+ *  \param[in]  address Start address of memory range
+ *  \param[in]  length Length of memory range
+ *  \return     kFblOk if complete range is in erased state, kFblFailed otherwise
+ **********************************************************************************************************************/
+static tFblResult FblMemBlankCheck( tFblAddress address, tFblLength length )
+{
+   tFblResult     result;
+   IO_ErrorType   readResult;
+   tFblLength     currentLength;
+   vuintx         idx;
+   vuint8         readBuffer[FBL_MEM_BLANK_CHECK_SEGMENTATION];
+
+   result = kFblOk;
+
+   while ((length > 0u) && (kFblOk == result))
+   {
+      FblMemTriggerWatchdog();
+
+      currentLength = length;
+      if (currentLength > FBL_MEM_BLANK_CHECK_SEGMENTATION)
+      {
+         currentLength = FBL_MEM_BLANK_CHECK_SEGMENTATION;
+      }
+
+      readResult = MemDriver_RReadSync(readBuffer, currentLength, address);
+
+      if (IO_E_ERASED == readResult)
+      {
+         /* Memory assumed to be erased */
+      }
+      else if (IO_E_OK == readResult)
+      {
+         for (idx = 0u; idx < currentLength; idx++)
+         {
+            if (FBL_MEM_ERASED_VALUE != readBuffer[idx])
+            {
+               result = kFblFailed;
+               break;
+            }
+         }
+      }
+      else
+      {
+         /* Read failure: memory has to be erased */
+         result = kFblFailed;
+      }
+
+      address += currentLength;
+      length  -= currentLength;
+   }
+
+   return result;
+}
+# endif /* FBL_MEM_ENABLE_READBACK_BLANK_CHECK */
+
+/***********************************************************************************************************************
+ *  FblMemCheckErased
+ **********************************************************************************************************************/
+/*! \brief      Check whether erase operation of memory range can be skipped
+ *  \details    Flash blocks already recorded as erased are not checked again. Otherwise a blank check is performed
+ *              and a positive result is recorded for complete flash blocks.
+ *  \pre        memSegment references flash block containing given range
+ *  \param[in]  eraseAddress Start address of erase range
+ *  \param[in]  eraseLength Length of erase range, not exceeding current flash block
+ *  \return     kFblOk if range is already erased, kFblFailed if erase operation is required
+ **********************************************************************************************************************/
+static tFblResult FblMemCheckErased( tFblAddress eraseAddress, tFblLength eraseLength )
+{
+   tFblResult result;
+
+   if (  FblMemHasErasedState(memSegment)
+      && (0u != (gErasedState[FBL_MEM_ERASED_STATE_INDEX(memSegment)] & FBL_MEM_ERASED_STATE_MASK(memSegment))) )
+   {
+      /* Complete flash block recorded as erased */
+      result = kFblOk;
+   }
+   else
+   {
+      result = __ApplFblMemBlankCheck(eraseAddress, eraseLength);
+
+      if (kFblOk == result)
+      {
+         FblMemSetErasedState(eraseAddress, eraseLength);
+      }
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  FblMemSetErasedState
+ **********************************************************************************************************************/
+/*! \brief      Record erased state of flash block
+ *  \details    State is only recorded if given range covers the complete flash block
+ *  \pre        memSegment references flash block containing given range
+ *  \param[in]  eraseAddress Start address of erased range
+ *  \param[in]  eraseLength Length of erased range
+ **********************************************************************************************************************/
+static void FblMemSetErasedState( tFblAddress eraseAddress, tFblLength eraseLength )
+{
+   if (  FblMemHasErasedState(memSegment)
+      && (FlashBlock[memSegment].begin == eraseAddress)
+      && (((FlashBlock[memSegment].end - eraseAddress) + 1u) == eraseLength) )
+   {
+      gErasedState[FBL_MEM_ERASED_STATE_INDEX(memSegment)] |= FBL_MEM_ERASED_STATE_MASK(memSegment);
+   }
+}
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
+
 /***********************************************************************************************************************
  *  FblMemProgramBufferInternal
  **********************************************************************************************************************/
@@ -2121,6 +2586,7 @@ static tFblMemStatus FblMemProgramBufferInternal( tFblAddress programAddress, /*
 
       /* Length to be programmed in current loop cycle */
       currentLength = localLength;
+
       /* Evaluate memory segment */
       memSegment    = FblMemSegmentNrGet(programAddress);
 
@@ -2148,36 +2614,117 @@ static tFblMemStatus FblMemProgramBufferInternal( tFblAddress programAddress, /*
          return retVal;
       }
 
-      /* Remaining length until end of current segment */
-      segLength = (FlashBlock[memSegment].end - programAddress) + 1u;
-
-      /* Download memory overlaps segment: adjust to current segment */
-      if (segLength < currentLength)
+#if defined( FBL_MEM_ENABLE_ASYNC_WRITE )
+      if (0u != gAsyncWriteInfo.length)
       {
-         /* Adapt currentLength to segment programming size */
-         currentLength = segLength;
+         /* Write operation started during previous call has to be continued first */
+         assertFblInternal((programAddress == gAsyncWriteInfo.address), kFblMemAssertParameterOutOfRange); /* PRQA S 2214 */ /* MD_FblDef_Assert */
+
+         /* Buffer is already padded, restore information of operation in progress */
+         currentLength  = gAsyncWriteInfo.length;
+         padLength      = gAsyncWriteInfo.padLength;
+         padOffset      = bufferIndex + gAsyncWriteInfo.padOffset;
+
+         /* Continue programming request */
+         flashErrorCode = MemDriver_RPoll();
       }
       else
+#endif /* FBL_MEM_ENABLE_ASYNC_WRITE */
       {
-         /* Offset to last byte of actual data */
-         padOffset   = bufferIndex + (currentLength - 1u);
+         /* Remaining length until end of current segment */
+         segLength = (FlashBlock[memSegment].end - programAddress) + 1u;
 
-         /* Pad buffer to memory segment */
-         padLength = FblMemPadBuffer(programAddress, currentLength, &programData[padOffset]);
-         currentLength += padLength;
-      }
+         /* Download memory overlaps segment: adjust to current segment */
+         if (segLength < currentLength)
+         {
+            /* Adapt currentLength to segment programming size */
+            currentLength = segLength;
+         }
+         else
+         {
+            /* Offset to last byte of actual data */
+            padOffset   = bufferIndex + (currentLength - 1u);
+
+            /* Pad buffer to memory segment */
+            padLength = FblMemPadBuffer(programAddress, currentLength, &programData[padOffset]);
+            currentLength += padLength;
+         }
 
 #if defined( __ApplFblMemPreWrite )
-      /* Perform actions directly before memory driver write */
-      if (kFblOk != __ApplFblMemPreWrite())
+         /* Perform actions directly before memory driver write */
+         if (kFblOk != __ApplFblMemPreWrite())
+         {
+            FBL_MEM_SET_STATUS(ProgramPreWrite, retVal); /* PRQA S 3109 */ /* MD_MSR_14.3 */
+            return retVal;
+         }
+#endif /* __ApplFblMemPreWrite */
+
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+         /* Flash block no longer in erased state */
+         if (FblMemHasErasedState(memSegment))
+         {
+            gErasedState[FBL_MEM_ERASED_STATE_INDEX(memSegment)] &= FblInvert8Bit(FBL_MEM_ERASED_STATE_MASK(memSegment));
+         }
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
+
+         /* Pass programming request to memory driver */
+#if defined( FBL_MEM_ENABLE_ASYNC_DRIVER )
+         flashErrorCode = MemDriver_RWriteAsync(&programData[bufferIndex], currentLength, programAddress);
+#else
+         flashErrorCode = MemDriver_RWriteSync(&programData[bufferIndex], currentLength, programAddress);
+#endif /* FBL_MEM_ENABLE_ASYNC_DRIVER */
+      }
+
+#if defined( FBL_MEM_ENABLE_ASYNC_DRIVER )
+      if (IO_E_PENDING == flashErrorCode)
       {
-         FBL_MEM_SET_STATUS(ProgramPreWrite, retVal); /* PRQA S 3109 */ /* MD_MSR_14.3 */
-         return retVal;
+# if defined( FBL_MEM_ENABLE_ASYNC_WRITE )
+         if (kFblMemContext_Background == gMemContext)
+         {
+            /* Remember operation in progress, buffer contents (including padding) have to remain unchanged */
+            gAsyncWriteInfo.address    = programAddress;
+            gAsyncWriteInfo.length     = currentLength;
+            gAsyncWriteInfo.padOffset  = padOffset - bufferIndex;
+            gAsyncWriteInfo.padLength  = padLength;
+
+            /*
+               Critical section secures access to programming state
+               May also be altered in interrupt context
+            */
+            __ApplFblMemEnterCriticalSection();
+
+            /* Return from background task, operation is continued on next call (unless suspended by Rx notification) */
+            if (kFblMemProgState_Pending == fblMemProgState)
+            {
+               fblMemProgState = kFblMemProgState_Checkpoint;
+            }
+
+            __ApplFblMemLeaveCriticalSection();
+
+            /* Return length actually written, excluding data of operation in progress */
+            *programLength -= localLength;
+
+            return retVal;
+         }
+# endif /* FBL_MEM_ENABLE_ASYNC_WRITE */
+
+         /* Service context: wait for completion */
+         flashErrorCode = FblMemWaitDriverResult(flashErrorCode);
       }
-#endif /* __ApplFblMemPreWrite */
 
-      /* Pass programming request to memory driver */
-      flashErrorCode = MemDriver_RWriteSync(&programData[bufferIndex], currentLength, programAddress);
+# if defined( FBL_MEM_ENABLE_ASYNC_WRITE )
+      /* Operation finished */
+      gAsyncWriteInfo.length = 0u;
+# endif /* FBL_MEM_ENABLE_ASYNC_WRITE */
+#endif /* FBL_MEM_ENABLE_ASYNC_DRIVER */
+
+#if defined( __ApplFblMemPostProgramData )
+      if (IO_E_OK == flashErrorCode)
+      {
+         /* Pass programmed data (including padding) to application, e.g. for calculation of CRC total */
+         __ApplFblMemPostProgramData(programAddress, &programData[bufferIndex], currentLength);
+      }
+#endif /* __ApplFblMemPostProgramData */
 
 #if defined( FBL_MEM_ENABLE_SEGMENTED_INPUT_BUFFER )
       /* Restore original data, overwritten by padding */
@@ -2515,7 +3062,9 @@ static tFblMemStatus FblMemVerifyInput( V_MEMRAM1 tFblMemVerifyRoutineInput V_ME
 # endif /* FBL_MEM_ENABLE_EXT_TRIGGER_INPUT_VERIFY */
 
       /* Call verification function and set extended status */
+      FblMainRuntimeStart(kFblMainRuntimeSecMVerify);
       localResult = routine->function(routine->param);
+      FblMainRuntimeStop(kFblMainRuntimeSecMVerify);
       if (FBL_MEM_VERIFY_OK != localResult)
       {
          retVal = kFblMemStatus_Failed;
@@ -2556,6 +3105,281 @@ static tFblMemStatus FblMemInitVerifyInput( void )
 }
 #endif /* FBL_MEM_ENABLE_VERIFY_STREAM */
 
+#if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+/***********************************************************************************************************************
+ *  FblMemDeltaCheckSource
+ **********************************************************************************************************************/
+/*! \brief      Check reference data range of copy record
+ *  \details    Reference data has to be located in the flash block table and must not overlap the logical block
+ *              currently being programmed, as this area has already been erased
+ *  \pre        FblMemBlockStartIndication executed before
+ *  \param[in]  address Start address of reference data
+ *  \param[in]  length Length of reference data
+ *  \return     kFblOk if reference data may be used, kFblFailed otherwise
+ **********************************************************************************************************************/
+static tFblResult FblMemDeltaCheckSource( tFblAddress address, tFblLength length )
+{
+   tFblResult  result;
+   tFblAddress endAddress;
+
+   result      = kFblFailed;
+   endAddress  = address + (length - 1u);
+
+   /* Address overflow? */
+   if (endAddress >= address)
+   {
+      if ((FblMemSegmentNrGet(address) >= 0) && (FblMemSegmentNrGet(endAddress) >= 0))
+      {
+         /* Reference data located completely before or after current logical block? */
+         if ( (endAddress < gBlockInfo.targetAddress)
+           || (address > (gBlockInfo.targetAddress + (gBlockInfo.targetLength - 1u))) )
+         {
+            result = kFblOk;
+         }
+      }
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  FblMemDeltaProcessing
+ **********************************************************************************************************************/
+/*! \brief      Reconstruct data from delta patch stream
+ *  \details    Copy records are resolved by reading the reference data from the currently programmed memory,
+ *              insert records pass the literal data of the patch stream. Records may be split across consecutive
+ *              calls, the decoder state is kept in gDeltaInfo
+ *  \pre        FblMemInitDataProcessing executed before
+ *  \param[in,out] procParam Processing parameter data structure
+ *  \return     kFblOk if patch stream is consistent, kFblFailed otherwise
+ **********************************************************************************************************************/
+static tFblResult FblMemDeltaProcessing( V_MEMRAM1 tProcParam V_MEMRAM2 V_MEMRAM3 * procParam )
+{
+   tFblResult  result;
+   tFblLength  inputPos;
+   tFblLength  outputPos;
+   tFblLength  currentLength;
+   vsint16     oldSegment;
+
+   result      = kFblOk;
+   inputPos    = 0u;
+   outputPos   = 0u;
+
+   while (kFblOk == result)
+   {
+      if (kFblMemDeltaState_Header == gDeltaInfo.state)
+      {
+         /* Wait for further input data */
+         if (inputPos >= procParam->dataLength)
+         {
+            break;
+         }
+
+         gDeltaInfo.header[gDeltaInfo.headerLength] = procParam->dataBuffer[inputPos];
+         gDeltaInfo.headerLength++;
+         inputPos++;
+
+         if (FBL_MEM_DELTA_HEADER_SIZE_INSERT == gDeltaInfo.headerLength)
+         {
+            gDeltaInfo.remainder = (tFblLength)FblMemGetInteger(2u, &gDeltaInfo.header[1u]);
+
+            if (0u == gDeltaInfo.remainder)
+            {
+               /* Empty record not allowed */
+               result = kFblFailed;
+            }
+            else if (FBL_MEM_DELTA_OPCODE_INSERT == gDeltaInfo.header[0u])
+            {
+               gDeltaInfo.state        = kFblMemDeltaState_Insert;
+               gDeltaInfo.headerLength = 0u;
+            }
+            else if (FBL_MEM_DELTA_OPCODE_COPY == gDeltaInfo.header[0u])
+            {
+               /* Source address still pending */
+            }
+            else
+            {
+               /* Unknown opcode */
+               result = kFblFailed;
+            }
+         }
+         else if (FBL_MEM_DELTA_HEADER_SIZE_COPY == gDeltaInfo.headerLength)
+         {
+            gDeltaInfo.sourceAddress   = (tFblAddress)FblMemGetInteger(4u, &gDeltaInfo.header[3u]);
+            gDeltaInfo.state           = kFblMemDeltaState_Copy;
+            gDeltaInfo.headerLength    = 0u;
+
+            result = FblMemDeltaCheckSource(gDeltaInfo.sourceAddress, gDeltaInfo.remainder);
+         }
+         else
+         {
+            /* Header not yet complete */
+         }
+      }
+      else
+      {
+         /* Limit to remaining output buffer */
+         currentLength = gDeltaInfo.remainder;
+         if (currentLength > (tFblLength)(procParam->dataOutMaxLength - outputPos))
+         {
+            currentLength = (tFblLength)(procParam->dataOutMaxLength - outputPos);
+         }
+
+         /* Limit to available input data */
+         if (kFblMemDeltaState_Insert == gDeltaInfo.state)
+         {
+            if (currentLength > (procParam->dataLength - inputPos))
+            {
+               currentLength = procParam->dataLength - inputPos;
+            }
+         }
+
+         /* Output buffer full or input data exhausted */
+         if (0u == currentLength)
+         {
+            break;
+         }
+
+         if (kFblMemDeltaState_Insert == gDeltaInfo.state)
+         {
+            (void)MEMCPY(&procParam->dataOutBuffer[outputPos], &procParam->dataBuffer[inputPos], currentLength);
+            inputPos += currentLength;
+         }
+         else
+         {
+            FblMemTriggerWatchdog();
+
+            /* Remember current memory segment */
+            oldSegment = memSegment;
+            memSegment = FblMemSegmentNrGet(gDeltaInfo.sourceAddress);
+
+            if (memSegment < 0)
+            {
+               /* Gap in flash block table */
+               result = kFblFailed;
+            }
+            else
+            {
+               /* Do not cross flash block boundary in a single read operation */
+               if (currentLength > ((FlashBlock[memSegment].end - gDeltaInfo.sourceAddress) + 1u))
+               {
+                  currentLength = (FlashBlock[memSegment].end - gDeltaInfo.sourceAddress) + 1u;
+               }
+
+               if (IO_E_OK != MemDriver_RReadSync(&procParam->dataOutBuffer[outputPos], currentLength,
+                                                  gDeltaInfo.sourceAddress))
+               {
+                  result = kFblFailed;
+               }
+            }
+
+            /* Restore memory segment */
+            memSegment = oldSegment;
+            gDeltaInfo.sourceAddress += currentLength;
+         }
+
+         outputPos += currentLength;
+         gDeltaInfo.remainder -= currentLength;
+
+         if (0u == gDeltaInfo.remainder)
+         {
+            /* Record completed, continue with next header */
+            gDeltaInfo.state = kFblMemDeltaState_Header;
+         }
+      }
+   }
+
+   /* Report consumed and produced length */
+   procParam->dataLength      = (vuint16)inputPos;
+   procParam->dataOutLength   = (vuint16)outputPos;
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  FblMemInitDataProcessing
+ **********************************************************************************************************************/
+/*! \brief      Initialize data processing of current segment
+ *  \details    Delta patch streams are handled internally, all other data formats are passed to the user callback
+ *  \param[in,out] procParam Processing parameter data structure
+ *  \return     kFblOk/kFblFailed
+ **********************************************************************************************************************/
+static tFblResult FblMemInitDataProcessing( V_MEMRAM1 tProcParam V_MEMRAM2 V_MEMRAM3 * procParam )
+{
+   tFblResult result;
+
+   if (kFblOk == __ApplFblMemIsDeltaDownloadRequired(procParam->mode))
+   {
+      gDeltaInfo.state        = kFblMemDeltaState_Header;
+      gDeltaInfo.headerLength = 0u;
+      gDeltaInfo.remainder    = 0u;
+
+      result = kFblOk;
+   }
+   else
+   {
+      result = ApplFblInitDataProcessing(procParam);
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  FblMemDataProcessing
+ **********************************************************************************************************************/
+/*! \brief      Process data of current segment
+ *  \pre        FblMemInitDataProcessing executed before
+ *  \param[in,out] procParam Processing parameter data structure
+ *  \return     kFblOk/kFblFailed
+ **********************************************************************************************************************/
+static tFblResult FblMemDataProcessing( V_MEMRAM1 tProcParam V_MEMRAM2 V_MEMRAM3 * procParam )
+{
+   tFblResult result;
+
+   if (kFblOk == __ApplFblMemIsDeltaDownloadRequired(procParam->mode))
+   {
+      result = FblMemDeltaProcessing(procParam);
+   }
+   else
+   {
+      result = ApplFblDataProcessing(procParam);
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  FblMemDeinitDataProcessing
+ **********************************************************************************************************************/
+/*! \brief      Conclude data processing of current segment
+ *  \details    Delta patch stream has to end on a record boundary
+ *  \pre        FblMemInitDataProcessing executed before
+ *  \param[in,out] procParam Processing parameter data structure
+ *  \return     kFblOk/kFblFailed
+ **********************************************************************************************************************/
+static tFblResult FblMemDeinitDataProcessing( V_MEMRAM1 tProcParam V_MEMRAM2 V_MEMRAM3 * procParam )
+{
+   tFblResult result;
+
+   if (kFblOk == __ApplFblMemIsDeltaDownloadRequired(procParam->mode))
+   {
+      result = kFblFailed;
+
+      /* Truncated patch stream? */
+      if ((kFblMemDeltaState_Header == gDeltaInfo.state) && (0u == gDeltaInfo.headerLength))
+      {
+         result = kFblOk;
+      }
+   }
+   else
+   {
+      result = ApplFblDeinitDataProcessing(procParam);
+   }
+
+   return result;
+}
+#endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
+
 /***********************************************************************************************************************
  *  FblMemProcessJob
  **********************************************************************************************************************/
@@ -2659,7 +3483,7 @@ static tFblMemStatus FblMemProcessJob( V_MEMRAM1 tFblMemJob V_MEMRAM2 V_MEMRAM3
          gProcParam.dataOutLength   = 0u;
 
          /* Call API function for user specific data processing */
-         if (kFblOk != ApplFblDataProcessing(&gProcParam))
+         if (kFblOk != FblMemDataProcessing(&gProcParam))
          {
             FBL_MEM_SET_STATUS(DataProc, gErrorStatus);   /* PRQA S 3109 */ /* MD_MSR_14.3 */
          }
@@ -2671,7 +3495,7 @@ static tFblMemStatus FblMemProcessJob( V_MEMRAM1 tFblMemJob V_MEMRAM2 V_MEMRAM3
                {
                   /* Finalize data processing
                      gProcWriteJob already has correct values */
-                  if (kFblOk != ApplFblDeinitDataProcessing(&gProcParam))
+                  if (kFblOk != FblMemDeinitDataProcessing(&gProcParam))
                   {
                      FBL_MEM_SET_STATUS(DataProcDeinit, gErrorStatus); /* PRQA S 3109 */ /* MD_MSR_14.3 */
                   }
@@ -3025,6 +3849,12 @@ static void FblMemProcessQueue( tFblMemOperationMode mode )
    {
       /* Nothing to do */
    }
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+   else if (kFblMemContext_Background == gMemContext)
+   {
+      /* Background operation: do not override suspension requested by Rx notification */
+   }
+#endif /* FBL_MEM_ENABLE_PIPELINING */
    else
    {
       /* Operation potentially paused during previous execution cycle */
@@ -3059,6 +3889,18 @@ static void FblMemProcessQueue( tFblMemOperationMode mode )
             /* Remove buffer from processing queue */
             (void)FblMemQueueRemove(gProcessingQueue, activeHandle);
 
+# if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+            /* Input buffers are processed in order of reception
+               Release oldest pending input buffer for reception of further data */
+            if (!FblMemQueueIsEmpty(FBL_MEM_INPUT_QUEUE))
+            {
+               if (activeJob == FblMemQueueGetFirstUsedEntry(FBL_MEM_INPUT_QUEUE).job)
+               {
+                  (void)FblMemQueueRemove(FBL_MEM_INPUT_QUEUE, FblMemQueueGetFirstUsedHandle(FBL_MEM_INPUT_QUEUE));
+               }
+            }
+# endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
+
             if (FblMemQueueIsEmpty(gProcessingQueue))
 #endif /* FBL_MEM_ENABLE_PROC_QUEUE */
             {
@@ -3109,6 +3951,34 @@ static void FblMemFlushQueueByPrio( tFblMemQueuePrio prio )
    }
 }
 
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+/***********************************************************************************************************************
+ *  FblMemUnblockQueue
+ **********************************************************************************************************************/
+/*! \brief      Finish processing of oldest pending input buffer
+ *  \details    Called in case all input buffers are in use. Processing queue is executed until the oldest input
+ *              buffer is released. On error the buffer is discarded, so a fill buffer is available in any case.
+ *  \pre        FblMemQueueBuffer executed before
+ **********************************************************************************************************************/
+static void FblMemUnblockQueue( void )
+{
+   /* Loop while no input buffer is released */
+   while ( (FblMemQueueIsFull(FBL_MEM_INPUT_QUEUE))
+        && (FblMemTaskIsPending()) )
+   {
+      /* Execute processing cycle */
+      FblMemProcessQueue(kFblMemOperationMode_Finalize);
+   }
+
+   /* Processing aborted by error? */
+   if (FblMemQueueIsFull(FBL_MEM_INPUT_QUEUE))
+   {
+      /* Discard oldest pending input buffer, error is reported through error status */
+      (void)FblMemQueueRemove(FBL_MEM_INPUT_QUEUE, FblMemQueueGetFirstUsedHandle(FBL_MEM_INPUT_QUEUE));
+   }
+}
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
+
 /***********************************************************************************************************************
  *  FblMemQueueBuffer
  **********************************************************************************************************************/
@@ -3180,8 +4050,11 @@ static tFblMemStatus FblMemQueueBuffer( tFblMemConstRamData buffer, tFblLength o
          activeJob->type      = gSegInfo.jobType;
 #endif /* FBL_ENABLE_DATA_PROCESSING || FBL_MEM_ENABLE_STREAM_OUTPUT || FBL_MEM_ENABLE_PASSTHROUGH || FBL_MEM_ENABLE_REMAINDER_HANDLING */
 
-         {
-         }
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+         /* Move fill buffer to end of pending input buffers, next free entry becomes active fill buffer */
+         (void)FblMemQueuePrioUpdate(FBL_MEM_INPUT_QUEUE, FblMemQueueGetFirstFreeHandle(FBL_MEM_INPUT_QUEUE),
+            kFblMemJobPrio_Input);
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
 
 #if defined( FBL_MEM_ENABLE_PROC_QUEUE )
          {
@@ -3195,6 +4068,20 @@ static tFblMemStatus FblMemQueueBuffer( tFblMemConstRamData buffer, tFblLength o
             /* Set pending programming request flag */
             fblMemProgState = kFblMemProgState_Pending;
          }
+
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+         /* No free input buffer available for reception of further data? */
+         if (FblMemQueueIsFull(FBL_MEM_INPUT_QUEUE))
+         {
+# if defined( __ApplFblMemPreUnblock )
+            /* Input data is queued: perform actions before processing blocks the caller (e.g. early response) */
+            __ApplFblMemPreUnblock();
+# endif /* __ApplFblMemPreUnblock */
+
+            /* Finish processing of oldest pending input buffer */
+            FblMemUnblockQueue();
+         }
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
       }
 
       /* Result depending on queue processing by FblMemUnblockQueue */
@@ -3491,9 +4378,10 @@ tFblMemVerifySize FblMemProgressRead( tFblMemVerifyAddr address, tFblMemVerifyDa
  **********************************************************************************************************************/
 tFblMemRamData FblMemInitPowerOnExt( tFblLength preambleLen, tFblMemInputSource sourceHandle ) /* PRQA S 1505 */ /* MD_FblMem_1505 */
 {
-#if defined( FBL_MEM_ENABLE_GAP_FILL )
+#if defined( FBL_MEM_ENABLE_GAP_FILL ) || \
+    defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
    vuintx idx;
-#endif /* FBL_MEM_ENABLE_GAP_FILL */
+#endif /* FBL_MEM_ENABLE_GAP_FILL || FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
 
 #if defined( V_ENABLE_USE_DUMMY_STATEMENT )
    /* Parameters not used: avoid compiler warning */
@@ -3571,10 +4459,23 @@ tFblMemRamData FblMemInitPowerOnExt( tFblLength preambleLen, tFblMemInputSource
    gActiveSource = sourceHandle;
 #endif /* FBL_MEM_ENABLE_MULTI_SOURCE */
 
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+   /* Erased state of all flash blocks unknown */
+   for (idx = 0u; idx < FBL_MEM_ARRAY_SIZE(gErasedState); idx++)
+   {
+      gErasedState[idx] = 0x00u;
+   }
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
+
 #if defined( FBL_MEM_ENABLE_DYNAMIC_PREAMBLE_LENGTH )
    gPreambleLength[FBL_MEM_ACTIVE_SOURCE] = preambleLen;
 #endif /* FBL_MEM_ENABLE_DYNAMIC_PREAMBLE_LENGTH */
 
+#if defined( FBL_MEM_ENABLE_ASYNC_WRITE )
+   /* No write operation in progress */
+   gAsyncWriteInfo.length = 0u;
+#endif /* FBL_MEM_ENABLE_ASYNC_WRITE */
+
    /* Perform additional initialization and return initial buffer */
    return FblMemInitInternal();
 }
@@ -3694,7 +4595,7 @@ tFblMemStatus FblMemBlockEraseIndication( const V_MEMRAM1 tFblMemBlockInfo V_MEM
    }
    else
    {
-#if defined( FBL_MEM_ENABLE_PROGRESS_INFO )
+# if defined( FBL_MEM_ENABLE_PROGRESS_INFO )
       /* Setup erase progress */
       FblMemSetupProgress(kFblMemProgressType_Erase, block->logicalAddress, 0u,
          FBL_MEM_PROGRESS_INITIAL, FBL_MEM_PROGRESS_ERASE, block->targetLength);
@@ -3703,15 +4604,15 @@ tFblMemStatus FblMemBlockEraseIndication( const V_MEMRAM1 tFblMemBlockInfo V_MEM
 
       /* Explicitely enable progress information for erase operation */
       gProgressState = kFblMemProgressState_Enabled;
-#endif /* FBL_MEM_ENABLE_PROGRESS_INFO */
+# endif /* FBL_MEM_ENABLE_PROGRESS_INFO */
 
       /* Perform erase */
       retVal = FblMemEraseRegionInternal(block->targetAddress, block->targetLength);
 
-#if defined( FBL_MEM_ENABLE_PROGRESS_INFO )
+# if defined( FBL_MEM_ENABLE_PROGRESS_INFO )
       /* Conclude erase progress */
       FblMemConcludeProgress();
-#endif /* FBL_MEM_ENABLE_PROGRESS_INFO */
+# endif /* FBL_MEM_ENABLE_PROGRESS_INFO */
    }
 
    if (kFblMemStatus_Ok == retVal)
@@ -3949,6 +4850,10 @@ tFblMemStatus FblMemBlockVerify( const V_MEMRAM1 tFblMemBlockVerifyData V_MEMRAM
                gBlockInfo.verifyRoutineOutput.param->readMemory         = gBlockInfo.readFct;
 #endif /* FBL_MEM_ENABLE_PROGRESS_INFO*/
                gBlockInfo.verifyRoutineOutput.param->verificationData   = verifyData->verifyDataOutput.data;
+# if defined( FBL_MEM_ENABLE_VERIFY_READ_BUFFER )
+               /* Larger readback buffer reduces overhead of verification primitives */
+               FblMemSetupVerifyReadBuffer(gBlockInfo.verifyRoutineOutput.param);
+# endif /* FBL_MEM_ENABLE_VERIFY_READ_BUFFER */
 
                gBlockInfo.verifyRoutineOutput.param->blockStartAddress  = gBlockInfo.targetAddress;
 # if defined( FBL_MEM_ENABLE_VERIFY_OUTPUT_FULL_BLOCK_LENGTH )
@@ -3963,7 +4868,9 @@ tFblMemStatus FblMemBlockVerify( const V_MEMRAM1 tFblMemBlockVerifyData V_MEMRAM
 # endif /* FBL_MEM_ENABLE_VERIFY_OUTPUT_FULL_BLOCK_LENGTH */
 
                /* Call verification function */
+               FblMainRuntimeStart(kFblMainRuntimeSecMVerify);
                localResult = gBlockInfo.verifyRoutineOutput.function(gBlockInfo.verifyRoutineOutput.param);
+               FblMainRuntimeStop(kFblMainRuntimeSecMVerify);
                if (FBL_MEM_VERIFY_OK != localResult)
                {
                   FBL_MEM_SET_STATUS(BlockVerifyOutputVerify, retVal);  /* PRQA S 3109 */ /* MD_MSR_14.3 */
@@ -4086,7 +4993,7 @@ tFblMemStatus FblMemSegmentStartIndication( const V_MEMRAM1 tFblMemSegmentInfo V
             gProcParam.mode = segment->dataFormat;
 
             /* Check result */
-            if (kFblOk != ApplFblInitDataProcessing(&gProcParam))
+            if (kFblOk != FblMemInitDataProcessing(&gProcParam))
             {
                FBL_MEM_SET_STATUS(SegmentStartDataProcInit, retVal); /* PRQA S 3109 */ /* MD_MSR_14.3 */
             }
@@ -4618,14 +5525,98 @@ tFblMemStatus FblMemDataIndication( tFblMemConstRamData buffer, tFblLength offse
  *  FblMemTask
  **********************************************************************************************************************/
 /*! \brief    Perform background tasks
- *  \details  If pipelined programming is configured pending buffers are processed until the operation is suspended by
- *            a Rx notification
+ *  \details  If pipelined programming is configured a single processing cycle of the pending buffers is executed per
+ *            call (see FBL_MEM_WRITE_SEGMENTATION). The function has to be called repeatedly from the main loop while
+ *            FblMemTaskIsPending. The operation is suspended by a Rx notification.
+ *            If asynchronous memory driver operations are configured, the task returns while a write operation is
+ *            still in progress. The operation is polled again on the next call.
  *  \pre      FblMemInitPowerOn executed before
  **********************************************************************************************************************/
 void FblMemTask( void )
 {
+   FblMainRuntimeStart(kFblMainRuntimeMemTask);
+
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+   /* Operations executed outside of service context */
+   gMemContext = kFblMemContext_Background;
+#endif /* FBL_MEM_ENABLE_PIPELINING */
+
+#if defined( FBL_MEM_ENABLE_ASYNC_WRITE )
+   /* Critical section secures access to programming state */
+   __ApplFblMemEnterCriticalSection();
+
+   if (kFblMemProgState_Checkpoint == fblMemProgState)
+   {
+      /* Continue write operation still in progress */
+      fblMemProgState = kFblMemProgState_Pending;
+   }
+
+   __ApplFblMemLeaveCriticalSection();
+#endif /* FBL_MEM_ENABLE_ASYNC_WRITE */
+
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+   /*
+      Execute a single processing cycle of pending input buffers, limited to configured segmentation
+      Return to the caller afterwards, so reception polled by the main loop may proceed in between
+   */
+   if (kFblMemProgState_Pending == fblMemProgState)
+   {
+      FblMemProcessQueue(kFblMemOperationMode_Normal);
+   }
+
+   /*
+      Critical section secures access to programming state
+      May also be altered in interrupt context
+   */
+   __ApplFblMemEnterCriticalSection();
+
+   if (kFblMemProgState_SuspendPending == fblMemProgState)
+   {
+      /* Pause operation until resume indication */
+      fblMemProgState = kFblMemProgState_Suspended;
+   }
+
+   __ApplFblMemLeaveCriticalSection();
+#endif /* FBL_MEM_ENABLE_PIPELINING */
+
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+   gMemContext = kFblMemContext_Service;
+#endif /* FBL_MEM_ENABLE_PIPELINING */
+
+   FblMainRuntimeStop(kFblMainRuntimeMemTask);
 }
 
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+/***********************************************************************************************************************
+ *  FblMemRxNotification
+ **********************************************************************************************************************/
+/*! \brief    Notify reception of a new request
+ *  \details  Pending operation in background task is suspended after the current processing cycle, so the request can
+ *            be handled without delay. Operation is continued by FblMemResumeIndication.
+ *  \pre      FblMemInitPowerOn executed before
+ **********************************************************************************************************************/
+void FblMemRxNotification( void )
+{
+   /*
+      Critical section secures access to programming state
+      May also be altered in interrupt context
+   */
+   __ApplFblMemEnterCriticalSection();
+
+   /*
+      Operation active?
+      Condition equals ((kFblMemProgState_Pending == fblMemProgState) || (kFblMemProgState_Checkpoint == fblMemProgState))
+   */
+   if (fblMemProgState > kFblMemProgState_SuspendPending)
+   {
+      /* Suspend operation after current processing cycle */
+      fblMemProgState = kFblMemProgState_SuspendPending;
+   }
+
+   __ApplFblMemLeaveCriticalSection();
+}
+#endif /* FBL_MEM_ENABLE_PIPELINING */
+
 /***********************************************************************************************************************
  *  FblMemFlushInputData
  **********************************************************************************************************************/
@@ -4653,6 +5644,25 @@ void FblMemFlushInputData( void )
  **********************************************************************************************************************/
 void FblMemResumeIndication( void )
 {
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+   /*
+      Critical section secures access to programming state
+      May also be altered in interrupt context
+   */
+   __ApplFblMemEnterCriticalSection();
+
+   /*
+      Operation suspended?
+      Condition equals ((kFblMemProgState_Suspended == fblMemProgState) || (kFblMemProgState_SuspendPending == fblMemProgState))
+   */
+   if ( (fblMemProgState >= kFblMemProgState_Suspended) && (fblMemProgState <= kFblMemProgState_SuspendPending) )
+   {
+      /* Continue operation in next background task cycle */
+      fblMemProgState = kFblMemProgState_Pending;
+   }
+
+   __ApplFblMemLeaveCriticalSection();
+#endif /* FBL_MEM_ENABLE_PIPELINING */
 }
 
 # define FBLLIB_MEM_RAMCODE_STOP_SEC_CODE
@@ -4721,6 +5731,43 @@ tFblMemStatus FblMemProgramBuffer( tFblAddress programAddress, /* PRQA S 1505 */
    return retVal;
 }
 
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+/***********************************************************************************************************************
+ *  FblMemDiscardErasedState
+ **********************************************************************************************************************/
+/*! \brief      Discard recorded erased state of all flash blocks overlapping given range
+ *  \details    Has to be called before memory is written directly through the memory driver (e.g. presence pattern),
+ *              otherwise a subsequent erase operation of the affected flash blocks may be skipped
+ *  \param[in]  address Start address of written range
+ *  \param[in]  length Length of written range
+ **********************************************************************************************************************/
+void FblMemDiscardErasedState( tFblAddress address, tFblLength length )
+{
+   vsint16 segment;
+
+   if (length > 0u)
+   {
+      segment = FblMemSegmentNrGet(address);
+
+      /* Loop all flash blocks up to end of range */
+      while (FblMemHasErasedState(segment) && (segment < (vsint16)kNrOfFlashBlock))
+      {
+         gErasedState[FBL_MEM_ERASED_STATE_INDEX(segment)] &= FblInvert8Bit(FBL_MEM_ERASED_STATE_MASK(segment));
+
+         if (FlashBlock[segment].end >= (address + (length - 1u)))
+         {
+            /* End of range reached */
+            segment = -1;
+         }
+         else
+         {
+            segment++;
+         }
+      }
+   }
+}
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
+
 /***********************************************************************************************************************
  *  FblMemSetInteger
  **********************************************************************************************************************/
@@ -232,6 +232,11 @@
 
 /*-- Remap configuration switches--------------------------------------------*/
 
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+/** Operations continued in background task, suspended on reception of new request */
+# define FBL_MEM_ENABLE_PIPELINING
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
+
 #if defined( FBL_MEM_ENABLE_VERIFY_OUTPUT ) || \
     defined( FBL_MEM_ENABLE_GAP_FILL )
 # if defined( FBL_MEM_ENABLE_SEGMENT_HANDLING ) || \
@@ -250,7 +255,8 @@
     defined( FBL_ENABLE_PROCESSED_DATA_LENGTH ) || \
     defined( FBL_MEM_ENABLE_STREAM_OUTPUT )     || \
     defined( FBL_MEM_ENABLE_GAP_FILL )          || \
-    defined( FBL_MEM_ENABLE_PROGRESS_INFO )
+    defined( FBL_MEM_ENABLE_PROGRESS_INFO )     || \
+    defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
 /** Persistent storage of block information */
 # define FBL_MEM_ENABLE_GLOBAL_BLOCK_INFO
 #endif /* FBL_MEM_ENABLE_VERIFY_OUTPUT || FBL_MEM_ENABLE_VERIFY_INPUT || FBL_MEM_ENABLE_VERIFY_PIPELINED || FBL_MEM_ENABLE_SEGMENT_HANDLING || FBL_MEM_ENABLE_PASSTHROUGH || FBL_ENABLE_PROCESSED_DATA_LENGTH || FBL_MEM_ENABLE_STREAM_OUTPUT || FBL_MEM_ENABLE_GAP_FILL || FBL_MEM_ENABLE_PROGRESS_INFO */
@@ -837,11 +843,17 @@ tFblMemStatus FblMemSegmentEndIndication( V_MEMRAM1 tFblLength V_MEMRAM2 V_MEMRA
 tFblMemStatus FblMemDataIndication( tFblMemConstRamData buffer, tFblLength offset, tFblLength length );
 void FblMemTask( void );
 void FblMemFlushInputData( void );
+#if defined( FBL_MEM_ENABLE_PIPELINING )
+void FblMemRxNotification( void );
+#endif /* FBL_MEM_ENABLE_PIPELINING */
 
 /* Low level memory operations */
 tFblMemStatus FblMemEraseRegion( tFblAddress eraseAddress, tFblLength eraseLength );
 tFblMemStatus FblMemProgramBuffer( tFblAddress programAddress,V_MEMRAM1 tFblLength V_MEMRAM2 V_MEMRAM3 * programLength,
    tFblMemRamData programData );
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+void FblMemDiscardErasedState( tFblAddress address, tFblLength length );
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
 
 /* Helper functions */
 void FblMemSetInteger( vuintx count, vuint32 input, tFblMemRamData buffer );
@@ -885,7 +897,8 @@ V_MEMRAM0 extern V_MEMRAM1 tFblMemProgState V_MEMRAM2 fblMemProgState;
 /*-- Compatibility remapping of configuration switches-----------------------*/
 
 /*-- Compile time -----------------------------------------------------------*/
-#if defined( FBL_ENABLE_ADAPTIVE_DATA_TRANSFER_RCRRP )
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING ) || \
+    defined( FBL_ENABLE_ADAPTIVE_DATA_TRANSFER_RCRRP )
 # if defined( FBL_MEM_WRITE_SEGMENTATION )
 # else
 #  error Write segmentation not defined
@@ -898,6 +911,14 @@ V_MEMRAM0 extern V_MEMRAM1 tFblMemProgState V_MEMRAM2 fblMemProgState;
 # endif /* FBL_ENABLE_UNALIGNED_DATA_TRANSFER */
 #endif /* FBL_ENABLE_PIPELINED_PROGRAMMING || FBL_ENABLE_ADAPTIVE_DATA_TRANSFER_RCRRP */
 
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+# if defined( FBL_MEM_QUEUE_ENTRIES_INPUT )
+#  if ( FBL_MEM_QUEUE_ENTRIES_INPUT < 2u )
+#   error Pipelined programming requires at least two input buffers
+#  endif
+# endif /* FBL_MEM_QUEUE_ENTRIES_INPUT */
+#endif /* FBL_ENABLE_PIPELINED_PROGRAMMING */
+
 #if defined( FBL_ENABLE_DATA_PROCESSING )
 # if defined( FBL_MEM_PROC_BUFFER_SIZE )
 # else
@@ -912,6 +933,10 @@ V_MEMRAM0 extern V_MEMRAM1 tFblMemProgState V_MEMRAM2 fblMemProgState;
 # if ( FBL_MEM_PROC_SEGMENTATION == FBL_MEM_PROC_BUFFER_SIZE )
 # else
 # endif
+#else
+# if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+#  error Delta download requires data processing
+# endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
 #endif /* FBL_ENABLE_DATA_PROCESSING */
 
 #if defined( FBL_MEM_BUFFER_SIZE )
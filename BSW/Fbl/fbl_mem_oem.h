@@ -140,6 +140,22 @@
 # endif /* __ApplFblMemIsDataProcessingRequired */
 #endif /* FBL_MEM_ENABLE_STREAM_OUTPUT */
 
+#if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+/* Allow override in configuration */
+# if defined( FBL_MEM_DELTA_DATA_FORMAT )
+# else
+/** Data format identifier of delta patch stream (compression method 0xD, no encryption) */
+#  define FBL_MEM_DELTA_DATA_FORMAT   0xD0u
+# endif /* FBL_MEM_DELTA_DATA_FORMAT */
+/* Allow override in configuration */
+# if defined( __ApplFblMemIsDeltaDownloadRequired )
+# else
+/** Check whether specific data format identifier implies reconstruction from delta patch stream */
+#  define __ApplFblMemIsDeltaDownloadRequired(dataFormat) \
+   ((tFblResult)((FBL_MEM_DELTA_DATA_FORMAT == (dataFormat)) ? kFblOk : kFblFailed))
+# endif /* __ApplFblMemIsDeltaDownloadRequired */
+#endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
+
 /*-- Verification -----------------------------------------------------------*/
 #if defined( FBL_MEM_ENABLE_VERIFY_PIPELINED )
 # define FBL_MEM_ENABLE_SEGMENT_HANDLING
@@ -159,6 +175,11 @@
 # endif
 #endif /* SEC_ENABLE_VERIFICATION_ADDRESS_LENGTH */
 
+#if defined( SEC_ENABLE_VERIFICATION_READ_BUFFER )
+/** Pass idle input buffer to verification on output data, used for memory readback */
+# define FBL_MEM_ENABLE_VERIFY_OUTPUT_READ_BUFFER
+#endif /* SEC_ENABLE_VERIFICATION_READ_BUFFER */
+
 /** Size of temporary verification result buffer */
 #define FBL_MEM_SIG_RESULT_BUFFER_SIZE                   kDiagSigBufLength
 
@@ -175,12 +196,36 @@
 */
 #define __ApplFblMemPreErase()                     FblDiagMemPreWrite()
 #define __ApplFblMemPostErase()                    FblDiagMemPostWrite()
+/*
+   Check whether memory range is already erased (e.g. blank check command of flash driver)
+   Return kFblOk to skip erase operation
+   Mandatory if FBL_MEM_ENABLE_ERASE_BLANK_CHECK is configured, unless FBL_MEM_ENABLE_READBACK_BLANK_CHECK selects
+   read back of memory contents (only reliable for memories without ECC)
+*/
+/* #define __ApplFblMemBlankCheck(address, length) */
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+/*
+   Pass successfully programmed data (including padding) to application
+   Remove macro if not applicable
+*/
+# define __ApplFblMemPostProgramData(address, data, length) \
+   (void)SecM_UpdateCrcTotal((SecM_AddrType)(address), (SecM_ConstRamDataType)(data), (SecM_SizeType)(length))
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
 /*
    Perform actions directly after segment end indication
    Remove macro if not applicable
 */
 /* #define __ApplFblMemPostSegmentEnd() */
 
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE )
+/*
+   Perform actions after input data has been queued, directly before the oldest pending input buffer is processed
+   to release a buffer for the next request
+   Remove macro if not applicable
+*/
+# define __ApplFblMemPreUnblock()                  FblDiagMemPreUnblock()
+#endif /* FBL_DIAG_ENABLE_TRANSFERDATA_EARLY_RESPONSE */
+
 /*-- Watchdog ---------------------------------------------------------------*/
 /* Default return code */
 #define FBL_MEM_WD_TRIGGER_DEFAULT                 (FBL_NO_TRIGGER)
@@ -149,6 +149,36 @@
 vuint8 memDrvDeviceActive;
 vuint8 memDrvFunctionActive;
 
+#if defined( FLASH_ENABLE_ASYNC_API )
+/***********************************************************************************************************************
+ *  DEFINES
+ **********************************************************************************************************************/
+
+# if defined( FBL_ENABLE_MULTIPLE_MEM_DEVICES )
+/** Device of current memory segment */
+#  define MemDriver_GetAsyncDevice()        (FlashBlock[memSegment].device)
+/** Only the internal flash driver supports asynchronous operations */
+#  define MemDriver_IsAsyncDevice(dev)      (memDrvLst[(dev)].write == &FlashDriver_RWriteSync) /* PRQA S 3453 */ /* MD_MSR_19.7 */
+# else
+#  define MemDriver_GetAsyncDevice()        (kMioDeviceInternalFlash)
+#  define MemDriver_IsAsyncDevice(dev)      (kMioDeviceInternalFlash == (dev)) /* PRQA S 3453 */ /* MD_MSR_19.7 */
+# endif /* FBL_ENABLE_MULTIPLE_MEM_DEVICES */
+
+/* Code executed between two polling cycles (main loop, FblLib_Mem, watchdog) must not be fetched from the flash bank
+ * under program/erase: it has to be located in RAM or in a separate flash bank (read-while-write) */
+# if defined( FLASH_ENABLE_READ_WHILE_WRITE )
+# else
+#  error "Asynchronous flash operations require FLASH_ENABLE_READ_WHILE_WRITE (code in RAM or separate flash bank)"
+# endif /* FLASH_ENABLE_READ_WHILE_WRITE */
+
+/***********************************************************************************************************************
+ *  LOCAL DATA
+ **********************************************************************************************************************/
+
+/* Device of pending asynchronous operation */
+static vuint8 memDrvAsyncDevice;
+#endif /* FLASH_ENABLE_ASYNC_API */
+
 #define FBLMIO_START_SEC_CODE
 #include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
 
@@ -318,6 +348,107 @@ IO_ErrorType V_API_NEAR MemDriver_RInitSync( void * address ) /* PRQA S 3673 */
 
 # endif /* FBL_ENABLE_MULTIPLE_MEM_DEVICES */
 
+#if defined( FLASH_ENABLE_ASYNC_API )
+/***********************************************************************************************************************
+ *  MemDriver_RWriteAsync
+ **********************************************************************************************************************/
+/*! \brief      Start writing data into memory
+ *  \details    The write operation is started and the function returns without waiting for completion, if supported
+ *              by the memory driver of the affected device. Otherwise the data is written synchronously.
+ *              The buffer has to remain unchanged until the operation is finished. The device stays active until
+ *              the operation is finished.
+ *  \pre        Memory driver is initialized, memory to be written is erased, no asynchronous operation pending.
+ *  \param[in]  buf Pointer to input data buffer.
+ *  \param[in]  len Data length. Has to be aligned to a multiple of the smallest writable data segment.
+ *  \param[in]  addr Write target address. Has to be aligned to a write segment start address.
+ *  \return     IO_E_PENDING if operation is still in progress (see MemDriver_RPoll), write result otherwise.
+ **********************************************************************************************************************/
+IO_ErrorType V_API_NEAR MemDriver_RWriteAsync( IO_MemPtrType buf, IO_SizeType len, IO_PositionType addr )
+{
+   IO_ErrorType ret_status;
+
+   memDrvAsyncDevice = MemDriver_GetAsyncDevice();
+
+   if (MemDriver_IsAsyncDevice(memDrvAsyncDevice))
+   {
+      MemDriver_RWriteBegin(memDrvAsyncDevice); /* PRQA S 3109 */ /* MD_CBD_14.3 */
+      ret_status = FlashDriver_RWriteAsync(buf, len, addr);
+      if (IO_E_PENDING != ret_status)
+      {
+         MemDriver_RWriteEnd(memDrvAsyncDevice); /* PRQA S 3109 */ /* MD_CBD_14.3 */
+      }
+   }
+   else
+   {
+      ret_status = MemDriver_RWriteSync(buf, len, addr);
+   }
+
+   return ret_status;
+}
+
+/***********************************************************************************************************************
+ *  MemDriver_REraseAsync
+ **********************************************************************************************************************/
+/*! \brief      Start erasing area in memory
+ *  \details    The erase operation is started and the function returns without waiting for completion, if supported
+ *              by the memory driver of the affected device. Otherwise the area is erased synchronously.
+ *              The device stays active until the operation is finished.
+ *  \pre        Memory driver is initialized, no asynchronous operation pending.
+ *  \param[in]  len Length of memory to be erased. The length has to be aligned to the length of one or
+ *              more erasable sectors of the used memories.
+ *  \param[in]  addr Start address of erase area. The start address has to be aligned to the start address
+ *              of an erasable area.
+ *  \return     IO_E_PENDING if operation is still in progress (see MemDriver_RPoll), erase result otherwise.
+ **********************************************************************************************************************/
+IO_ErrorType V_API_NEAR MemDriver_REraseAsync( IO_SizeType len, IO_PositionType addr )
+{
+   IO_ErrorType ret_status;
+
+   memDrvAsyncDevice = MemDriver_GetAsyncDevice();
+
+   if (MemDriver_IsAsyncDevice(memDrvAsyncDevice))
+   {
+      MemDriver_REraseBegin(memDrvAsyncDevice); /* PRQA S 3109 */ /* MD_CBD_14.3 */
+      ret_status = FlashDriver_REraseAsync(len, addr);
+      if (IO_E_PENDING != ret_status)
+      {
+         MemDriver_REraseEnd(memDrvAsyncDevice); /* PRQA S 3109 */ /* MD_CBD_14.3 */
+      }
+   }
+   else
+   {
+      ret_status = MemDriver_REraseSync(len, addr);
+   }
+
+   return ret_status;
+}
+
+/***********************************************************************************************************************
+ *  MemDriver_RPoll
+ **********************************************************************************************************************/
+/*! \brief      Poll pending asynchronous memory operation
+ *  \details    Performs a single processing step of the operation started by MemDriver_RWriteAsync or
+ *              MemDriver_REraseAsync. Device active state remains set until the operation is finished, so tasks
+ *              located in ROM (see FblCwIsStateTaskAllowed) are not executed in between.
+ *  \pre        MemDriver_RWriteAsync or MemDriver_REraseAsync returned IO_E_PENDING.
+ *  \return     IO_E_PENDING if operation is still in progress, result of operation otherwise.
+ **********************************************************************************************************************/
+IO_ErrorType V_API_NEAR MemDriver_RPoll( void )
+{
+   IO_ErrorType ret_status;
+
+   ret_status = FlashDriver_RPoll();
+
+   if (IO_E_PENDING != ret_status)
+   {
+      /* Write and erase end indications are identical */
+      MemDriver_RWriteEnd(memDrvAsyncDevice); /* PRQA S 3109 */ /* MD_CBD_14.3 */
+   }
+
+   return ret_status;
+}
+#endif /* FLASH_ENABLE_ASYNC_API */
+
 #define FBLMIO_STOP_SEC_CODE
 #include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
 
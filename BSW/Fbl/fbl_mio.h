@@ -295,6 +295,11 @@ IO_ErrorType V_API_NEAR MemDriver_RDeinitSync( void * address );
 IO_ErrorType V_API_NEAR MemDriver_RWriteSync( IO_MemPtrType buf, IO_SizeType len, IO_PositionType addr );
 IO_ErrorType V_API_NEAR MemDriver_REraseSync( IO_SizeType len, IO_PositionType addr );
 IO_ErrorType V_API_NEAR MemDriver_RInitSync( void * address );
+#if defined( FLASH_ENABLE_ASYNC_API )
+IO_ErrorType V_API_NEAR MemDriver_RWriteAsync( IO_MemPtrType buf, IO_SizeType len, IO_PositionType addr );
+IO_ErrorType V_API_NEAR MemDriver_REraseAsync( IO_SizeType len, IO_PositionType addr );
+IO_ErrorType V_API_NEAR MemDriver_RPoll( void );
+#endif /* FLASH_ENABLE_ASYNC_API */
 
 #if defined( FBL_ENABLE_MULTIPLE_MEM_DEVICES )
 #endif /* FBL_ENABLE_MULTIPLE_MEM_DEVICES */
@@ -606,6 +606,46 @@ typedef volatile struct
 
 typedef tCanCell * tCanCellPtr;
 
+#  if defined( FBL_ENABLE_CAN_FD )
+/* RS-CANFD in CAN FD mode: message buffers are relocated and extended to a payload of up to 64 bytes.
+ * The control and status registers mapped by tCanCell keep their position.
+ * The location of the FD mode registers differs between derivatives. It is not part of this file and has to be
+ * provided by the configuration according to the hardware manual of the used derivative:
+ *   kCanFdRxFifoOffset   Receive FIFO access registers (CFDRFIDx)
+ *   kCanFdTxBufOffset    Transmit buffer registers (CFDTMIDp)
+ *   kCanFdMsgObjSize     Distance of two consecutive FIFO entries / transmit buffers
+ *   kCanFdChDcfgOffset   Channel data bit rate configuration register of channel 0 (CFDCmDCFG)
+ *   kCanFdChFdcfgOffset  Channel CAN FD configuration register of channel 0 (CFDCmFDCFG)
+ *   kCanFdChCfgStride    Distance of the channel configuration registers of two consecutive channels
+ *   kCanFdGrmCfgOffset   Global RAM configuration register (CFDGRMCFG) */
+#   if defined( kCanFdRxFifoOffset ) && defined( kCanFdTxBufOffset ) && defined( kCanFdMsgObjSize ) && \
+       defined( kCanFdChDcfgOffset ) && defined( kCanFdChFdcfgOffset ) && defined( kCanFdChCfgStride ) && \
+       defined( kCanFdGrmCfgOffset )
+#   else
+#    error "CAN FD register map of derivative not configured (see fbl_sfr.h)"
+#   endif
+
+#   define kCanFdMaxDataLength         64u
+
+typedef volatile struct
+{
+   volatile vuint32      Id;              /**< Buffer/FIFO register ID */
+   volatile kCanRegSize  Ptr;             /**< Buffer/FIFO register PTR - DLC, timestamp */
+   volatile kCanRegSize  FdSts;           /**< Buffer/FIFO register FDSTS/FDCTR - label, FDF, BRS, ESI */
+   union{ /* PRQA S 0750 */ /* MD_MSR_18.4 */
+      volatile vuint8    bData[kCanFdMaxDataLength];         /**< Buffer/FIFO register DF - Data */
+      volatile vuint32   iData[kCanFdMaxDataLength / 4u];    /**< Buffer/FIFO register DF - Data */
+   } u;
+   volatile kCanRegSize  Unused[(kCanFdMsgObjSize - (kCanFdMaxDataLength + 12u)) / 4u]; /**< Gap up to next buffer */
+} tCanFdMsgObj;
+
+#   define mFdRxFifo(idx)              (((tCanFdMsgObj *)(kFblCanBaseAdr + kCanFdRxFifoOffset))[idx])
+#   define mFdTxBuf(idx)               (((tCanFdMsgObj *)(kFblCanBaseAdr + kCanFdTxBufOffset))[idx])
+#   define mFdChDCFG(ch)               (*(volatile vuint32 *)(kFblCanBaseAdr + kCanFdChDcfgOffset + ((ch) * kCanFdChCfgStride)))
+#   define mFdChFDCFG(ch)              (*(volatile vuint32 *)(kFblCanBaseAdr + kCanFdChFdcfgOffset + ((ch) * kCanFdChCfgStride)))
+#   define mFdGRMCFG                   (*(volatile vuint32 *)(kFblCanBaseAdr + kCanFdGrmCfgOffset))
+#  endif /* FBL_ENABLE_CAN_FD */
+
 #endif /* FBL_ENABLE_BUSTYPE_CAN */
 
 #endif /* __FBL_SFR_H__ */
@@ -167,6 +167,15 @@ MEMORY_ROM vuint8 kFblTpBugFixVersion = FBLTP_ISO_RELEASE_VERSION;
 
 #define kCanFrameLength                8u        /**< Total length of a CAN frame */
 
+#if defined( FBL_TP_ENABLE_CAN_FD )
+# if !defined( kFblTpCanFdTxDL )
+#  define kFblTpCanFdTxDL              64u       /**< Transmit data link layer frame length (TX_DL) */
+# endif
+# define kTxFrameLength                kFblTpCanFdTxDL
+#else
+# define kTxFrameLength                kCanFrameLength
+#endif
+
 #define kFlowStateCTS                  0x00u     /* CTS=Clear to send */
 #define kFlowStateWait                 0x01u
 #define kFlowStateOverrun              0x02u
@@ -243,6 +252,11 @@ typedef vuint16 tTpConfTimer;
 #define kSFDataPos            (1u + kTargetByteOffset)
 #define kFFDataPos            (2u + kTargetByteOffset)
 #define kCFDataPos            (1u + kTargetByteOffset)
+#if defined( FBL_TP_ENABLE_CAN_FD )
+/* Escape sequences for SF_DL > 7 and FF_DL > 4095 */
+# define kSFEscDataPos        (2u + kTargetByteOffset)
+# define kFFEscLengthPos      (2u + kTargetByteOffset)
+#endif
 
 #if defined( MULTIPLE_RECEIVE_BUFFER )
 # define tpCanRxData data
@@ -252,6 +266,13 @@ typedef vuint16 tTpConfTimer;
 #define DL_Byte              (tpCanRxData[kLengthPos])
 #define STmin_Byte           (tpCanRxData[kSTminPos])
 
+#if defined( FBL_TP_ENABLE_CAN_FD )
+/* SF in frames with more than eight bytes always use the escape sequence */
+# define kRxSFDataPos         ((CanRxActualDLC > kCanFrameLength) ? kSFEscDataPos : kSFDataPos)
+#else
+# define kRxSFDataPos         kSFDataPos
+#endif
+
 /* Start value for sequence number counter */
 # define kTpSNStartValue      1u
 
@@ -461,12 +482,22 @@ static vuint8 bPaddingLength;
  */
 static vuint8 bStateFlags;
 
-#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
+#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC ) || \
+    defined( FBL_TP_ENABLE_CAN_FD )
 /** Storage of current DLC */
 static vuint8 tpTxDLC;
 
 #endif
 
+#if defined( FBL_TP_ENABLE_CAN_FD )
+/**
+ *  \description Frame length of the received FF (RX_DL). All CF of the segmented message, except the last one, have to
+ *               use this frame length.
+ *  \note        Value range / coding: 8..64
+ */
+static vuint8 rxFrameLength;
+#endif
+
 #if defined( FBL_TP_ENABLE_CONFIRMATION_INTERRUPT )
 static MEMORY_NEAR vuint8 gTpConfState;         /**< State variable for confirmation interrupt handling */
 static MEMORY_NEAR tTpConfTimer gTpConfTimer;   /**< Counter variable for confirmation timeout observation */
@@ -503,9 +534,24 @@ static MEMORY_NEAR tTpConfTimer gTpConfTimer;   /**< Counter variable for confir
  **********************************************************************************************************************/
 
 #define kSF_DataLength     (7u - kTargetByteOffset)
-#define kFF_DataLength     (6u - kTargetByteOffset)
+#define kFF_DataLength     (kTxFrameLength - 2u - kTargetByteOffset)
 #define kFC_DataLength     (3u)
-#define kCF_DataLength     (7u - kTargetByteOffset)
+#define kCF_DataLength     (kTxFrameLength - 1u - kTargetByteOffset)
+
+#if defined( FBL_TP_ENABLE_CAN_FD )
+/* Maximum SF payload using the escape sequence */
+# define kSFEsc_DataLength (kTxFrameLength - kSFEscDataPos)
+# define kSF_MaxDataLength ((kSFEsc_DataLength > kSF_DataLength) ? kSFEsc_DataLength : kSF_DataLength)
+# define kTxSFDataPos(len) (((len) > kSF_DataLength) ? kSFEscDataPos : kSFDataPos)
+/* Payload of received FF and CF depends on the frame length used by the sender */
+# define kRxFF_DataLength  ((tTpDataType)rxFrameLength - kFFDataPos)
+# define kRxCF_DataLength  ((tTpDataType)rxFrameLength - kCFDataPos)
+#else
+# define kRxFF_DataLength  kFF_DataLength
+# define kRxCF_DataLength  kCF_DataLength
+# define kSF_MaxDataLength kSF_DataLength
+# define kTxSFDataPos(len) kSFDataPos
+#endif
 
 #define kConfInterruptTimeoutCounter         (kFblTpConfInterruptTimeout / TpCallCycle)
 
@@ -700,6 +746,17 @@ static MEMORY_NEAR tTpConfTimer gTpConfTimer;   /**< Counter variable for confir
 # error "Buffer for transport layer is larger than 4095 bytes"
 #endif
 
+#if defined( FBL_TP_ENABLE_CAN_FD )
+# if ( kFblTpCanFdTxDL != 8u )  && ( kFblTpCanFdTxDL != 12u ) && ( kFblTpCanFdTxDL != 16u ) && \
+     ( kFblTpCanFdTxDL != 20u ) && ( kFblTpCanFdTxDL != 24u ) && ( kFblTpCanFdTxDL != 32u ) && \
+     ( kFblTpCanFdTxDL != 48u ) && ( kFblTpCanFdTxDL != 64u )
+#  error "kFblTpCanFdTxDL has to be a valid CAN FD frame length"
+# endif
+# if !defined( FBL_TP_ENABLE_ISO15765_2_2 )
+#  error "CAN FD transport requires ISO 15765-2 flow control overrun handling"
+# endif
+#endif
+
 /* PRQA L:FblTp_3453 */
 /* PRQA L:FblTp_3458 */
 
@@ -712,6 +769,9 @@ static void AssembleFC(void);
 static vuint8 CAN_SaveTransmit(void);
 static void TxConfirm(vuint8 state);
 static void FblTpInit(void);
+#if defined( FBL_TP_ENABLE_CAN_FD )
+static void FblTpSetTxFrameLength(vuintx dataLength);
+#endif
 # define FBLTP_RAMCODE_STOP_SEC_CODE
 # include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
 
@@ -736,7 +796,9 @@ static void AssembleFC(void)
 
    tpCanTxData[kSTminPos] = (vuint8)FblTpGetRxSTmin();
 
-#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
+#if defined( FBL_TP_ENABLE_CAN_FD )
+   FblTpSetTxFrameLength(kFC_DataLength + kTpciPos);
+#elif defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
    tpTxDLC = (vuint8)(kFC_DataLength + kTpciPos);
 #else
    {
@@ -761,7 +823,8 @@ static vuint8 CAN_SaveTransmit(void)
 {
    vuint8 rval;
 
-# if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
+# if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC ) || \
+     defined( FBL_TP_ENABLE_CAN_FD )
    /* Set DLC value for next tp message */
    FblCanSetTxDLC(fblCanTxObj[kTpTxObj], tpTxDLC);
 # endif
@@ -829,11 +892,61 @@ static void FblTpInit(void)
 #if defined( FBL_TP_ENABLE_CONFIRMATION_INTERRUPT )
    InitConfState(); /* PRQA S 3109 */ /* MD_FblTp_3109 */
 #endif
-#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
+#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC ) || \
+    defined( FBL_TP_ENABLE_CAN_FD )
    tpTxDLC = 0x0u;
 #endif
 }
 
+#if defined( FBL_TP_ENABLE_CAN_FD )
+/***********************************************************************************************************************
+ *  FblTpSetTxFrameLength
+ **********************************************************************************************************************/
+/*! \brief       Set frame length of the next transmitted frame
+ *  \details     Frames with more than eight bytes are extended to the next valid CAN FD frame length. The unused
+ *               bytes are padded, as required by ISO 15765-2 for CAN FD frames.
+ *  \param[in]   dataLength Number of bytes used in the frame (including TPCI)
+ **********************************************************************************************************************/
+static void FblTpSetTxFrameLength(vuintx dataLength)
+{
+   vuintx frameLength;
+   vuintx idx;
+
+   if (dataLength <= kCanFrameLength)
+   {
+# if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
+      frameLength = dataLength;
+# else
+      frameLength = kCanFrameLength;
+# endif
+   }
+   else if (dataLength <= 24u)
+   {
+      /* Frame lengths 12, 16, 20 and 24 */
+      frameLength = (dataLength + 3u) & FblInvert8Bit(3u);
+   }
+   else if (dataLength <= 32u)
+   {
+      frameLength = 32u;
+   }
+   else if (dataLength <= 48u)
+   {
+      frameLength = 48u;
+   }
+   else
+   {
+      frameLength = 64u;
+   }
+
+   for (idx = dataLength; idx < frameLength; idx++)
+   {
+      tpCanTxData[idx] = kFblTpFillPattern;
+   }
+
+   tpTxDLC = (vuint8)frameLength;
+}
+#endif /* FBL_TP_ENABLE_CAN_FD */
+
 /***********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  **********************************************************************************************************************/
@@ -894,25 +1007,38 @@ vuint8 FblTpTransmit(tTpDataType count)
       return kTpBusy;           /* Sending not possible while waiting or not idle */
    }
 
-   if (count <= kSF_DataLength)     /* (0)1 to 6/7 bytes will be a SingleFrame */
+   if (count <= kSF_MaxDataLength)  /* (0)1 to 6/7 bytes (CAN FD: up to TX_DL - 2) will be a SingleFrame */
    {
       txSEG = 0u;                   /* In case of repetition due to CAN-disturbance
                                      * This ensures, that the RX / TX state is re-init */
-      tpCanTxData[kTpciPos] = (vuint8)count; /* kL4_SingleFrame TPCI is 0x00 */
+#if defined( FBL_TP_ENABLE_CAN_FD )
+      if (count > kSF_DataLength)
+      {
+         /* SF_DL does not fit into the TPCI: use escape sequence */
+         tpCanTxData[kTpciPos]   = kL4_SingleFrame;
+         tpCanTxData[kLengthPos] = (vuint8)count;
+      }
+      else
+#endif
+      {
+         tpCanTxData[kTpciPos] = (vuint8)count; /* kL4_SingleFrame TPCI is 0x00 */
+      }
 
 #if defined( FBL_TP_ENABLE_INTERNAL_MEMCPY )
       {
          vuintx i;
          for (i = 0u; i < count; i++)
          {
-            tpCanTxData[kSFDataPos + i] = txDataBuffer[i];
+            tpCanTxData[kTxSFDataPos(count) + i] = txDataBuffer[i];
          }
       }
 #else
-      __ApplFblTpCopyToCAN(&tpCanTxData[kSFDataPos], &txDataBuffer[0], count);
+      __ApplFblTpCopyToCAN(&tpCanTxData[kTxSFDataPos(count)], &txDataBuffer[0], count);
 #endif
 
-#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
+#if defined( FBL_TP_ENABLE_CAN_FD )
+      FblTpSetTxFrameLength(count + kTxSFDataPos(count));
+#elif defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
       tpTxDLC = (vuint8)(count + kLengthPos);
 #else
 # if defined( FBL_TP_ENABLE_TX_FRAME_PADDING )
@@ -971,8 +1097,9 @@ vuint8 FblTpTransmit(tTpDataType count)
 #else
       __ApplFblTpNotifyTx(kFF_DataLength);
 #endif/* Use confirmation interrupt */
-#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
-      tpTxDLC = (vuint8)8u;
+#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC ) || \
+    defined( FBL_TP_ENABLE_CAN_FD )
+      tpTxDLC = (vuint8)kTxFrameLength;
 #endif
       (void)CAN_SaveTransmit();
    }
@@ -1017,11 +1144,15 @@ vuint8 FblTpTransmitSF(vuint8 count)
 #if defined( FBL_TP_ENABLE_CONFIRMATION_INTERRUPT )
    SetWaitForSFConfInterrupt(); /* PRQA S 3109 */ /* MD_FblTp_3109 */
 #endif
-#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
+#if defined( FBL_TP_ENABLE_CAN_FD )
+   /* Previous frame might have been a CAN FD frame with a different length */
+   FblTpSetTxFrameLength(count + kSFDataPos);
+#elif defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
    tpTxDLC = (vuint8)(count + kLengthPos);
 #endif
 
-# if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
+# if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC ) || \
+     defined( FBL_TP_ENABLE_CAN_FD )
    /* Set DLC value for next tp message */
    FblCanSetTxDLC(fblCanTxObj[kTpTxObj], tpTxDLC);
 # endif
@@ -1054,6 +1185,12 @@ vuint8 FblTpPrecopy(const pChipDataPtr data) /* PRQA S 3673 */ /* MD_FblTp_3673
 #endif
 #if defined( FBL_TP_ENABLE_FIX_RX_DLC_CHECK )
 # if defined( FBL_TP_ENABLE_VARIABLE_RX_DLC )
+# elif defined( FBL_TP_ENABLE_CAN_FD )
+   /* CAN FD frames may be longer than eight bytes */
+   if (CanRxActualDLC < kCanFrameLength)
+   {
+      return kCopyNoData;
+   }
 # else
    if (CanRxActualDLC != 8u)
    {
@@ -1126,6 +1263,20 @@ vuint8 FblTpPrecopy(const pChipDataPtr data) /* PRQA S 3673 */ /* MD_FblTp_3673
          }
 #endif
 
+#if defined( FBL_TP_ENABLE_CAN_FD )
+         if (CanRxActualDLC > kCanFrameLength)
+         {
+            /* Escape sequence: SF_DL is stored in the byte following the TPCI */
+            if ((TPCI_Byte != kL4_SingleFrame) || (0u == DL_Byte) || (DL_Byte > (CanRxActualDLC - kSFEscDataPos)))
+            {
+               __ApplFblTpErrorIndication((vuint8)kTpErrRxSFDL);  /* Notify application */
+               return kCopyNoData;                                /* The frame is not accepted */
+            }
+
+            rxDataLength = DL_Byte;
+         }
+         else
+#endif
          if ((TPCI_Byte > kSF_DataLength)
 #if defined( FBL_TP_ENABLE_ISO15765_2_2 )
             || (0u == TPCI_Byte)
@@ -1156,11 +1307,11 @@ vuint8 FblTpPrecopy(const pChipDataPtr data) /* PRQA S 3673 */ /* MD_FblTp_3673
             vuintx i;
             for (i = 0u; i < rxDataLength; i++)
             {
-               rxDataBuffer[i] = tpCanRxData[kSFDataPos + i];
+               rxDataBuffer[i] = tpCanRxData[kRxSFDataPos + i];
             }
          }
 #else /* FBL_TP_ENABLE_INTERNAL_MEMCPY */
-         __ApplFblTpCopyFromCAN(rxDataBuffer, &tpCanRxData[kSFDataPos], rxDataLength); /* PRQA S 0312 */ /* MD_FblTp_0312 */
+         __ApplFblTpCopyFromCAN(rxDataBuffer, &tpCanRxData[kRxSFDataPos], rxDataLength); /* PRQA S 0312 */ /* MD_FblTp_0312 */
 #endif
          rxSetState(kTpRxBlocked);
          __ApplFblTpDataInd((tTpDataType)rxDataLength); /* Ready, a single frame was received */
@@ -1174,7 +1325,13 @@ vuint8 FblTpPrecopy(const pChipDataPtr data) /* PRQA S 3673 */ /* MD_FblTp_3673
          /* Use a temporary data length variable until it's certain that the frame is valid */
          vuint16 tmpDL;
 
-#if defined( FBL_TP_ENABLE_VARIABLE_RX_DLC )
+#if defined( FBL_TP_ENABLE_CAN_FD )
+         /* Checking CAN-DLC: FF uses at least eight bytes, its length determines RX_DL */
+         if (CanRxActualDLC < kCanFrameLength)
+         {
+            return kCopyNoData;
+         }
+#elif defined( FBL_TP_ENABLE_VARIABLE_RX_DLC )
          /* Checking CAN-DLC */
          if (CanRxActualDLC != 8u)
          {
@@ -1230,8 +1387,27 @@ vuint8 FblTpPrecopy(const pChipDataPtr data) /* PRQA S 3673 */ /* MD_FblTp_3673
          tmpDL  = (((vuint16)(TPCI_Byte & kL4_FFData)) << 8);
          tmpDL |=   (vuint16)DL_Byte;
 
+#if defined( FBL_TP_ENABLE_CAN_FD )
+         if (0u == tmpDL)
+         {
+            /* Escape sequence: FF_DL is stored in the four bytes following the TPCI */
+            if ((0u == (tpCanRxData[kFFEscLengthPos] | tpCanRxData[kFFEscLengthPos + 1u])) &&
+                ((((vuint16)tpCanRxData[kFFEscLengthPos + 2u] << 8) | (vuint16)tpCanRxData[kFFEscLengthPos + 3u]) <= 0x0FFFu))
+            {
+               return kCopyNoData; /* Escape sequence not allowed for FF_DL <= 4095, the frame is not accepted */
+            }
+
+            /* FF_DL > 4095 always exceeds the receive buffer (see kFblTpBufferSize) */
+            tmpDL = 0xFFFFu;
+         }
+
+         /* Check for invalid length: message would have fit into a SF of the same frame length */
+         if ((tmpDL <= kSF_DataLength) ||
+             ((CanRxActualDLC > kCanFrameLength) && (tmpDL <= (vuint16)(CanRxActualDLC - kSFEscDataPos))))
+#else
          /* Check for invalid length */
          if (tmpDL <= kSF_DataLength)
+#endif
          {
             return kCopyNoData; /* The frame is not accepted */
          }
@@ -1269,22 +1445,25 @@ vuint8 FblTpPrecopy(const pChipDataPtr data) /* PRQA S 3673 */ /* MD_FblTp_3673
          }
 #endif
          rxDataLength = (tTpDataType)tmpDL;
+#if defined( FBL_TP_ENABLE_CAN_FD )
+         rxFrameLength = CanRxActualDLC;  /* RX_DL is defined by the FF */
+#endif
 
          __ApplFblTpRxFF(); /* Defined in tp_cfg.h/tp.cfg; Normally not used */
 
 #if defined( FBL_TP_ENABLE_INTERNAL_MEMCPY )
          {
             vuintx i;
-            for (i = 0u; i < kFF_DataLength; i++)
+            for (i = 0u; i < kRxFF_DataLength; i++)
             {
                rxDataBuffer[i] = tpCanRxData[kFFDataPos + i];
             }
          }
 #else
-         __ApplFblTpCopyFromCAN( rxDataBuffer, &tpCanRxData[kFFDataPos], kFF_DataLength ); /* PRQA S 0312 */ /* MD_FblTp_0312 */
+         __ApplFblTpCopyFromCAN( rxDataBuffer, &tpCanRxData[kFFDataPos], kRxFF_DataLength ); /* PRQA S 0312 */ /* MD_FblTp_0312 */
 #endif /* ! FBL_TP_ENABLE_INTERNAL_MEMCPY */
 
-         rxDataIndex = kFF_DataLength;    /* Set RX index to next free data element */
+         rxDataIndex = kRxFF_DataLength;  /* Set RX index to next free data element */
          AssembleFC();                    /* FF always required TX of a FC */
          rxReloadBSCnt();
 #if defined( FBL_TP_ENABLE_CONFIRMATION_INTERRUPT )
@@ -1337,9 +1516,9 @@ vuint8 FblTpPrecopy(const pChipDataPtr data) /* PRQA S 3673 */ /* MD_FblTp_3673
           * ConsecutiveFrame is accepted but no further data are copied to the buffer. */
          if (0u != GetRxBlockTooLargeFlag())
          {
-            if ((locRxDataLength - rxDataIndex) >= kCF_DataLength)
+            if ((locRxDataLength - rxDataIndex) >= kRxCF_DataLength)
             {
-               rxDataIndex += kCF_DataLength;
+               rxDataIndex += kRxCF_DataLength;
             }
             else
             {
@@ -1353,9 +1532,10 @@ vuint8 FblTpPrecopy(const pChipDataPtr data) /* PRQA S 3673 */ /* MD_FblTp_3673
              * one block, the following check will be done to prevent buffer overrun. Then bytes are copied
              * until the RX buffer is full. */
             /* Rx buffer with free elements? */
-            if ((locRxDataLength - rxDataIndex) < (tTpDataType)kCF_DataLength)
+            if ((locRxDataLength - rxDataIndex) < (tTpDataType)kRxCF_DataLength)
             {
-#if defined( FBL_TP_ENABLE_VARIABLE_RX_DLC )
+#if defined( FBL_TP_ENABLE_VARIABLE_RX_DLC ) || \
+    defined( FBL_TP_ENABLE_CAN_FD )
             /* Checking CAN-DLC */
                if (CanRxActualDLC <= (locRxDataLength - rxDataIndex + kTpciPos))
                {
@@ -1380,7 +1560,13 @@ vuint8 FblTpPrecopy(const pChipDataPtr data) /* PRQA S 3673 */ /* MD_FblTp_3673
             }
             else
             {
-#if defined( FBL_TP_ENABLE_VARIABLE_RX_DLC )
+#if defined( FBL_TP_ENABLE_CAN_FD )
+               /* Checking CAN-DLC: all CF except the last one have to use RX_DL */
+               if (CanRxActualDLC != rxFrameLength)
+               {
+                  return kCopyNoData;
+               }
+#elif defined( FBL_TP_ENABLE_VARIABLE_RX_DLC )
                /* Checking CAN-DLC */
                if (CanRxActualDLC != 8u)
                {
@@ -1390,16 +1576,16 @@ vuint8 FblTpPrecopy(const pChipDataPtr data) /* PRQA S 3673 */ /* MD_FblTp_3673
 #if defined( FBL_TP_ENABLE_INTERNAL_MEMCPY )
                {
                   vuintx i;
-                  for (i = 0u; i < kCF_DataLength; i++)
+                  for (i = 0u; i < kRxCF_DataLength; i++)
                   {
                      rxDataBuffer[rxDataIndex + i] = tpCanRxData[kSFDataPos + i];
                   }
                }
 #else /* FBL_TP_ENABLE_INTERNAL_MEMCPY */
-               __ApplFblTpCopyFromCAN(&rxDataBuffer[rxDataIndex], &tpCanRxData[kSFDataPos], kCF_DataLength); /* PRQA S 0312 */ /* MD_FblTp_0312 */
+               __ApplFblTpCopyFromCAN(&rxDataBuffer[rxDataIndex], &tpCanRxData[kSFDataPos], kRxCF_DataLength); /* PRQA S 0312 */ /* MD_FblTp_0312 */
 #endif
 
-               rxDataIndex += kCF_DataLength; /* Set RX index to next free data element */
+               rxDataIndex += kRxCF_DataLength; /* Set RX index to next free data element */
             }
          } /* To prevent misunderstandings */
 
@@ -1746,16 +1932,20 @@ void FblTpTask(void)
 #endif
                   txDataIndex += (kCF_DataLength - bPaddingLength);
 
-#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
+#if defined( FBL_TP_ENABLE_CAN_FD )
+                  FblTpSetTxFrameLength(kTxFrameLength - bPaddingLength);
+#else
+# if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
                   tpTxDLC = (vuint8)(kCanFrameLength - bPaddingLength);
-#endif
-#if defined( FBL_TP_ENABLE_TX_FRAME_PADDING )
+# endif
+# if defined( FBL_TP_ENABLE_TX_FRAME_PADDING )
                   /* PRQA S 3356, 3359 1 */ /* MD_FblTp_WaitForConfIR */
                   for (idx = kCanFrameLength - bPaddingLength; idx < kCanFrameLength; idx++)
                   { /* PRQA S 3201 */ /* MD_FblTp_WaitForConfIR */
                      tpCanTxData[idx] = kFblTpFillPattern;
                   }
-#endif
+# endif
+#endif /* FBL_TP_ENABLE_CAN_FD */
 
                   /* Send last CF now and we're done! No FC after last CF */
 #if defined( FBL_TP_ENABLE_CONFIRMATION_INTERRUPT )
@@ -1784,8 +1974,9 @@ void FblTpTask(void)
 #endif
                   txDataIndex += kCF_DataLength;
 
-#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC )
-                  tpTxDLC = (vuint8)8u;
+#if defined( FBL_TP_ENABLE_VARIABLE_TX_DLC ) || \
+    defined( FBL_TP_ENABLE_CAN_FD )
+                  tpTxDLC = (vuint8)kTxFrameLength;
 #endif
 #if defined( FBL_TP_ENABLE_CONFIRMATION_INTERRUPT )
                   StartTxWaitForTxCF(STmin, kTpTxWaitForTxCF); /* PRQA S 3109 */ /* MD_FblTp_3109 */
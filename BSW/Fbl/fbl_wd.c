@@ -245,6 +245,13 @@ vuint8 V_API_NEAR FblLookForWatchdog( void )
       /* the FBL is active, this task can now be called e.g. from FLASH */
       FblCwStateTask();
    }
+# if defined( FBL_ENABLE_CAN_RX_QUEUE )
+   if (FblCwGetInit())
+   {
+      /* Drain CAN receive FIFO into software receive queue, executed from RAM even while flash operations are active */
+      FblCanRxQueueFill();
+   }
+# endif /* FBL_ENABLE_CAN_RX_QUEUE */
 # if defined( FBL_WD_STATE_TASK )
    /* Execute configurable state task
       Task is active immediately and will be executed on every function call
@@ -77,6 +77,7 @@
 #define IO_E_OK       ((vuint8)0x00u)           /**< Memory driver action successful */
 #define IO_E_NOT_OK   ((vuint8)0x01u)           /**< Memory driver action failed */
 #define IO_E_ERASED   ((vuint8)0xE5u)           /**< Read failure (e.g. ECC), but memory is assumed to be erased */
+#define IO_E_PENDING  ((vuint8)0xE6u)           /**< Asynchronous memory driver action still in progress */
 
 /***********************************************************************************************************************
  *  TYPEDEFS
@@ -152,6 +152,11 @@ typedef struct tagFlashHeader
    tFlashFct      flashSetOpbFct;      /**< Function pointer to set option bytes    */
    tFlashFct      flashGetOpbFct;      /**< Function pointer to get option bytes    */
 # endif /* FLASH_ENABLE_OPTIONBYTE_API */
+#if defined( FLASH_ENABLE_ASYNC_API )
+   tFlashFct      flashEraseStartFct;  /**< Function pointer to erase start function */
+   tFlashFct      flashWriteStartFct;  /**< Function pointer to write start function */
+   tFlashFct      flashPollFct;        /**< Function pointer to poll function        */
+#endif /* FLASH_ENABLE_ASYNC_API */
 } tFlashHeader; /* PRQA S 3448 */ /* MD_DrvFlash_3448 */
 
 /* Re-map FCL */
@@ -175,6 +180,11 @@ void ExpFlashSetResetVector ( tFlashParam * flashParam );
 void ExpFlashSetOptionByte ( tFlashParam * flashParam );
 void ExpFlashGetOptionByte ( tFlashParam * flashParam );
 # endif /* FLASH_ENABLE_OPTIONBYTE_API */
+#if defined( FLASH_ENABLE_ASYNC_API )
+void ExpFlashEraseStart ( tFlashParam * flashParam );
+void ExpFlashWriteStart ( tFlashParam * flashParam );
+void ExpFlashPoll ( tFlashParam * flashParam );
+#endif /* FLASH_ENABLE_ASYNC_API */
 
 /***********************************************************************************************************************
  *  LOCAL FUNCTION PROTOTYPES
@@ -188,6 +198,11 @@ void FblDrvFlashRestoreCurFblBasePtr( void ); /* PRQA S 3408 */ /* MD_DrvFlash_3
 tFlashUint8 FblDrvFlashCallWatchdog( tFlashUint8 (* wdTriggerFct)(void) ); /* PRQA S 3408 */ /* MD_DrvFlash_3408_AssemberFunction */
 static tFlashUint8 FblDrvFlashHandleWD( void );
 static tFlashUint8 FblDrvFlashGetBlockByAddr( tFlashUint32 address, volatile tFlashUint32 * block );
+static void FblDrvFlashPrepareErase( tFlashLibRequest * libRequest );
+static void FblDrvFlashPrepareWrite( tFlashLibRequest * libRequest );
+#if defined( FLASH_ENABLE_ASYNC_API )
+static void FblDrvFlashSetAsyncResult( void );
+#endif /* FLASH_ENABLE_ASYNC_API */
 
 /***********************************************************************************************************************
  *  GLOBAL DATA
@@ -204,6 +219,13 @@ BREL NOINIT unsigned int currentFblGP; /* PRQA S 3408 */ /* MD_DrvFlash_3408 */
 BREL NOINIT unsigned int currentFblTP; /* PRQA S 3408 */ /* MD_DrvFlash_3408 */ /* PRQA S 5013 */ /* MD_DrvFlash_5013 */
 BREL NOINIT unsigned int currentFblEP; /* PRQA S 3408 */ /* MD_DrvFlash_3408 */ /* PRQA S 5013 */ /* MD_DrvFlash_5013 */
 
+#if defined( FLASH_ENABLE_ASYNC_API )
+/* Flash library request of pending asynchronous operation */
+BREL NOINIT static tFlashLibRequest asyncRequest;
+/* Routine specific error code of pending asynchronous operation */
+BREL NOINIT static tFlashErrorCode asyncFunction;
+#endif /* FLASH_ENABLE_ASYNC_API */
+
 /* PRQA S 3116 LBL_3116 */ /* MD_DrvFlash_3116 */
 
 # pragma ghs startdata
@@ -227,6 +249,11 @@ const tFlashHeader flashHeader = /* PRQA S 3408 */ /* MD_DrvFlash_3408_tFlashHea
   ,&ExpFlashSetOptionByte
   ,&ExpFlashGetOptionByte
 # endif /* FLASH_ENABLE_OPTIONBYTE_API */
+#if defined( FLASH_ENABLE_ASYNC_API )
+  ,&ExpFlashEraseStart
+  ,&ExpFlashWriteStart
+  ,&ExpFlashPoll
+#endif /* FLASH_ENABLE_ASYNC_API */
 };
 
 # pragma ghs section rodata=default
@@ -419,6 +446,84 @@ static tFlashUint8 FblDrvFlashGetBlockByAddr( tFlashUint32 address, volatile tFl
    return kFlashFailed;
 } /* PRQA S 2006 */ /* MD_CBD_14.7 */
 
+/***********************************************************************************************************************
+ *  FblDrvFlashPrepareErase
+ **********************************************************************************************************************/
+/*! \brief         Set up flash library request for erase operation
+ *  \details       Converts the requested address range into the affected flash blocks. Error code in flash parameter
+ *                 structure is set in case the range could not be resolved.
+ *  \pre           Flash driver Init must be called successfully, pflashParam set to current parameter structure.
+ *  \param[out]    libRequest Flash library request
+ **********************************************************************************************************************/
+static void FblDrvFlashPrepareErase( tFlashLibRequest * libRequest )
+{
+   tFlashUint32 tmpBlock;
+
+   /* Initialize flash error code and error address */
+   pflashParam->errorCode = kFlashOk;
+   pflashParam->errorAddress = pflashParam->address;
+   if (kFlashOk != FblDrvFlashGetBlockByAddr(pflashParam->address, &libRequest->idx_u32))
+   {
+      pflashParam->errorCode = kFlashInvalidAddress;
+   }
+
+   if (kFlashOk != FblDrvFlashGetBlockByAddr(((pflashParam->address - 1u) + pflashParam->length), &tmpBlock))
+   {
+      pflashParam->errorCode = kFlashInvalidAddress;
+   }
+
+   if (kFlashOk == pflashParam->errorCode)
+   {
+      libRequest->command_enu = FLASHLIB_CMD_CODEF_ERASE;
+      libRequest->cnt_u16 = (tFlashUint16)(((tmpBlock + 1u) - libRequest->idx_u32) & 0xFFFFu);
+   }
+}
+
+/***********************************************************************************************************************
+ *  FblDrvFlashPrepareWrite
+ **********************************************************************************************************************/
+/*! \brief         Set up flash library request for write operation
+ *  \pre           Flash driver Init must be called successfully, pflashParam set to current parameter structure.
+ *  \param[out]    libRequest Flash library request
+ **********************************************************************************************************************/
+static void FblDrvFlashPrepareWrite( tFlashLibRequest * libRequest )
+{
+   /* Load current flash position into error address. */
+   pflashParam->errorAddress = pflashParam->address;
+   pflashParam->errorCode = kFlashOk;
+
+   libRequest->command_enu   = FLASHLIB_CMD_CODEF_WRITE;
+   libRequest->bufferAdd_u32 = (tFlashUint32) &(pflashParam->data[0u]); /* PRQA S 306 */ /* MD_DrvFlash_0306 */
+   libRequest->idx_u32       = (tFlashUint32)(pflashParam->address);
+   libRequest->cnt_u16       = (tFlashUint16)((pflashParam->length) >> 8u);
+}
+
+#if defined( FLASH_ENABLE_ASYNC_API )
+/***********************************************************************************************************************
+ *  FblDrvFlashSetAsyncResult
+ **********************************************************************************************************************/
+/*! \brief         Report state of pending asynchronous operation
+ *  \details       Sets the error code of the flash parameter structure to the pending code of the active operation
+ *                 as long as the flash library is busy, afterwards to the final result.
+ *  \pre           Asynchronous operation started, pflashParam set to current parameter structure.
+ **********************************************************************************************************************/
+static void FblDrvFlashSetAsyncResult( void )
+{
+   if (FLASHLIB_BUSY == asyncRequest.status_enu)
+   {
+      pflashParam->errorCode = asyncFunction | kFlashPending;
+   }
+   else if (FLASHLIB_OK != asyncRequest.status_enu)
+   {
+      pflashParam->errorCode = asyncFunction | kFlashFailed | (((tFlashUint16)(asyncRequest.status_enu)) << 8u);
+   }
+   else
+   {
+      pflashParam->errorCode = kFlashOk;
+   }
+}
+#endif /* FLASH_ENABLE_ASYNC_API */
+
 /***********************************************************************************************************************
  *  GLOBAL FUNCTIONS
  **********************************************************************************************************************/
@@ -462,6 +567,11 @@ void ExpFlashInit ( tFlashParam * flashParam )
    flashLibConfig.addrRam_u32         = FLASHLIB_NULL;
 
    flashLibConfig.frequencyCpuMHz_u16 = flashParam->frequencyMHz;
+#if defined( FLASH_ENABLE_ASYNC_API )
+   /* No asynchronous operation pending */
+   asyncRequest.status_enu = FLASHLIB_OK;
+   asyncFunction           = kFlashFctWrite;
+#endif /* FLASH_ENABLE_ASYNC_API */
    /* Initialize flash library */
    libRequest.status_enu = FlashLibInit(&flashLibConfig);
    if (FLASHLIB_OK == libRequest.status_enu)
@@ -550,7 +660,6 @@ void ExpFlashDeinit ( tFlashParam * flashParam )
 void ExpFlashErase ( tFlashParam * flashParam )
 {
    tFlashLibRequest libRequest; /* Command structure to access flash library */
-   tFlashUint32 tmpBlock;
 
    /* Switch to the current valid base pointer(s) */
    FblDrvFlashSaveCurFblBasePtr();
@@ -559,24 +668,11 @@ void ExpFlashErase ( tFlashParam * flashParam )
    /* Store the location of flashStruct */
    pflashParam = flashParam;
 
-   /* Initialize flash error code and error address */
-   flashParam->errorCode = kFlashOk;
-   flashParam->errorAddress = flashParam->address;
-   if (kFlashOk != FblDrvFlashGetBlockByAddr(pflashParam->address, &libRequest.idx_u32))
-   {
-      pflashParam->errorCode = kFlashInvalidAddress;
-   }
-
-   if (kFlashOk != FblDrvFlashGetBlockByAddr(((pflashParam->address - 1u) + pflashParam->length), &tmpBlock))
-   {
-      pflashParam->errorCode = kFlashInvalidAddress;
-   }
+   /* Determine affected flash blocks */
+   FblDrvFlashPrepareErase(&libRequest);
 
    if (pflashParam->errorCode == kFlashOk)
    {
-      libRequest.command_enu = FLASHLIB_CMD_CODEF_ERASE;
-      libRequest.cnt_u16 = (tFlashUint16)(((tmpBlock + 1u) - libRequest.idx_u32) & 0xFFFFu);
-
       FlashLibExecute(&libRequest);
       while (FLASHLIB_BUSY == libRequest.status_enu)
       {
@@ -616,14 +712,9 @@ void ExpFlashWrite ( tFlashParam * flashParam )
 
    /* Store the location of flashStruct */
    pflashParam = flashParam;
-   /* Load current flash position into error address. */
-   flashParam->errorAddress = flashParam->address;
-   flashParam->errorCode = kFlashOk;
 
-   libRequest.command_enu   = FLASHLIB_CMD_CODEF_WRITE;
-   libRequest.bufferAdd_u32 = (tFlashUint32) &(pflashParam->data[0u]); /* PRQA S 306 */ /* MD_DrvFlash_0306 */
-   libRequest.idx_u32       = (tFlashUint32)(pflashParam->address);
-   libRequest.cnt_u16       = (tFlashUint16)((pflashParam->length) >> 8u);
+   /* Set up write request */
+   FblDrvFlashPrepareWrite(&libRequest);
 
    FlashLibExecute(&libRequest);
    while (FLASHLIB_BUSY == libRequest.status_enu)
@@ -645,6 +736,117 @@ void ExpFlashWrite ( tFlashParam * flashParam )
    FblDrvFlashRestoreCurFblBasePtr();
 }
 
+#if defined( FLASH_ENABLE_ASYNC_API )
+/***********************************************************************************************************************
+ *  ExpFlashEraseStart
+ **********************************************************************************************************************/
+/*! \brief         Flash driver erase start function
+ *  \details       This function starts the erase of a given flash area and returns without waiting for completion.
+ *                 As long as the operation is in progress kFlashErasePending is reported, completion has to be
+ *                 polled by ExpFlashPoll.
+ *  \pre           Flash driver initialized, no other asynchronous operation pending.
+ *  \param[in,out] flashParam Flash parameter structure
+ **********************************************************************************************************************/
+void ExpFlashEraseStart ( tFlashParam * flashParam )
+{
+   /* Switch to the current valid base pointer(s) */
+   FblDrvFlashSaveCurFblBasePtr();
+   FblDrvFlashSetCurFlashDrvBasePtr();
+
+   /* Store the location of flashStruct */
+   pflashParam = flashParam;
+
+   if (FLASHLIB_BUSY == asyncRequest.status_enu)
+   {
+      /* Previous operation still in progress */
+      flashParam->errorCode = kFlashEraseSequence;
+   }
+   else
+   {
+      /* Determine affected flash blocks */
+      FblDrvFlashPrepareErase(&asyncRequest);
+
+      if (pflashParam->errorCode == kFlashOk)
+      {
+         asyncFunction = kFlashFctErase;
+         FlashLibExecute(&asyncRequest);
+         FblDrvFlashSetAsyncResult();
+      }
+   }
+
+   /* Switch back to the context of the FBL */
+   FblDrvFlashRestoreCurFblBasePtr();
+}
+
+/***********************************************************************************************************************
+ *  ExpFlashWriteStart
+ **********************************************************************************************************************/
+/*! \brief         Flash driver write start function
+ *  \details       This function starts writing data to flash memory and returns without waiting for completion.
+ *                 As long as the operation is in progress kFlashWritePending is reported, completion has to be
+ *                 polled by ExpFlashPoll. The data buffer has to remain unchanged until the operation is finished.
+ *  \pre           Flash driver initialized, write area has to be erased, no other asynchronous operation pending.
+ *  \param[in,out] flashParam Flash parameter structure
+ **********************************************************************************************************************/
+void ExpFlashWriteStart ( tFlashParam * flashParam )
+{
+   /* Switch to the current valid base pointer(s) */
+   FblDrvFlashSaveCurFblBasePtr();
+   FblDrvFlashSetCurFlashDrvBasePtr();
+
+   /* Store the location of flashStruct */
+   pflashParam = flashParam;
+
+   if (FLASHLIB_BUSY == asyncRequest.status_enu)
+   {
+      /* Previous operation still in progress */
+      flashParam->errorCode = kFlashWriteSequence;
+   }
+   else
+   {
+      /* Set up write request */
+      FblDrvFlashPrepareWrite(&asyncRequest);
+
+      asyncFunction = kFlashFctWrite;
+      FlashLibExecute(&asyncRequest);
+      FblDrvFlashSetAsyncResult();
+   }
+
+   /* Switch back to the context of the FBL */
+   FblDrvFlashRestoreCurFblBasePtr();
+}
+
+/***********************************************************************************************************************
+ *  ExpFlashPoll
+ **********************************************************************************************************************/
+/*! \brief         Flash driver poll function
+ *  \details       This function performs a single handler step of the pending asynchronous operation and reports
+ *                 its state: kFlashErasePending or kFlashWritePending while still in progress, the final result
+ *                 otherwise. Calling the function without a pending operation reports the result of the last one.
+ *  \pre           Flash driver initialized.
+ *  \param[in,out] flashParam Flash parameter structure
+ **********************************************************************************************************************/
+void ExpFlashPoll ( tFlashParam * flashParam )
+{
+   /* Switch to the current valid base pointer(s) */
+   FblDrvFlashSaveCurFblBasePtr();
+   FblDrvFlashSetCurFlashDrvBasePtr();
+
+   /* Store the location of flashStruct */
+   pflashParam = flashParam;
+
+   if (FLASHLIB_BUSY == asyncRequest.status_enu)
+   {
+      FlashLibHandler();
+   }
+
+   FblDrvFlashSetAsyncResult();
+
+   /* Switch back to the context of the FBL */
+   FblDrvFlashRestoreCurFblBasePtr();
+}
+#endif /* FLASH_ENABLE_ASYNC_API */
+
 #if defined( FLASH_ENABLE_SET_RESETVECTOR_API )
 /***********************************************************************************************************************
  *  ExpFlashSetResetVector
@@ -72,10 +72,17 @@
 # define FLASH_DRIVER_SET_RESET_VECTOR_INTERFACE   0x00u
 #endif /* FLASH_ENABLE_SET_RESETVECTOR_API */
 
+#if defined( FLASH_ENABLE_ASYNC_API )
+/* Different interface version if asynchronous write and erase API is supported */
+# define FLASH_DRIVER_ASYNC_INTERFACE              0x40u
+#else
+# define FLASH_DRIVER_ASYNC_INTERFACE              0x00u
+#endif /* FLASH_ENABLE_ASYNC_API */
+
 /* Flash driver specific version information */
 #define FLASH_DRIVER_VERSION_MCUTYPE      0x86u       /**< MCU-Type definition for flash interface */
 #define FLASH_DRIVER_VERSION_MASKTYPE     0x00u       /**< Mask type definition                    */
-# define FLASH_DRIVER_VERSION_INTERFACE   (0x02u | FLASH_DRIVER_SET_RESET_VECTOR_INTERFACE) /**< Flash driver interface version          */
+# define FLASH_DRIVER_VERSION_INTERFACE   (0x02u | FLASH_DRIVER_SET_RESET_VECTOR_INTERFACE | FLASH_DRIVER_ASYNC_INTERFACE) /**< Flash driver interface version          */
 #define FLASH_DRIVER_VERSION_MAJOR        (tFlashUint8)(FBLDRVFLASH_RH850RV40HIS_VERSION >> 8u)
 #define FLASH_DRIVER_VERSION_MINOR        (tFlashUint8)(FBLDRVFLASH_RH850RV40HIS_VERSION & 0xFFu)
 #define FLASH_DRIVER_VERSION_PATCH        (tFlashUint8)(FBLDRVFLASH_RH850RV40HIS_RELEASE_VERSION)
@@ -107,6 +114,19 @@
 #  define FLASH_DRIVER_SETOPB_OFFSET    (FLASH_DRIVER_HEADER_OFFSET + 0x10u)
 #  define FLASH_DRIVER_GETOPB_OFFSET    (FLASH_DRIVER_HEADER_OFFSET + 0x14u)
 # endif
+#if defined( FLASH_ENABLE_ASYNC_API )
+/* Asynchronous API is located behind all other optional functions */
+# if defined( FLASH_ENABLE_OPTIONBYTE_API )
+#  define FLASH_DRIVER_ASYNC_OFFSET     (FLASH_DRIVER_GETOPB_OFFSET + 0x04u)
+# elif defined( FLASH_ENABLE_SET_RESETVECTOR_API )
+#  define FLASH_DRIVER_ASYNC_OFFSET     (FLASH_DRIVER_SETRESVEC_OFFSET + 0x04u)
+# else
+#  define FLASH_DRIVER_ASYNC_OFFSET     (FLASH_DRIVER_WRITE_OFFSET + 0x04u)
+# endif
+# define FLASH_DRIVER_ERASE_START_OFFSET (FLASH_DRIVER_ASYNC_OFFSET + 0x00u)  /**< Flash driver erase start function */
+# define FLASH_DRIVER_WRITE_START_OFFSET (FLASH_DRIVER_ASYNC_OFFSET + 0x04u)  /**< Flash driver write start function */
+# define FLASH_DRIVER_POLL_OFFSET        (FLASH_DRIVER_ASYNC_OFFSET + 0x08u)  /**< Flash driver poll function        */
+#endif /* FLASH_ENABLE_ASYNC_API */
 
 /* Defines to access version and type information */
 #define FLASH_DRIVER_MCUTYPE(flashCode)      (*(tFlashUint8*)((flashCode) + 3u)) /* PRQA S 3453 */ /* MD_MSR_19.7 */
@@ -131,6 +151,7 @@
 #define kFlashAcc                      ((tFlashErrorCode)0x08u)               /**< Flash access error                */
 #define kFlashInvalidVersion           ((tFlashErrorCode)0x09u)               /**< Invalid version                   */
 #define kFlashSequence                 ((tFlashErrorCode)0x0Au)               /**< Sequence error                    */
+#define kFlashPending                  ((tFlashErrorCode)0x0Bu)               /**< Operation still in progress       */
 
 /* Flash init error codes */
 #define kFlashInitFailed               (kFlashFctInit|kFlashFailed)
@@ -152,6 +173,7 @@
 #define kFlashEraseSequence            (kFlashFctErase|kFlashSequence)
 #define kFlashEraseAcc                 (kFlashFctErase|kFlashAcc)
 #define kFlashEraseCmdBufFull          (kFlashFctErase|kFlashCmdBufFull)
+#define kFlashErasePending             (kFlashFctErase|kFlashPending)
 
 /* Flash write error codes */
 #define kFlashWriteFailed              (kFlashFctWrite|kFlashFailed)
@@ -162,6 +184,7 @@
 #define kFlashWriteSequence            (kFlashFctWrite|kFlashSequence)
 #define kFlashWriteAcc                 (kFlashFctWrite|kFlashAcc)
 #define kFlashWriteCmdBufFull          (kFlashFctWrite|kFlashCmdBufFull)
+#define kFlashWritePending             (kFlashFctWrite|kFlashPending)
 
 /* Function call macros */
 /** Flash write function */
@@ -196,6 +219,20 @@
    ((tFlashFct)(*(tFlashUint32 *)&(flashCode)[FLASH_DRIVER_GETOPB_OFFSET]))(flashParam)  /* PRQA S 3453 */ /* MD_MSR_19.7 */
 # endif  /* FLASH_ENABLE_OPTIONBYTE_API */
 
+#if defined( FLASH_ENABLE_ASYNC_API )
+/** Flash erase start function */
+# define FLASH_DRIVER_ERASE_START(flashCode, flashParam)\
+   ((tFlashFct)(*(tFlashUint32 *)&(flashCode)[FLASH_DRIVER_ERASE_START_OFFSET]))(flashParam) /* PRQA S 3453 */ /* MD_MSR_19.7 */
+
+/** Flash write start function */
+# define FLASH_DRIVER_WRITE_START(flashCode, flashParam)\
+   ((tFlashFct)(*(tFlashUint32 *)&(flashCode)[FLASH_DRIVER_WRITE_START_OFFSET]))(flashParam) /* PRQA S 3453 */ /* MD_MSR_19.7 */
+
+/** Flash poll function */
+# define FLASH_DRIVER_POLL(flashCode, flashParam)\
+   ((tFlashFct)(*(tFlashUint32 *)&(flashCode)[FLASH_DRIVER_POLL_OFFSET]))(flashParam) /* PRQA S 3453 */ /* MD_MSR_19.7 */
+#endif /* FLASH_ENABLE_ASYNC_API */
+
 /***********************************************************************************************************************
  *  GLOBAL DATA TYPES AND STRUCTURES
  **********************************************************************************************************************/
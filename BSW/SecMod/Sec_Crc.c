@@ -81,6 +81,28 @@
 # define CRC_INDEX_MASK    0xFFul
 /** Size of lookup table */
 # define CRC_TABLE_SIZE    256u
+/** Number of lookup tables */
+# define CRC_SLICE_COUNT   1u
+#elif ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
+/* Eight large lookup tables in RAM */
+/** Number of bits used to index entries */
+# define CRC_INDEX_BITS    8u
+/** Mask for table indices */
+# define CRC_INDEX_MASK    0xFFul
+/** Size of single lookup table */
+# define CRC_TABLE_SIZE    256u
+/** Number of lookup tables, equals number of bytes processed per slice */
+# define CRC_SLICE_COUNT   8u
+/** Mask to check word alignment of input data */
+# define CRC_ALIGN_MASK    0x03ul
+#elif ( SEC_CRC_OPT == SEC_CRC_ROM_OPTIMIZED )
+/* Large lookup table in ROM */
+/** Number of bits used to index entries */
+# define CRC_INDEX_BITS    8u
+/** Mask for table indices */
+# define CRC_INDEX_MASK    0xFFul
+/** Size of lookup table */
+# define CRC_TABLE_SIZE    256u
 #elif ( SEC_CRC_OPT == SEC_CRC_SIZE_OPTIMIZED )
 /* Small lookup table in ROM */
 /** Number of bits used to index entries */
@@ -121,6 +143,37 @@
 # define SEC_CRC_32_INIT_PATTERN    0xC2C3274Bul
 #endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
 
+#if ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED ) || \
+    ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
+/** Total number of entries in RAM lookup table(s) */
+# define CRC_LOOKUP_SIZE   (CRC_TABLE_SIZE * CRC_SLICE_COUNT)
+/** Access entry of lookup table for given slice */
+# define CRC_LOOKUP_ENTRY(slice, index)   lookupCrc32[((slice) * CRC_TABLE_SIZE) + (index)]
+#endif /* SEC_CRC_OPT */
+
+#if ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
+# if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
+/* Read four input bytes in processing order of the CRC algorithm (first byte located at least significant byte for
+   reflected mode, at most significant byte for non-reflected mode). Direct word access is used where the CPU byte
+   order matches, otherwise the word is assembled byte-wise */
+#  if ( SEC_CRC_32_MODE == SEC_CRC_MODE_NON_REFLECTED )
+#   if defined( C_CPUTYPE_BIGENDIAN )
+#    define CRC_32_GET_WORD(ptr)  (*(const V_MEMRAM1 SecM_WordType V_MEMRAM2 V_MEMRAM3 *)(ptr))
+#   else
+#    define CRC_32_GET_WORD(ptr)  (((SecM_WordType)(ptr)[0u] << 24u) | ((SecM_WordType)(ptr)[1u] << 16u) | \
+                                   ((SecM_WordType)(ptr)[2u] <<  8u) |  (SecM_WordType)(ptr)[3u])
+#   endif /* C_CPUTYPE_BIGENDIAN */
+#  else /* SEC_CRC_32_MODE == SEC_CRC_MODE_REFLECTED */
+#   if defined( C_CPUTYPE_LITTLEENDIAN )
+#    define CRC_32_GET_WORD(ptr)  (*(const V_MEMRAM1 SecM_WordType V_MEMRAM2 V_MEMRAM3 *)(ptr))
+#   else
+#    define CRC_32_GET_WORD(ptr)  (((SecM_WordType)(ptr)[3u] << 24u) | ((SecM_WordType)(ptr)[2u] << 16u) | \
+                                   ((SecM_WordType)(ptr)[1u] <<  8u) |  (SecM_WordType)(ptr)[0u])
+#   endif /* C_CPUTYPE_LITTLEENDIAN */
+#  endif /* SEC_CRC_32_MODE */
+# endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
+#endif /* SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED */
+
 #if defined( SEC_ENABLE_CRC_STRUCT_TYPE )
 # define SEC_INITIAL_VAL(val)       { 0x00ul, (val) }
 # define SEC_GET_BASE_CRC(crc)      ((crc).lowWord)
@@ -129,24 +182,37 @@
 # define SEC_GET_BASE_CRC(crc)      (crc)
 #endif /* SEC_ENABLE_CRC_STRUCT_TYPE */
 
-#if ( SEC_CRC_OPT == SEC_CRC_SIZE_OPTIMIZED )
-/* Macros for compile-time generation of small lookup table in ROM */
+#if ( SEC_CRC_OPT == SEC_CRC_SIZE_OPTIMIZED ) || \
+    ( SEC_CRC_OPT == SEC_CRC_ROM_OPTIMIZED )
+/* Macros for compile-time generation of lookup table in ROM */
 
 # if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
 #  if ( SEC_CRC_32_MODE == SEC_CRC_MODE_NON_REFLECTED )
 /** Update CRC-32 value according to next input bit */
 #   define CRC_32_BIT(in)        ((((in) & 0x7FFFFFFFul) << 1u) ^ ((((in) >> 31u) & 0x01u) * SEC_CRC_32_POLYNOMIAL))
+#   if ( SEC_CRC_OPT == SEC_CRC_SIZE_OPTIMIZED )
+/** Calculate CRC-32 table entry for given input index */
+#    define CRC_32_CALC(in)      CRC_32_NIBBLE(((in) & 0x0Ful) << 28u)
+#   else /* SEC_CRC_OPT == SEC_CRC_ROM_OPTIMIZED */
 /** Calculate CRC-32 table entry for given input index */
-#   define CRC_32_CALC(in)       CRC_32_NIBBLE(((in) & 0x0Ful) << 28u)
+#    define CRC_32_CALC(in)      CRC_32_BYTE(((in) & 0xFFul) << 24u)
+#   endif /* SEC_CRC_OPT */
 #  else /* SEC_CRC_32_MODE == SEC_CRC_MODE_REFLECTED */
 /** Update CRC-32 value according to next input bit */
 #   define CRC_32_BIT(in)        (((in) >> 1u) ^ (((in) & 0x01u) * SEC_CRC_32_POLYNOMIAL))
+#   if ( SEC_CRC_OPT == SEC_CRC_SIZE_OPTIMIZED )
 /** Calculate CRC-32 table entry for given input index */
-#   define CRC_32_CALC(in)       CRC_32_NIBBLE((in))
+#    define CRC_32_CALC(in)      CRC_32_NIBBLE((in))
+#   else /* SEC_CRC_OPT == SEC_CRC_ROM_OPTIMIZED */
+/** Calculate CRC-32 table entry for given input index */
+#    define CRC_32_CALC(in)      CRC_32_BYTE((in))
+#   endif /* SEC_CRC_OPT */
 #  endif /* SEC_CRC_32_MODE */
 
 /** Calculate entry for CRC-32 calculation table based on 4-bit algorithm */
 #  define CRC_32_NIBBLE(in)      (CRC_32_BIT(CRC_32_BIT(CRC_32_BIT(CRC_32_BIT(in)))))
+/** Calculate entry for CRC-32 calculation table based on 8-bit algorithm */
+#  define CRC_32_BYTE(in)        (CRC_32_NIBBLE(CRC_32_NIBBLE(in)))
 
 /** Calculate 4 entries of CRC-32 calculation table */
 #  define CRC_32_ENTRIES_4(i)    \
@@ -161,9 +227,23 @@
    CRC_32_ENTRIES_4((i) + 4u),   \
    CRC_32_ENTRIES_4((i) + 8u),   \
    CRC_32_ENTRIES_4((i) + 12u)
+
+/** Calculate 64 entries of CRC-32 calculation table */
+#  define CRC_32_ENTRIES_64(i)   \
+   CRC_32_ENTRIES_16((i)),       \
+   CRC_32_ENTRIES_16((i) + 16u), \
+   CRC_32_ENTRIES_16((i) + 32u), \
+   CRC_32_ENTRIES_16((i) + 48u)
+
+/** Calculate 256 entries of CRC-32 calculation table */
+#  define CRC_32_ENTRIES_256(i)  \
+   CRC_32_ENTRIES_64((i)),       \
+   CRC_32_ENTRIES_64((i) + 64u), \
+   CRC_32_ENTRIES_64((i) + 128u),\
+   CRC_32_ENTRIES_64((i) + 192u)
 # endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
 
-#endif /* SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED */
+#endif /* SEC_CRC_OPT */
 
 /* PRQA L:TAG_SecCrc_3453_1 */
 
@@ -171,11 +251,18 @@
  *  LOCAL FUNCTION PROTOTYPES
  *********************************************************************************************************************/
 
-#if ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED )
+#if ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED ) || \
+    ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
 # if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
 static void SecM_GenerateLookupCrc32( FL_WDTriggerFctType pWatchdog );
 # endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
-#endif /* SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED */
+#endif /* SEC_CRC_OPT */
+
+#if ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
+# if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
+static SecM_Crc32Type SecM_UpdateCrc32Byte( SecM_Crc32Type crc, SecM_ByteType data );
+# endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
+#endif /* SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED */
 
 #if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
 static void SecM_UpdateCrc32( V_MEMRAM1 SecM_CRCParamType V_MEMRAM2 V_MEMRAM2 * pCrcParam );
@@ -195,11 +282,21 @@ V_MEMROM0 static V_MEMROM1 SecM_Crc32Type V_MEMROM2 lookupCrc32[CRC_TABLE_SIZE]
    CRC_32_ENTRIES_16(0x00u)
 };
 # endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
-#elif ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED )
-/* For speed optimization, the CRC table is dynamically generated in RAM */
+#elif ( SEC_CRC_OPT == SEC_CRC_ROM_OPTIMIZED )
+/* Table is generated at compile time, no initialization required before first CRC calculation */
 # if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
 /** CRC-32 calculation table based on 8-bit algorithm */
-V_MEMRAM0 static V_MEMRAM1 SecM_Crc32Type V_MEMRAM2 lookupCrc32[CRC_TABLE_SIZE + 1u];
+V_MEMROM0 static V_MEMROM1 SecM_Crc32Type V_MEMROM2 lookupCrc32[CRC_TABLE_SIZE] =
+{
+   CRC_32_ENTRIES_256(0x00u)
+};
+# endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
+#elif ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED ) || \
+      ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
+/* For speed optimization, the CRC table is dynamically generated in RAM */
+# if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
+/** CRC-32 calculation table(s) based on 8-bit algorithm, followed by initialization marker */
+V_MEMRAM0 static V_MEMRAM1 SecM_Crc32Type V_MEMRAM2 lookupCrc32[CRC_LOOKUP_SIZE + 1u];
 # endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
 
 #endif /* SEC_CRC_OPT */
@@ -222,13 +319,15 @@ V_MEMROM0 V_MEMROM1 SecM_CRCType          V_MEMROM2 secCrcZeroValue     = SEC_IN
  *  LOCAL FUNCTIONS
  *********************************************************************************************************************/
 
-#if ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED )
+#if ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED ) || \
+    ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
 
 # if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
 /***********************************************************************************************************************
  *  SecM_GenerateLookupCrc32
  **********************************************************************************************************************/
-/*! \brief       Generates the CRC-32 lookup table
+/*! \brief       Generates the CRC-32 lookup table(s)
+ *  \details     In slicing mode the tables for the additional slices are derived from the basic table
  *  \param[in]   pWatchdog Pointer to watchdog trigger function
  **********************************************************************************************************************/
 static void SecM_GenerateLookupCrc32( FL_WDTriggerFctType pWatchdog )
@@ -237,6 +336,9 @@ static void SecM_GenerateLookupCrc32( FL_WDTriggerFctType pWatchdog )
    SecM_ShortFastType   tableIndex;
    SecM_ByteFastType    bitIndex;
    SecM_Crc32Type       crc;
+#  if ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
+   SecM_ByteFastType    sliceIndex;
+#  endif /* SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED */
 
    /* Fill lookup table */
    for (tableIndex = 0u; tableIndex < CRC_TABLE_SIZE; tableIndex++)
@@ -285,14 +387,135 @@ static void SecM_GenerateLookupCrc32( FL_WDTriggerFctType pWatchdog )
       lookupCrc32[tableIndex] = crc;
    }
 
+#  if ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
+   /* Each entry of a slice table equals the entry of the previous slice table updated by an additional zero byte */
+   for (sliceIndex = 1u; sliceIndex < CRC_SLICE_COUNT; sliceIndex++)
+   {
+      for (tableIndex = 0u; tableIndex < CRC_TABLE_SIZE; tableIndex++)
+      {
+         /* Serve watchdog (every n-th cycle) */
+         SEC_WATCHDOG_CYCLE_TRIGGER(pWatchdog, tableIndex); /* PRQA S 3109 */ /* MD_MSR_14.3 */
+
+         crc = CRC_LOOKUP_ENTRY(sliceIndex - 1u, tableIndex);
+         CRC_LOOKUP_ENTRY(sliceIndex, tableIndex) = SecM_UpdateCrc32Byte(crc, 0x00u);
+      }
+   }
+#  endif /* SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED */
+
    /* Mark table as initialized by setting magic value */
-   lookupCrc32[CRC_TABLE_SIZE] = SEC_CRC_32_INIT_PATTERN;
+   lookupCrc32[CRC_LOOKUP_SIZE] = SEC_CRC_32_INIT_PATTERN;
 }
 # endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
 
-#endif /* SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED */
+#endif /* SEC_CRC_OPT */
+
+#if ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
+# if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
+/***********************************************************************************************************************
+ *  SecM_UpdateCrc32Byte
+ **********************************************************************************************************************/
+/*! \brief       Updates the CRC-32 value by a single data byte using the basic lookup table
+ *  \param[in]   crc Current CRC value
+ *  \param[in]   data Data byte
+ *  \return      Updated CRC value
+ **********************************************************************************************************************/
+static SecM_Crc32Type SecM_UpdateCrc32Byte( SecM_Crc32Type crc, SecM_ByteType data )
+{
+   SecM_ShortFastType tableIndex;
+
+#  if ( SEC_CRC_32_MODE == SEC_CRC_MODE_NON_REFLECTED )
+   tableIndex  = (SecM_ShortFastType)((data ^ (crc >> (32u - CRC_INDEX_BITS))) & CRC_INDEX_MASK);
+   return (SecM_Crc32Type)((crc << CRC_INDEX_BITS) ^ lookupCrc32[tableIndex]);
+#  else /* SEC_CRC_32_MODE == SEC_CRC_MODE_REFLECTED */
+   tableIndex  = (SecM_ShortFastType)((data ^ crc) & CRC_INDEX_MASK);
+   return (SecM_Crc32Type)((crc >> CRC_INDEX_BITS) ^ lookupCrc32[tableIndex]);
+#  endif /* SEC_CRC_32_MODE */
+}
+# endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
+#endif /* SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED */
 
 #if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
+# if ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
+/***********************************************************************************************************************
+ *  SecM_UpdateCrc32
+ **********************************************************************************************************************/
+/*! \brief       Computes the CRC upon the given data buffer
+ *  \details     Slicing-by-8 algorithm: Data is processed in slices of eight bytes using word aligned accesses.
+ *               Unaligned leading bytes and trailing bytes are processed byte-wise. Watchdog is served per slice.
+ *  \param[in,out] crcParam Pointer to parameter structure
+ **********************************************************************************************************************/
+static void SecM_UpdateCrc32( V_MEMRAM1 SecM_CRCParamType V_MEMRAM2 V_MEMRAM2 * pCrcParam )
+{
+   SecM_ConstRamDataType   pSource;       /* Pointer to current source data */
+   SecM_LengthFastType     byteCount;
+   SecM_LengthFastType     sliceIndex;    /* Number of processed slices */
+   SecM_Crc32Type          tmpCrc;
+   SecM_WordType           firstWord;
+   SecM_WordType           secondWord;
+   FL_WDTriggerFctType     pWatchdog;
+
+   /* Operate on local copy of CRC */
+   tmpCrc      = (SecM_Crc32Type)SEC_GET_BASE_CRC(pCrcParam->currentCRC);
+   byteCount   = pCrcParam->crcByteCount;
+   pWatchdog   = pCrcParam->wdTriggerFct;
+   pSource     = pCrcParam->crcSourceBuffer;
+   sliceIndex  = 0u;
+
+   /* Process leading bytes until source data is word aligned */
+   while ((byteCount > 0u) && ((((SecM_WordType)(unsigned long)pSource) & CRC_ALIGN_MASK) != 0u)) /* PRQA S 0306 */ /* MD_SecCrc_0306 */
+   {
+      tmpCrc = SecM_UpdateCrc32Byte(tmpCrc, *pSource);
+      pSource++; /* PRQA S 0489 */ /* MD_SecCrc_0489 */
+      byteCount--;
+   }
+
+   /* Loop all complete slices */
+   while (byteCount >= CRC_SLICE_COUNT)
+   {
+      /* Serve watchdog (every n-th slice) */
+      SEC_WATCHDOG_CYCLE_TRIGGER(pWatchdog, sliceIndex); /* PRQA S 3109 */ /* MD_MSR_14.3 */
+      sliceIndex++;
+
+      /* Read slice as two aligned words, CRC is folded into first word */
+      firstWord   = (SecM_WordType)(CRC_32_GET_WORD(&pSource[0u]) ^ tmpCrc); /* PRQA S 0310 */ /* MD_SecCrc_0310 */
+      secondWord  = CRC_32_GET_WORD(&pSource[4u]); /* PRQA S 0310 */ /* MD_SecCrc_0310 */
+
+#  if ( SEC_CRC_32_MODE == SEC_CRC_MODE_NON_REFLECTED )
+      tmpCrc   = CRC_LOOKUP_ENTRY(7u, (firstWord  >> 24u) & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(6u, (firstWord  >> 16u) & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(5u, (firstWord  >>  8u) & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(4u,  firstWord          & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(3u, (secondWord >> 24u) & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(2u, (secondWord >> 16u) & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(1u, (secondWord >>  8u) & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(0u,  secondWord         & CRC_INDEX_MASK);
+#  else /* SEC_CRC_32_MODE == SEC_CRC_MODE_REFLECTED */
+      tmpCrc   = CRC_LOOKUP_ENTRY(7u,  firstWord          & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(6u, (firstWord  >>  8u) & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(5u, (firstWord  >> 16u) & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(4u, (firstWord  >> 24u) & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(3u,  secondWord         & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(2u, (secondWord >>  8u) & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(1u, (secondWord >> 16u) & CRC_INDEX_MASK)
+               ^ CRC_LOOKUP_ENTRY(0u, (secondWord >> 24u) & CRC_INDEX_MASK);
+#  endif /* SEC_CRC_32_MODE */
+
+      pSource     = &pSource[CRC_SLICE_COUNT];
+      byteCount  -= CRC_SLICE_COUNT;
+   }
+
+   /* Process trailing bytes */
+   while (byteCount > 0u)
+   {
+      tmpCrc = SecM_UpdateCrc32Byte(tmpCrc, *pSource);
+      pSource++; /* PRQA S 0489 */ /* MD_SecCrc_0489 */
+      byteCount--;
+   }
+
+   /* Update external CRC value */
+   SEC_GET_BASE_CRC(pCrcParam->currentCRC) = tmpCrc;
+}
+# else
 /***********************************************************************************************************************
  *  SecM_UpdateCrc32
  **********************************************************************************************************************/
@@ -347,6 +570,7 @@ static void SecM_UpdateCrc32( V_MEMRAM1 SecM_CRCParamType V_MEMRAM2 V_MEMRAM2 *
    /* Update external CRC value */
    SEC_GET_BASE_CRC(pCrcParam->currentCRC) = tmpCrc;
 }
+# endif /* SEC_CRC_OPT */
 #endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
 
 /**********************************************************************************************************************
@@ -360,12 +584,13 @@ static void SecM_UpdateCrc32( V_MEMRAM1 SecM_CRCParamType V_MEMRAM2 V_MEMRAM2 *
  *********************************************************************************************************************/
 void SecM_InitPowerOnCRC( void )
 {
-#if ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED )
+#if ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED ) || \
+    ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
    /* Mark lookup table as potentially uninitialized */
 # if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
-   lookupCrc32[CRC_TABLE_SIZE] = SEC_CRC_32_UNINIT_PATTERN;
+   lookupCrc32[CRC_LOOKUP_SIZE] = SEC_CRC_32_UNINIT_PATTERN;
 # endif /* SEC_ENABLE_CRC_TYPE_CRC32 */
-#endif /* SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED */
+#endif /* SEC_CRC_OPT */
 }
 
 /***********************************************************************************************************************
@@ -407,14 +632,15 @@ SecM_StatusType SecM_ComputeCrc32( V_MEMRAM1 SecM_CRCParamType V_MEMRAM2 V_MEMRA
    {
       case SEC_CRC_INIT:
       {
-# if ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED )
+# if ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED ) || \
+     ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
          /* Check magic value to verify whether lookup table was already initialized */
-         if (SEC_CRC_32_INIT_PATTERN != lookupCrc32[CRC_TABLE_SIZE])
+         if (SEC_CRC_32_INIT_PATTERN != lookupCrc32[CRC_LOOKUP_SIZE])
          {
             /* Initialize lookup table in RAM */
             SecM_GenerateLookupCrc32(crcParam->wdTriggerFct);
          }
-# endif /* SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED */
+# endif /* SEC_CRC_OPT */
 
          /* Set initial CRC value */
          crcParam->currentCRC = initialValueCrc32;
@@ -498,9 +724,11 @@ SecM_StatusType SecM_ComputeCrc32( V_MEMRAM1 SecM_CRCParamType V_MEMRAM2 V_MEMRA
 #endif
 
 #if ( SEC_CRC_OPT == SEC_CRC_SPEED_OPTIMIZED ) || \
-    ( SEC_CRC_OPT == SEC_CRC_SIZE_OPTIMIZED )
+    ( SEC_CRC_OPT == SEC_CRC_SIZE_OPTIMIZED )  || \
+    ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED ) || \
+    ( SEC_CRC_OPT == SEC_CRC_ROM_OPTIMIZED )
 #else
-# error "Error in configuration: Either SEC_CRC_SPEED_OPTIMIZED or SEC_CRC_SIZE_OPTIMIZED must be defined"
+# error "Error in configuration: Either SEC_CRC_SPEED_OPTIMIZED, SEC_CRC_SIZE_OPTIMIZED, SEC_CRC_SLICE_OPTIMIZED or SEC_CRC_ROM_OPTIMIZED must be defined"
 #endif
 
 /**********************************************************************************************************************
@@ -509,6 +737,22 @@ SecM_StatusType SecM_ComputeCrc32( V_MEMRAM1 SecM_CRCParamType V_MEMRAM2 V_MEMRA
 
 /* Module specific MISRA deviations:
 
+   MD_SecCrc_0306:
+      Reason: Pointer is cast to integral type to check the alignment of the source data.
+      Risk: Size of integer required to hold the pointer value is implementation defined.
+      Prevention: Only the lower address bits are evaluated.
+
+   MD_SecCrc_0310:
+      Reason: Source data is read word-wise for runtime optimization. Alignment of the source pointer is ensured
+              before the word access.
+      Risk: Misaligned access in case alignment check is removed.
+      Prevention: Code inspection.
+
+   MD_SecCrc_0489:
+      Reason: Pointer arithmetic used for efficient iteration of the source data.
+      Risk: Access outside of the source buffer.
+      Prevention: Iteration is limited by the given byte count.
+
    MD_SecCrc_3218:
       Reason: The configuration constants of this module are kept at a central location for a better overview and maintenance.
       Scope is larger than required (whole file instead of one function).
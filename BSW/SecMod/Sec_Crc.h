@@ -105,6 +105,18 @@
 #  define SEC_CRC_TYPE     SEC_CRC32
 #endif /* SEC_CRC_TYPE */
 
+#if defined( SEC_CRC_SLICE_OPTIMIZED )
+#else
+/** CRC optimization: Slicing-by-8 algorithm, eight lookup tables generated in RAM */
+#  define SEC_CRC_SLICE_OPTIMIZED  2u
+#endif /* SEC_CRC_SLICE_OPTIMIZED */
+
+#if defined( SEC_CRC_ROM_OPTIMIZED )
+#else
+/** CRC optimization: Large lookup table generated at compile time in ROM */
+#  define SEC_CRC_ROM_OPTIMIZED    3u
+#endif /* SEC_CRC_ROM_OPTIMIZED */
+
 /*********************************************************************************************************************/
 
 /* Remap compile-time switches */
@@ -183,6 +183,21 @@
  *  - On word-addressed platforms twice the number of requested bytes is read */
 # define SEC_MEMORY_READ_ACCESS_WIDTH           1u
 
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+/* States of CRC total calculated during programming */
+/** No calculation in progress */
+# define SEC_CRC_TOTAL_STATE_IDLE               0x00u
+/** Programmed data passed in ascending order, CRC total up to date */
+# define SEC_CRC_TOTAL_STATE_ACTIVE             0x01u
+/** Data not passed in ascending order, CRC total has to be calculated by reading back the whole block */
+# define SEC_CRC_TOTAL_STATE_FALLBACK           0x02u
+/** Calculation or readback comparison failed, verification has to fail */
+# define SEC_CRC_TOTAL_STATE_ERROR              0x03u
+
+/** Maximum number of bytes passed to a single CRC computation (limited by SecM_LengthType) */
+# define SEC_CRC_TOTAL_MAX_BYTE_COUNT           0xFFFFu
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
+
 /* PRQA L:TAG_SecVerification_3453_1 */
 
 /**********************************************************************************************************************
@@ -201,6 +216,13 @@ typedef struct
    SecM_SizeType              readCountMask;    /**< Mask applied when comparing read count against requested length */
    SecM_StatusType            readCountResult;  /**< Result returned when comparison of read count and requested length fails */
 #endif /* SEC_ENABLE_VERIFICATION_ASSERT_READ_COUNT && SEC_ENABLE_CRC_TOTAL */
+#if defined( SEC_ENABLE_VERIFICATION_READ_BUFFER )
+   SecM_RamDataType           readBuffer;       /**< Pointer to buffer supplied by caller */
+   SecM_SizeType              readBufferSize;   /**< Usable size of buffer supplied by caller (multiple of SEC_VERIFY_BYTES) */
+#endif /* SEC_ENABLE_VERIFICATION_READ_BUFFER */
+#if defined( SEC_ENABLE_VERIFICATION_DIRECT_ACCESS )
+   SecM_ByteType              directAccess;     /**< Pass memory contents in place instead of reading them into a buffer */
+#endif /* SEC_ENABLE_VERIFICATION_DIRECT_ACCESS */
 } SecM_VerifyContextType;
 
 /** List of verification primitive configurations */
@@ -210,6 +232,21 @@ typedef struct
    SecM_ByteFastType       count;                                 /**< Number of list entries */
 } SecM_VerifyConfigPairType;
 
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+/** Context of CRC total calculated during programming */
+typedef struct
+{
+   SecM_CRCParamType          crcParam;           /**< Workspace of running CRC calculation */
+   FL_ReadMemoryFctType       readMemory;         /**< Pointer to memory read function (gaps and readback) */
+   SecM_AddrType              blockStartAddress;  /**< Start address of logical block */
+   SecM_AddrType              nextAddress;        /**< Address following the last byte included in CRC total */
+# if ( SEC_CRC_TOTAL_READBACK_INTERVAL > 0u )
+   SecM_SizeType              readbackCount;      /**< Number of updates since last readback comparison */
+# endif /* SEC_CRC_TOTAL_READBACK_INTERVAL > 0u */
+   SecM_ByteType              state;              /**< Calculation state (see SEC_CRC_TOTAL_STATE_*) */
+} SecM_CrcTotalContextType;
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
+
 /**********************************************************************************************************************
  *  LOCAL FUNCTION PROTOTYPES
  *********************************************************************************************************************/
@@ -232,6 +269,10 @@ static SecM_StatusType SecM_UpdateSegmentAddress( V_MEMRAM1 SecM_VerifyContextTy
 static void SecM_PopulateCfgList( const V_MEMRAM1 SecM_VerifyConfigListType V_MEMRAM2 V_MEMRAM3 * pSourceList,
    V_MEMRAM1 SecM_VerifyConfigPairType V_MEMRAM2 V_MEMRAM3 * pTargetList, SecM_ByteType mask );
 
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+static SecM_StatusType SecM_UpdateCrcTotalMemory( SecM_SizeType length );
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
+
 #if defined( SEC_ENABLE_VERIFICATION_WRAPPER )
 #else
 static SecM_StatusType SecM_VerificationWrapper ( V_MEMRAM1 SecM_VerifyParamType V_MEMRAM2 V_MEMRAM3 * pVerifyParam,
@@ -245,6 +286,11 @@ static SecM_StatusType SecM_VerificationBase ( V_MEMRAM1 SecM_VerifyParamType V_
  *  LOCAL DATA
  *********************************************************************************************************************/
 
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+/** CRC total calculated during programming */
+V_MEMRAM0 static V_MEMRAM1 SecM_CrcTotalContextType V_MEMRAM2 crcTotalContext;
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
+
 #if defined( SEC_ENABLE_SECURITY_CLASS_DDD )
 # if defined( SEC_ENABLE_CHECKSUM_TYPE_CRC ) && \
      defined( SEC_ENABLE_WORKSPACE_INTERNAL )
@@ -479,6 +525,8 @@ static SecM_StatusType SecM_UpdateSegment( V_MEMRAM1 SecM_VerifyContextType V_ME
    SecM_SizeType     countMask;
    SecM_StatusType   countResult;
 #endif /* SEC_ENABLE_VERIFICATION_ASSERT_READ_COUNT && SEC_ENABLE_CRC_TOTAL */
+   SecM_SizeType     chunkSize;
+   SecM_RamDataType  pReadBuffer;
    SecM_ByteType     verifyBuffer[SEC_VERIFY_BYTES];
    V_MEMRAM1 SecM_SignatureParamType V_MEMRAM2 V_MEMRAM3 * pVerifyParam;
 
@@ -508,7 +556,27 @@ static SecM_StatusType SecM_UpdateSegment( V_MEMRAM1 SecM_VerifyContextType V_ME
       {
          pVerifyParam = &pContext->sigParam;
 
-         pVerifyParam->sigSourceBuffer  = verifyBuffer;      /* PRQA S 3225 */ /* MD_SecVerification_3225 */
+         /* Read memory contents into local buffer per default */
+         pReadBuffer = verifyBuffer;
+         chunkSize   = SEC_VERIFY_BYTES;
+
+#if defined( SEC_ENABLE_VERIFICATION_READ_BUFFER )
+         if (pContext->readBufferSize > SEC_VERIFY_BYTES)
+         {
+            /* Use larger buffer supplied by caller, reducing the number of calls to the verification primitives */
+            pReadBuffer = pContext->readBuffer;
+            chunkSize   = pContext->readBufferSize;
+         }
+#endif /* SEC_ENABLE_VERIFICATION_READ_BUFFER */
+#if defined( SEC_ENABLE_VERIFICATION_DIRECT_ACCESS )
+         if (0u != pContext->directAccess)
+         {
+            /* Memory contents passed in place, chunk size only limited to keep watchdog serviced */
+            chunkSize   = SEC_VERIFY_DIRECT_BYTES;
+         }
+#endif /* SEC_ENABLE_VERIFICATION_DIRECT_ACCESS */
+
+         pVerifyParam->sigSourceBuffer  = pReadBuffer;       /* PRQA S 3225 */ /* MD_SecVerification_3225 */
          pVerifyParam->sigState         = SEC_HASH_COMPUTE;
 
          while (remainder > 0u)
@@ -517,15 +585,31 @@ static SecM_StatusType SecM_UpdateSegment( V_MEMRAM1 SecM_VerifyContextType V_ME
             SEC_WATCHDOG_TRIGGER(pVerifyParam->wdTriggerFct); /* PRQA S 3109 */ /* MD_MSR_14.3 */
 
             /* Number of bytes to handle in this loop */
-            verifyCount = SEC_VERIFY_BYTES / SEC_MEMORY_READ_ACCESS_WIDTH;
-            if (remainder < (SEC_VERIFY_BYTES / SEC_MEMORY_READ_ACCESS_WIDTH))
+            verifyCount = chunkSize / SEC_MEMORY_READ_ACCESS_WIDTH;
+            if (chunkSize > SEC_VERIFY_BYTES)
+            {
+               /* Chunk ends on multiple of SEC_VERIFY_BYTES, following accesses start at aligned addresses */
+               verifyCount -= (currentAddress % (SEC_VERIFY_BYTES / SEC_MEMORY_READ_ACCESS_WIDTH));
+            }
+            if (remainder < verifyCount)
             {
                /* Limit to remainder */
                verifyCount = remainder;
             }
 
-            /* Copy data from memory to RAM buffer */
-            readCount = pContext->readMemory(currentAddress, verifyBuffer, verifyCount);
+#if defined( SEC_ENABLE_VERIFICATION_DIRECT_ACCESS )
+            if (0u != pContext->directAccess)
+            {
+               /* Access memory contents in place */
+               pVerifyParam->sigSourceBuffer = (SecM_VerifyDataType)currentAddress; /* PRQA S 0306 */ /* MD_SecVerification_0306_2 */
+               readCount = SEC_MEMORY_READ_ACCESS_WIDTH * verifyCount;
+            }
+            else
+#endif /* SEC_ENABLE_VERIFICATION_DIRECT_ACCESS */
+            {
+               /* Copy data from memory to RAM buffer */
+               readCount = pContext->readMemory(currentAddress, pReadBuffer, verifyCount);
+            }
 
 #if defined( SEC_ENABLE_VERIFICATION_ASSERT_READ_COUNT )
 # if defined( SEC_ENABLE_CRC_TOTAL )
@@ -676,6 +760,63 @@ static void SecM_PopulateCfgList( const V_MEMRAM1 SecM_VerifyConfigListType V_ME
    pTargetList->count = outIndex;
 }
 
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+/**********************************************************************************************************************
+ *  SecM_UpdateCrcTotalMemory
+ *********************************************************************************************************************/
+/*! \brief         Read memory contents following the data already included and pass them to the CRC total
+ *  \details       Used for inter-segment data and the remainder of the logical block. Same as for the readback of
+ *                 inter-segment data during verification, memory which can't be read is skipped.
+ *  \param[in]     length Number of bytes to be included, starting at the current address of the CRC total context
+ *  \return        SECM_OK if update operation successful
+ *                 SECM_NOT_OK if error occured during update
+ *********************************************************************************************************************/
+static SecM_StatusType SecM_UpdateCrcTotalMemory( SecM_SizeType length )
+{
+   SecM_StatusType   result;
+   SecM_SizeType     remainder;
+   SecM_SizeType     verifyCount;
+   SecM_SizeType     readCount;
+   SecM_ByteType     verifyBuffer[SEC_VERIFY_BYTES];
+
+   result      = SECM_OK;
+   remainder   = length;
+
+   crcTotalContext.crcParam.crcSourceBuffer  = verifyBuffer;
+   crcTotalContext.crcParam.crcState         = SEC_CRC_COMPUTE;
+
+   while ((remainder > 0u) && (SECM_OK == result))
+   {
+      /* Serve watchdog every loop cycle */
+      SEC_WATCHDOG_TRIGGER(crcTotalContext.crcParam.wdTriggerFct); /* PRQA S 3109 */ /* MD_MSR_14.3 */
+
+      /* Number of bytes to handle in this loop */
+      verifyCount = SEC_VERIFY_BYTES / SEC_MEMORY_READ_ACCESS_WIDTH;
+      if (remainder < (SEC_VERIFY_BYTES / SEC_MEMORY_READ_ACCESS_WIDTH))
+      {
+         /* Limit to remainder */
+         verifyCount = remainder;
+      }
+
+      /* Copy data from memory to RAM buffer */
+      readCount = crcTotalContext.readMemory(crcTotalContext.nextAddress, verifyBuffer, verifyCount);
+
+      /* Update operation only necessary in case any data was read (gaps may not be backed by actual memory) */
+      if (readCount > 0u)
+      {
+         crcTotalContext.crcParam.crcByteCount = (SecM_LengthType)readCount;
+         result = SecM_ComputeCRC(&crcTotalContext.crcParam);
+      }
+
+      /* Update address information */
+      crcTotalContext.nextAddress += verifyCount;
+      remainder                   -= verifyCount;
+   }
+
+   return result;
+}
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
+
 /**********************************************************************************************************************
  *  SecM_VerificationWrapper
  *********************************************************************************************************************/
@@ -760,6 +901,19 @@ static SecM_StatusType SecM_VerificationWrapper( V_MEMRAM1 SecM_VerifyParamType
       context.sigParam.sigState           = SEC_HASH_INIT;
       context.sigParam.wdTriggerFct       = pVerifyParam->wdTriggerFct;
       context.readMemory                  = pVerifyParam->readMemory;
+#if defined( SEC_ENABLE_VERIFICATION_READ_BUFFER )
+      /* Usable size of buffer supplied by caller is limited to multiple of SEC_VERIFY_BYTES */
+      context.readBuffer                  = (SecM_RamDataType)pVerifyParam->readBuffer.data; /* PRQA S 0310 */ /* MD_SecVerification_0310 */
+      context.readBufferSize              = 0u;
+      if (SEC_DEFAULT_WORKSPACE != pVerifyParam->readBuffer.data)
+      {
+         context.readBufferSize           = pVerifyParam->readBuffer.size - (pVerifyParam->readBuffer.size % SEC_VERIFY_BYTES);
+      }
+#endif /* SEC_ENABLE_VERIFICATION_READ_BUFFER */
+#if defined( SEC_ENABLE_VERIFICATION_DIRECT_ACCESS )
+      /* Intra-segment data is accessed in place */
+      context.directAccess                = 1u;
+#endif /* SEC_ENABLE_VERIFICATION_DIRECT_ACCESS */
 #if defined( SEC_ENABLE_VERIFICATION_DATA_LENGTH )
       context.sigParam.currentDataLength  = SEC_DATA_LENGTH_NULL;
 #endif /* SEC_ENABLE_VERIFICATION_DATA_LENGTH */
@@ -798,6 +952,10 @@ static SecM_StatusType SecM_VerificationWrapper( V_MEMRAM1 SecM_VerifyParamType
             {
                /* Default to inter-segment handling */
                pCfgListUpdate = &cfgListInter;
+# if defined( SEC_ENABLE_VERIFICATION_DIRECT_ACCESS )
+               /* Gaps may not be backed by actual memory, always use read function */
+               context.directAccess    = 0u;
+# endif /* SEC_ENABLE_VERIFICATION_DIRECT_ACCESS */
 # if defined( SEC_ENABLE_VERIFICATION_ASSERT_READ_COUNT )
                /* Ignore mismatch of read count and requested length */
                context.readCountMask   = SEC_READ_COUNT_MASK_IGNORE;
@@ -826,6 +984,9 @@ static SecM_StatusType SecM_VerificationWrapper( V_MEMRAM1 SecM_VerifyParamType
 
                      /* Apply to all verification primitives */
                      pCfgListUpdate = &cfgListAll;
+# if defined( SEC_ENABLE_VERIFICATION_DIRECT_ACCESS )
+                     context.directAccess    = 1u;
+# endif /* SEC_ENABLE_VERIFICATION_DIRECT_ACCESS */
 # if defined( SEC_ENABLE_VERIFICATION_ASSERT_READ_COUNT )
                      /* Assert equality of read count and requested length */
                      context.readCountMask   = SEC_READ_COUNT_MASK_ASSERT;    /* PRQA S 0277 */ /* MD_SecVerification_0277 */
@@ -969,6 +1130,9 @@ static SecM_StatusType SecM_VerificationBase( V_MEMRAM1 SecM_VerifyParamType V_M
 #if defined( SEC_ENABLE_CRC_TOTAL )
    SecM_CRCParamType crcTotalParam;
 #endif /* SEC_ENABLE_CRC_TOTAL */
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+   SecM_ByteType     crcTotalState;
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
 
 #if (defined( SEC_ENABLE_WORKSPACE_INTERNAL ) && defined( SEC_ENABLE_WORKSPACE_EXTERNAL )) || \
     defined( SEC_ENABLE_VERIFICATION_DATA_LENGTH ) || \
@@ -998,6 +1162,27 @@ static SecM_StatusType SecM_VerificationBase( V_MEMRAM1 SecM_VerifyParamType V_M
    crcTotalParam.currentCRC = secCrcZeroValue;
 
    /* Entry for CRC total included in configuration list? */
+# if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+   /* Take over state of CRC total calculated during programming, calculation is consumed by this verification */
+   crcTotalState           = crcTotalContext.state;
+   crcTotalContext.state   = SEC_CRC_TOTAL_STATE_IDLE;
+
+   if ((SEC_CRC_TOTAL_STATE_FALLBACK == crcTotalState)
+    || (crcTotalContext.blockStartAddress != pVerifyParam->blockStartAddress)
+    || ((crcTotalContext.nextAddress - crcTotalContext.blockStartAddress) > pVerifyParam->blockLength))
+   {
+      /* Programmed data doesn't match the verified block, read back whole block instead */
+      crcTotalState = SEC_CRC_TOTAL_STATE_IDLE;
+   }
+
+   if ((index < cfgCount) && (SEC_CRC_TOTAL_STATE_IDLE != crcTotalState))
+   {
+      /* CRC total already calculated during programming
+         Only primitives preceding the CRC total have to read back the memory contents */
+      pCfgList->count = index;
+   }
+   else
+# endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
    if (index < cfgCount)
    {
       /* Use local variable as workspace */
@@ -1013,6 +1198,44 @@ static SecM_StatusType SecM_VerificationBase( V_MEMRAM1 SecM_VerifyParamType V_M
    /* Perform verification with configuration list */
    result = SecM_VerificationWrapper(pVerifyParam, pCfgList);
 
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+   if (pCfgList->count < cfgCount)
+   {
+      /* Restore configuration list */
+      pCfgList->count = cfgCount;
+
+      if (SEC_CRC_TOTAL_STATE_ERROR == crcTotalState)
+      {
+         /* Calculation or readback comparison failed during programming */
+         result = SECM_VER_ERROR;
+      }
+      else if (SECM_VER_OK == result)
+      {
+         /* Include remaining memory contents up to end of block */
+         if (SECM_OK == SecM_UpdateCrcTotalMemory(pVerifyParam->blockLength - (crcTotalContext.nextAddress - crcTotalContext.blockStartAddress)))
+         {
+            /* Finalize calculation */
+            crcTotalContext.crcParam.crcState = SEC_CRC_FINALIZE;
+
+            if (SECM_OK != SecM_ComputeCRC(&crcTotalContext.crcParam))
+            {
+               result = SECM_VER_ERROR;
+            }
+         }
+         else
+         {
+            result = SECM_VER_ERROR;
+         }
+
+         crcTotalParam.currentCRC = crcTotalContext.crcParam.currentCRC;
+      }
+      else
+      {
+         /* Verification failed, CRC total not relevant */
+      }
+   }
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
+
 #if defined( SEC_ENABLE_CRC_TOTAL )
    /* Store calculated CRC total */
    pVerifyParam->crcTotal = crcTotalParam.currentCRC;
@@ -1080,6 +1303,163 @@ void SecM_UpdateDataLength( V_MEMRAM1 SecM_SignatureParamType V_MEMRAM2 V_MEMRAM
 }
 #endif /* SEC_ENABLE_VERIFICATION_DATA_LENGTH */
 
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+/**********************************************************************************************************************
+ *  SecM_InitCrcTotal
+ *********************************************************************************************************************/
+/*! \brief         Start calculation of CRC total during programming of a logical block
+ *  \details       Data passed to SecM_UpdateCrcTotal afterwards is included in the CRC total directly, so the
+ *                 readback of the programmed data for the CRC total can be skipped by the following verification
+ *                 of the same block. Only gaps between the programmed data and the remainder of the block are read
+ *                 from memory.
+ *  \param[in]     blockStartAddress Start address of logical block
+ *  \param[in]     readMemory Pointer to memory read function
+ *  \param[in]     wdTriggerFct Pointer to watchdog trigger function
+ *  \return        SECM_OK if initialization successful
+ *                 SECM_NOT_OK if error occured during initialization
+ *********************************************************************************************************************/
+SecM_StatusType SecM_InitCrcTotal( SecM_AddrType blockStartAddress, FL_ReadMemoryFctType readMemory,
+   FL_WDTriggerFctType wdTriggerFct )
+{
+   SecM_StatusType result;
+
+   crcTotalContext.readMemory             = readMemory;
+   crcTotalContext.blockStartAddress      = blockStartAddress;
+   crcTotalContext.nextAddress            = blockStartAddress;
+# if ( SEC_CRC_TOTAL_READBACK_INTERVAL > 0u )
+   crcTotalContext.readbackCount          = 0u;
+# endif /* SEC_CRC_TOTAL_READBACK_INTERVAL > 0u */
+
+   /* Initialize CRC */
+   crcTotalContext.crcParam.wdTriggerFct  = wdTriggerFct;
+   crcTotalContext.crcParam.crcState      = SEC_CRC_INIT;
+
+   result = SecM_ComputeCRC(&crcTotalContext.crcParam);
+
+   if (SECM_OK == result)
+   {
+      crcTotalContext.state = SEC_CRC_TOTAL_STATE_ACTIVE;
+   }
+   else
+   {
+      /* Fall back to readback of whole block during verification */
+      crcTotalContext.state = SEC_CRC_TOTAL_STATE_IDLE;
+   }
+
+   return result;
+}
+
+/**********************************************************************************************************************
+ *  SecM_UpdateCrcTotal
+ *********************************************************************************************************************/
+/*! \brief         Include successfully programmed data in CRC total
+ *  \details       Data has to be passed in ascending address order. Gaps since the previous call are read from
+ *                 memory. Otherwise the calculation is discarded and the CRC total is calculated by reading back the
+ *                 whole block during verification.
+ *                 If SEC_CRC_TOTAL_READBACK_INTERVAL is set, the beginning of every n-th passed data range is read
+ *                 back and compared to the passed data.
+ *                 Any error is reported by the following verification of the block.
+ *  \pre           SecM_InitCrcTotal called for current logical block
+ *  \param[in]     address Memory address of programmed data
+ *  \param[in]     data Pointer to programmed data (including any padding)
+ *  \param[in]     length Length of programmed data
+ *  \return        SECM_OK if update operation successful or no calculation active
+ *                 SECM_NOT_OK if error occured during update
+ *********************************************************************************************************************/
+SecM_StatusType SecM_UpdateCrcTotal( SecM_AddrType address, SecM_ConstRamDataType data, SecM_SizeType length )
+{
+   SecM_StatusType   result;
+   SecM_SizeType     remainder;
+   SecM_SizeType     byteCount;
+# if ( SEC_CRC_TOTAL_READBACK_INTERVAL > 0u )
+   SecM_SizeType     readbackLength;
+   SecM_SizeType     index;
+   SecM_ByteType     readbackBuffer[SEC_VERIFY_BYTES];
+# endif /* SEC_CRC_TOTAL_READBACK_INTERVAL > 0u */
+
+   result = SECM_OK;
+
+   if (SEC_CRC_TOTAL_STATE_ACTIVE == crcTotalContext.state)
+   {
+      if (address < crcTotalContext.nextAddress)
+      {
+         /* Data not passed in ascending order */
+         crcTotalContext.state = SEC_CRC_TOTAL_STATE_FALLBACK;
+      }
+      else
+      {
+         /* Include memory contents of gap since previous call */
+         result = SecM_UpdateCrcTotalMemory(address - crcTotalContext.nextAddress);
+
+# if ( SEC_CRC_TOTAL_READBACK_INTERVAL > 0u )
+         crcTotalContext.readbackCount++;
+
+         if ((SECM_OK == result) && (crcTotalContext.readbackCount >= SEC_CRC_TOTAL_READBACK_INTERVAL))
+         {
+            crcTotalContext.readbackCount = 0u;
+
+            /* Compare beginning of programmed data against memory contents */
+            readbackLength = SEC_VERIFY_BYTES / SEC_MEMORY_READ_ACCESS_WIDTH;
+            if (length < readbackLength)
+            {
+               readbackLength = length;
+            }
+
+            if (readbackLength != crcTotalContext.readMemory(address, readbackBuffer, readbackLength))
+            {
+               result = SECM_NOT_OK;
+            }
+            else
+            {
+               for (index = 0u; index < readbackLength; index++)
+               {
+                  if (readbackBuffer[index] != data[index])
+                  {
+                     result = SECM_NOT_OK;
+                     break;
+                  }
+               }
+            }
+         }
+# endif /* SEC_CRC_TOTAL_READBACK_INTERVAL > 0u */
+
+         if (SECM_OK == result)
+         {
+            /* Include programmed data */
+            crcTotalContext.crcParam.crcSourceBuffer  = data;
+            crcTotalContext.crcParam.crcState         = SEC_CRC_COMPUTE;
+            remainder                                 = length;
+
+            while ((remainder > 0u) && (SECM_OK == result))
+            {
+               byteCount = remainder;
+               if (byteCount > SEC_CRC_TOTAL_MAX_BYTE_COUNT)
+               {
+                  byteCount = SEC_CRC_TOTAL_MAX_BYTE_COUNT;
+               }
+
+               crcTotalContext.crcParam.crcByteCount = (SecM_LengthType)byteCount;
+               result = SecM_ComputeCRC(&crcTotalContext.crcParam);
+
+               crcTotalContext.crcParam.crcSourceBuffer = &crcTotalContext.crcParam.crcSourceBuffer[byteCount];
+               remainder -= byteCount;
+            }
+
+            crcTotalContext.nextAddress = address + length;
+         }
+
+         if (SECM_OK != result)
+         {
+            /* Report error during verification */
+            crcTotalContext.state = SEC_CRC_TOTAL_STATE_ERROR;
+         }
+      }
+   }
+
+   return result;
+}
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
+
 #if defined( SEC_ENABLE_VERIFY_CHECKSUM_CRC )
 /**********************************************************************************************************************
  *  SecM_VerifyChecksumCrc
@@ -1110,7 +1490,7 @@ SecM_StatusType SecM_VerifyChecksumCrc( V_MEMRAM1 SecM_SignatureParamType V_MEMR
 # endif /* SEC_ENABLE_WORKSPACE_EXTERNAL */
    {
       /* Store workspace pointer for easier access */
-      pCrcParam = (V_MEMRAM1 SecM_CRCParamType V_MEMRAM2 V_MEMRAM3 *)(pVerifyParam->currentHash.sigResultBuffer); /* PRQA S 0306 */ /* MD_SecVerification_0306 */
+      pCrcParam = (V_MEMRAM1 SecM_CRCParamType V_MEMRAM2 V_MEMRAM3 *)(unsigned long)(pVerifyParam->currentHash.sigResultBuffer); /* PRQA S 0306 */ /* MD_SecVerification_0306 */
 
 # if defined( SEC_ENABLE_VERIFICATION_DATA_LENGTH )
       /* Update member currentDataLength of verification parameter */
@@ -1200,7 +1580,7 @@ SecM_StatusType SecM_VerifyClassDDD( V_MEMRAM1 SecM_SignatureParamType V_MEMRAM2
 #  endif /* SEC_ENABLE_WORKSPACE_EXTERNAL */
       {
          /* Set internal default workspace */
-         pVerifyParam->currentHash.sigResultBuffer = (SecM_ResultBufferType)SEC_VERIFY_CLASS_DDD_WORKSPACE; /* PRQA S 0306 */ /* MD_SecVerification_0306 */
+         pVerifyParam->currentHash.sigResultBuffer = (SecM_ResultBufferType)(unsigned long)SEC_VERIFY_CLASS_DDD_WORKSPACE; /* PRQA S 0306 */ /* MD_SecVerification_0306 */
          pVerifyParam->currentHash.length          = SEC_VERIFY_CLASS_DDD_WORKSPACE_SIZE;
       }
    }
@@ -1373,6 +1753,18 @@ SecM_StatusType SecM_Verification( V_MEMRAM1 SecM_VerifyParamType V_MEMRAM2 V_ME
       Risk: The size of integer required to hold the result of a pointer cast is implementation defined.
       Prevention: 32 bit handles all current use-cases. Pay special attention when 64 bit ECUs are introduced.
 
+   MD_SecVerification_0306_2:
+      Reason: Memory-mapped flash is passed in place to the verification primitives, requiring a cast from address to
+       pointer.
+      Risk: The size of integer required to hold the result of a pointer cast is implementation defined.
+       Address may not be accessible directly.
+      Prevention: Only used for intra-segment data and if explicitly configured (SEC_ENABLE_VERIFICATION_DIRECT_ACCESS).
+
+   MD_SecVerification_0310:
+      Reason: Caller supplied buffer is stored as workspace pointer type to ensure alignment, but accessed byte-wise.
+      Risk: No identifiable risk, as alignment requirement of byte access is less strict.
+      Prevention: No prevention required.
+
    MD_SecVerification_3225:
       Reason: Input buffer placed on stack to remove the need for global variables. Reference only used in SecM_Verify*
        functions executed in context of declaring function.
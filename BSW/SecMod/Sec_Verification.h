@@ -232,6 +232,22 @@
 # define SEC_ENABLE_VERIFICATION_ASSERT_READ_COUNT
 #endif /* SEC_(EN|DIS)ABLE_VERIFICATION_ASSERT_READ_COUNT */
 
+#if defined( SEC_ENABLE_VERIFICATION_DIRECT_ACCESS )
+# if defined( SEC_VERIFY_DIRECT_BYTES )
+# else
+/** Number of bytes passed to verification primitives at once when memory is accessed in place */
+#  define SEC_VERIFY_DIRECT_BYTES              (16u * SEC_VERIFY_BYTES)
+# endif /* SEC_VERIFY_DIRECT_BYTES */
+#endif /* SEC_ENABLE_VERIFICATION_DIRECT_ACCESS */
+
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+# if defined( SEC_CRC_TOTAL_READBACK_INTERVAL )
+# else
+/** Every n-th programmed chunk passed to SecM_UpdateCrcTotal is read back and compared (zero: no readback) */
+#  define SEC_CRC_TOTAL_READBACK_INTERVAL      0u
+# endif /* SEC_CRC_TOTAL_READBACK_INTERVAL */
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
+
 /*********************************************************************************************************************/
 
 /* Remap compile-time switches */
@@ -459,6 +475,10 @@ typedef struct
    SecM_WorkspaceType   workspace;
    /** Pointer to verification key */
    SecM_VerifyKeyType   key;
+#if defined( SEC_ENABLE_VERIFICATION_READ_BUFFER )
+   /** Optional buffer used for memory readback, internal buffer used if smaller than SEC_VERIFY_BYTES */
+   SecM_WorkspaceType   readBuffer;
+#endif /* SEC_ENABLE_VERIFICATION_READ_BUFFER */
 } SecM_VerifyParamType;
 
 /** Structure to describe current hash value (also used to pass workspace) */
@@ -556,6 +576,11 @@ void SecM_UpdateDataLength                   ( V_MEMRAM1 SecM_SignatureParamType
 SecM_StatusType SecM_VerificationWrapper     ( V_MEMRAM1 SecM_VerifyParamType V_MEMRAM2 V_MEMRAM3 * pVerifyParam,
    V_MEMRAM1 SecM_VerifyConfigListType V_MEMRAM2 V_MEMRAM3 * pCfgList );
 #endif /* SEC_ENABLE_VERIFICATION_WRAPPER */
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+SecM_StatusType SecM_InitCrcTotal            ( SecM_AddrType blockStartAddress, FL_ReadMemoryFctType readMemory,
+   FL_WDTriggerFctType wdTriggerFct );
+SecM_StatusType SecM_UpdateCrcTotal          ( SecM_AddrType address, SecM_ConstRamDataType data, SecM_SizeType length );
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
 
 /*********************************************************************************************************************/
 
@@ -597,6 +622,22 @@ SecM_StatusType SecM_VerifyClassVendor       ( V_MEMRAM1 SecM_SignatureParamType
 # error "Error in configuration: Neither SEC_ENABLE_WORKSPACE_INTERNAL nor SEC_ENABLE_WORKSPACE_EXTERNAL set"
 #endif
 
+#if defined( SEC_ENABLE_VERIFICATION_DIRECT_ACCESS )
+# if ( SEC_VERIFY_DIRECT_BYTES > 0xFFFFu )
+#  error "Error in configuration: SEC_VERIFY_DIRECT_BYTES exceeds valid range"
+# endif
+# if ( (SEC_VERIFY_DIRECT_BYTES % SEC_VERIFY_BYTES) != 0u )
+#  error "Error in configuration: SEC_VERIFY_DIRECT_BYTES has to be a multiple of SEC_VERIFY_BYTES"
+# endif
+#endif /* SEC_ENABLE_VERIFICATION_DIRECT_ACCESS */
+
+#if defined( SEC_ENABLE_CRC_TOTAL_INCREMENTAL )
+# if defined( SEC_ENABLE_CRC_TOTAL )
+# else
+#  error "Error in configuration: SEC_ENABLE_CRC_TOTAL_INCREMENTAL requires SEC_ENABLE_CRC_TOTAL"
+# endif /* SEC_ENABLE_CRC_TOTAL */
+#endif /* SEC_ENABLE_CRC_TOTAL_INCREMENTAL */
+
 #endif /* __SEC_VERIFICATION_H__ */
 
 /***********************************************************************************************************************
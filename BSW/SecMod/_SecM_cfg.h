@@ -75,6 +75,8 @@
 #define SEC_FILE                                2u
 #define SEC_CRC_SPEED_OPTIMIZED                 0u
 #define SEC_CRC_SIZE_OPTIMIZED                  1u
+#define SEC_CRC_SLICE_OPTIMIZED                 2u
+#define SEC_CRC_ROM_OPTIMIZED                   3u
 #define SEC_SECURITY_CLASS                      SEC_CLASS_DDD
 #define SEC_ECU_KEY                             0x00u
 #define SEC_KEY_TIMEOUT                         100u
@@ -83,6 +85,9 @@
 #define SEC_MODE                                SEC_PRODUCTION
 #define SEC_CRC_OPT                             SEC_CRC_SPEED_OPTIMIZED
 #define SEC_DISABLE_CRC_TOTAL
+#define SEC_DISABLE_CRC_TOTAL_INCREMENTAL
+#define SEC_DISABLE_VERIFICATION_READ_BUFFER
+#define SEC_DISABLE_VERIFICATION_DIRECT_ACCESS
 #define SEC_RIPEMD160                           0u
 #define SEC_SHA1                                1u
 #define SEC_SHA256                              2u
@@ -102,6 +102,15 @@
 #endif
 /* PRQA L:TAG_WrapNv_0883 */
 
+/* Transaction: NV writes are staged until commit and become visible at once.
+   Without support by the configured NV driver each write takes effect immediately. */
+#if !defined( ApplFblNvTransactionStart )
+# define ApplFblNvTransactionStart()      WRAPNV_E_OK
+#endif
+#if !defined( ApplFblNvTransactionCommit )
+# define ApplFblNvTransactionCommit()     WRAPNV_E_OK
+#endif
+
 /**********************************************************************************************************************
  *  TYPEDEFS
  *********************************************************************************************************************/
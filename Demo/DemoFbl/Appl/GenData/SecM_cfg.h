@@ -82,6 +82,9 @@
 #define SEC_VERIFY_BYTES                     64
 #define SEC_ENABLE_VERIFICATION_ADDRESS_LENGTH
 #define SEC_DISABLE_CRC_TOTAL
+#define SEC_DISABLE_CRC_TOTAL_INCREMENTAL
+#define SEC_DISABLE_VERIFICATION_READ_BUFFER
+#define SEC_DISABLE_VERIFICATION_DIRECT_ACCESS
 #define SEC_DISABLE_CRC_WRITTEN
 #define SEC_DISABLE_VENDOR_CHECKSUM
 #define SEC_VER_SIG_OFFSET                   0
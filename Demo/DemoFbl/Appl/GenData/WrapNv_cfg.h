@@ -68,18 +68,20 @@
 *   +-- SecAccessInvalidCount     0xfede3005     6              Security Access Invalid count
 *   |
 *   +-- 2 x Metadata                                            Internal meta data (for each logical block)
-*       |
-*       +-- Fingerprint           0xfede3006     7              Download fingerprint
-*       |
-*       +-- ProgCounter           0xfede300f     8              Successful reprogramming attempts
-*       |
-*       +-- ProgAttempts          0xfede3011     9              Reprogramming attempts
-*       |
-*       +-- CRCValue              0xfede3013     10             CRC total of logical block
-*       |
-*       +-- CRCStart              0xfede3017     11             Start address of CRC total
-*       |
-*       +-- CRCLength             0xfede301b     12             Length of CRC total
+*   |   |
+*   |   +-- Fingerprint           0xfede3006     7              Download fingerprint
+*   |   |
+*   |   +-- ProgCounter           0xfede300f     8              Successful reprogramming attempts
+*   |   |
+*   |   +-- ProgAttempts          0xfede3011     9              Reprogramming attempts
+*   |   |
+*   |   +-- CRCValue              0xfede3013     10             CRC total of logical block
+*   |   |
+*   |   +-- CRCStart              0xfede3017     11             Start address of CRC total
+*   |   |
+*   |   +-- CRCLength             0xfede301b     12             Length of CRC total
+*   |
+*   +-- BootDescriptor            0xfede3038     19             Cached application validity decision (FBL_ENABLE_BOOT_DESCRIPTOR only)
 */
 
 /* Size defines ************************************************************** */
@@ -96,6 +98,7 @@
 #define kEepSizeCRCStart                     0x04u
 #define kEepSizeCRCLength                    0x04u
 #define kEepSizeMetadata                     (kEepSizeFingerprint + kEepSizeProgCounter + kEepSizeProgAttempts + kEepSizeCRCValue + kEepSizeCRCStart + kEepSizeCRCLength)
+#define kEepSizeBootDescriptor               0x08u
 /* Address defines *********************************************************** */
 #ifdef FBL_ENABLE_EEPMGR
 #else
@@ -114,7 +117,12 @@
 #define kEepAddressCRCValue                  (kEepAddressProgAttempts + kEepSizeProgAttempts)
 #define kEepAddressCRCStart                  (kEepAddressCRCValue + kEepSizeCRCValue)
 #define kEepAddressCRCLength                 (kEepAddressCRCStart + kEepSizeCRCStart)
+#ifdef FBL_ENABLE_BOOT_DESCRIPTOR
+#define kEepAddressBootDescriptor            (kEepAddressMetadata + kEepSizeMetadata * 2)
+#define kEepEndAddress                       (kEepAddressBootDescriptor + kEepSizeBootDescriptor - 1)
+#else
 #define kEepEndAddress                       (kEepAddressMetadata + kEepSizeMetadata * 2 - 1)
+#endif
 #define kEepSizeOfEeprom                     (kEepEndAddress - kEepStartAddress + 1)
 /* Initialize NvStructSize-Array */
 #define kNvNoOfStructs                       0x01u
@@ -138,7 +146,12 @@
 #define kEepMgrHandle_CRCStart               (kEepMgrHandle_CRCValue + 1)
 #define kEepMgrHandle_CRCLength              (kEepMgrHandle_CRCStart + 1)
 #define kEepMgrNrOfMetadataHdls              (kEepMgrHandle_CRCLength + 1)
+#ifdef FBL_ENABLE_BOOT_DESCRIPTOR
+#define kEepMgrHandle_BootDescriptor         (NV_GET_STRUCT_ID(kEepMgrHandle_Metadata) + kEepMgrNrOfMetadataHdls * 2)
+#define kEepMgrLastHandle                    kEepMgrHandle_BootDescriptor
+#else
 #define kEepMgrLastHandle                    (NV_GET_STRUCT_ID(kEepMgrHandle_Metadata) + kEepMgrNrOfMetadataHdls * 2 - 1)
+#endif
 #define kEepMgrNumberOfHandles               (kEepMgrLastHandle - kEepMgrFirstHandle + 1)
 #ifdef FBL_ENABLE_EEPMGR
 /* Initialize NvStructSize-Array */
@@ -244,6 +257,24 @@
 #endif
 
 
+#ifdef FBL_ENABLE_BOOT_DESCRIPTOR
+#ifdef FBL_ENABLE_EEPMGR
+#define ApplFblNvReadBootDescriptor(buf)     ((EepMgrRead(kEepMgrHandle_BootDescriptor, buf, kEepSizeBootDescriptor) == kEepSizeBootDescriptor) ? kFblOk : kFblFailed)
+#define ApplFblNvWriteBootDescriptor(buf)    ((EepMgrWrite(kEepMgrHandle_BootDescriptor, buf, kEepSizeBootDescriptor) == kEepMgrOk) ? kFblOk : kFblFailed)
+#else
+#define ApplFblNvReadBootDescriptor(buf)     ((EepromDriver_RReadSync(buf, kEepSizeBootDescriptor, kEepAddressBootDescriptor) == IO_E_OK) ? kFblOk : kFblFailed)
+#define ApplFblNvWriteBootDescriptor(buf)    ((EepromDriver_RWriteSync(buf, kEepSizeBootDescriptor, kEepAddressBootDescriptor) == IO_E_OK) ? kFblOk : kFblFailed)
+#endif
+#endif
+
+#ifdef FBL_ENABLE_EEPMGR
+#else
+#ifdef EEP_ENABLE_TRANSACTION
+#define ApplFblNvTransactionStart()          ((EepromDriver_TransactionStart() == IO_E_OK) ? kFblOk : kFblFailed)
+#define ApplFblNvTransactionCommit()         ((EepromDriver_TransactionCommit() == IO_E_OK) ? kFblOk : kFblFailed)
+#endif
+#endif
+
 #ifdef FBL_ENABLE_EEPMGR
 #else
 #define ApplFblIsValidEepAddress(i)          ((i >= kEepStartAddress) && (i <= kEepEndAddress))
@@ -92,6 +92,8 @@
 #define FBL_MEM_VERIFY_SEGMENTATION          0x40
 #define FBL_DISABLE_ADAPTIVE_DATA_TRANSFER_RCRRP
 #define FBL_DISABLE_PIPELINED_PROGRAMMING
+#define FBL_MEM_DISABLE_ERASE_BLANK_CHECK
+#define FBL_MEM_DISABLE_DELTA_DOWNLOAD
 #define FBL_MEM_WRITE_SEGMENTATION           0x0100
 #define FBL_ENABLE_UNALIGNED_DATA_TRANSFER
 /* CAN Identifier */
@@ -109,6 +111,9 @@
 #define FBL_HW_DISABLE_ALTERNATIVE_CLOCK_SOURCE
 #define FBL_CAN_0
 #define kFblCanChannel                       0x00
+#define FBL_DISABLE_CAN_FD
+#define FBL_DISABLE_CAN_RX_DIRECT_ACCESS
+#define FBL_DISABLE_CAN_RX_QUEUE
 
 /* Manufacturer specific part ************************************************ */
 /* FBL multiple nodes support: */
@@ -119,7 +124,15 @@
 #define FBL_DIAG_COMMUNICATION_CONTROL_TYPE  kDiagSubEnableRxAndDisableTx
 #define FBL_DIAG_ENABLE_CONTROLDTC_OPTIONRECORD
 #define FBL_DIAG_ENABLE_CHECK_PROGRAMMING_PRECONDITIONS
+#define FBL_DIAG_DISABLE_TRANSFERDATA_FASTPATH
+#define FBL_DIAG_DISABLE_SERVICE_INDEX
 #define FBL_APPL_DISABLE_STARTUP_DEPENDENCY_CHECK
+#define FBL_DISABLE_AB_BANK_MODE
+#define FBL_DISABLE_BOOT_DESCRIPTOR
+#define FBL_MAIN_DISABLE_EVENT_SCHEDULER
+#define FBL_MAIN_DISABLE_RUNTIME_MEASUREMENT
+#define EEP_DISABLE_JOURNAL
+#define EEP_DISABLE_TRANSACTION
 
 
 /* -----------------------------------------------------------------------------
@@ -97,6 +97,31 @@ V_MEMROM0 V_MEMROM1 tLogicalBlockTable V_MEMROM2 FblLogicalBlockTable =
     } /* Name 'Cal3', Optional */
   }
 };
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+V_MEMROM0 V_MEMROM1 tBlockBankDescriptor V_MEMROM2 FblLogicalBlockBankTable[FBL_MTAB_NO_OF_BLOCKS] = 
+{
+  
+  {
+    FBL_MTAB_DEMOAPPL_BLOCK_NUMBER /* Alternate Bank */, 
+    0x018000u /* Application Vector Table */
+  } /* Name 'DemoAppl' */, 
+  
+  {
+    FBL_MTAB_CAL1_BLOCK_NUMBER /* Alternate Bank */, 
+    FBL_MTAB_NO_APPLVECT /* Application Vector Table */
+  } /* Name 'Cal1' */, 
+  
+  {
+    FBL_MTAB_CAL2_BLOCK_NUMBER /* Alternate Bank */, 
+    FBL_MTAB_NO_APPLVECT /* Application Vector Table */
+  } /* Name 'Cal2' */, 
+  
+  {
+    FBL_MTAB_CAL3_BLOCK_NUMBER /* Alternate Bank */, 
+    FBL_MTAB_NO_APPLVECT /* Application Vector Table */
+  } /* Name 'Cal3' */
+};
+#endif /* FBL_ENABLE_AB_BANK_MODE */
 #define FBL_LBT_STOP_SEC_CONST
 #include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
 
@@ -66,6 +66,14 @@
 #define verifyRAM                            verifyInput
 #define verifyROM                            verifyOutput
 
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+/* Bank table: logical block contains no application vector table */
+#define FBL_MTAB_NO_APPLVECT                 0x00u
+/* Macros to access the bank table */
+#define FblLbtGetBankPartner(blockNr)        (FblLogicalBlockBankTable[(blockNr)].partnerBlockNr)
+#define FblLbtIsBanked(blockNr)              (FblLbtGetBankPartner(blockNr) != (blockNr))
+#endif /* FBL_ENABLE_AB_BANK_MODE */
+
 /* Typedefs ****************************************************************** */
 
 /* Entry type of logical block table */
@@ -87,10 +95,22 @@ typedef struct tLogicalBlockTableTag
   tBlockDescriptor logicalBlock[FBL_MTAB_NO_OF_BLOCKS];
 } tLogicalBlockTable;
 
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+/* Bank assignment of a logical block */
+typedef struct tBlockBankDescriptorTag
+{
+  vuint8 partnerBlockNr; /* Number of logical block holding the alternate bank (own number if block is not banked) */
+  tFblAddress applVectAddress; /* Address of application vector table in this bank (FBL_MTAB_NO_APPLVECT if none) */
+} tBlockBankDescriptor;
+#endif /* FBL_ENABLE_AB_BANK_MODE */
+
 /* Global data *************************************************************** */
 #define FBL_LBT_START_SEC_CONST
 #include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
 V_MEMROM0 extern  V_MEMROM1 tLogicalBlockTable V_MEMROM2 FblLogicalBlockTable;
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+V_MEMROM0 extern  V_MEMROM1 tBlockBankDescriptor V_MEMROM2 FblLogicalBlockBankTable[FBL_MTAB_NO_OF_BLOCKS];
+#endif /* FBL_ENABLE_AB_BANK_MODE */
 #define FBL_LBT_STOP_SEC_CONST
 #include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
 
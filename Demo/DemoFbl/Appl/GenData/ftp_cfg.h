@@ -60,6 +60,7 @@
 #define FBL_TP_DISABLE_VARIABLE_TX_DLC
 #define FBL_TP_ENABLE_FIX_RX_DLC_CHECK
 #define FBL_TP_DISABLE_VARIABLE_RX_DLC
+#define FBL_TP_DISABLE_CAN_FD
 #define FBL_TP_ENABLE_INTERNAL_MEMCPY
 #define TpCallCycle                          1
 #define FBL_TP_ENABLE_CONFIRMATION_INTERRUPT
@@ -350,6 +350,9 @@ void ApplFblTask( void );
     defined( FBL_ENABLE_APPL_STATE_TASK )
 void ApplFblStateTask( void );
 #endif /* FBL_ENABLE_APPL_TASK || FBL_ENABLE_APPL_STATE_TASK */
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+void ApplFblIdleTask( void );
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
 
 #if defined( FBL_ENABLE_ASSERTION )
 void ApplFblFatalError( FBL_DECL_ASSERT_EXTENDED_INFO(vuint8 errorCode) );
@@ -315,6 +315,18 @@
 /* SecAccessDelayFlags */
 #define kEepSecAccessDelayActive          0xA7u
 #define kEepSecAccessDelayInactive        0xFFu
+#if defined( FBL_ENABLE_BOOT_DESCRIPTOR )
+/* BootDescriptor */
+# define kEepBootDescriptorValid           0xB7u
+# define kEepBootDescriptorInvalid         0xFFu
+/* Boot descriptor layout: generation (2 bytes), state, logical block number, CRC (4 bytes) */
+# define kBootDescOffsetGeneration         0x00u
+# define kBootDescSizeGeneration           0x02u
+# define kBootDescOffsetState              0x02u
+# define kBootDescOffsetBlockNr            0x03u
+# define kBootDescOffsetCrc                0x04u
+# define kBootDescSizeCrc                  0x04u
+#endif /* FBL_ENABLE_BOOT_DESCRIPTOR */
 
 /* Size of validation bitfield */
 #if defined( kEepSizeValidityFlags )
@@ -390,6 +402,11 @@ tFblResult ApplFblWriteCRCTotal( V_MEMRAM1 tBlockDescriptor V_MEMRAM2 V_MEMRAM3
 tFblResult ApplFblValidateApp( void );
 tFblResult ApplFblInvalidateApp( void );
 #endif /* FBL_APPL_ENABLE_STARTUP_DEPENDENCY_CHECK */
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+tFblResult ApplFblIsValidBankPartner( vuint8 blockNr );
+tFblResult ApplFblGetActiveApplVect( V_MEMRAM1 tFblAddress V_MEMRAM2 V_MEMRAM3 * applVect );
+void ApplFblMergeBankValidity( V_MEMRAM1 vuint8 V_MEMRAM2 V_MEMRAM3 * validityFlags );
+#endif /* FBL_ENABLE_AB_BANK_MODE */
 
 #endif /* __FBL_APNV_H__ */
 
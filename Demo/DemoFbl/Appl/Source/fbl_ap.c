@@ -374,6 +374,47 @@
 #  endif /* GetOemEncryptionMode */
 # endif /* FBL_ENABLE_DATA_PROCESSING */
 
+#if defined( FBL_ENABLE_DATA_PROCESSING ) && \
+    defined( FBL_ENABLE_COMPRESSION_MODE )
+/*
+   LZSS decompression (compression routine "1")
+   Stream of groups, each consisting of a flag byte followed by up to eight items. Flag bits are evaluated
+   starting with the LSB:
+     1: Literal, one byte copied to the output
+     0: Match, two bytes (big endian): upper 10 bits distance - 1, lower 6 bits length - 3
+*/
+/** Size of history window, has to be a power of two (10 bit distance) */
+# define FBL_AP_LZSS_WINDOW_SIZE          1024u
+/** Minimum length of a match */
+# define FBL_AP_LZSS_MIN_MATCH            3u
+/** Bit mask and shift of length within match token */
+# define FBL_AP_LZSS_LENGTH_MASK          0x3Fu
+# define FBL_AP_LZSS_DISTANCE_SHIFT       6u
+/** Number of items controlled by one flag byte */
+# define FBL_AP_LZSS_FLAG_COUNT           8u
+#endif /* FBL_ENABLE_DATA_PROCESSING && FBL_ENABLE_COMPRESSION_MODE */
+
+/***********************************************************************************************************************
+ *  TYPEDEFS
+ **********************************************************************************************************************/
+
+#if defined( FBL_ENABLE_DATA_PROCESSING ) && \
+    defined( FBL_ENABLE_COMPRESSION_MODE )
+/** State of LZSS decompression, persistent across calls of ApplFblDataProcessing */
+typedef struct
+{
+   vuint8   window[FBL_AP_LZSS_WINDOW_SIZE];  /**< History of decompressed data */
+   vuint32  outputCount;                       /**< Total number of decompressed bytes */
+   vuint16  windowPos;                         /**< Next write position in history window */
+   vuint16  matchDistance;                     /**< Distance of active match */
+   vuint16  matchLength;                       /**< Remaining length of active match */
+   vuint8   flags;                             /**< Current flag byte */
+   vuint8   flagCount;                         /**< Number of remaining flag bits */
+   vuint8   token;                             /**< First byte of match token */
+   vuint8   tokenPending;                      /**< First byte of match token received */
+} tFblApLzssState;
+#endif /* FBL_ENABLE_DATA_PROCESSING && FBL_ENABLE_COMPRESSION_MODE */
+
 /***********************************************************************************************************************
  *  GLOBAL DATA
  **********************************************************************************************************************/
@@ -396,6 +437,11 @@ V_MEMRAM0 static V_MEMRAM1 SecM_SeedType V_MEMRAM2 secSeedInput;     /**< Initia
 V_MEMRAM0 static V_MEMRAM1 SecM_SeedType V_MEMRAM2 seed;             /**< Current seed value */
 V_MEMRAM0 static V_MEMRAM1 vuint8 V_MEMRAM2 securitySeedResponse;    /**< Seed response status */
 
+#if defined( FBL_ENABLE_DATA_PROCESSING ) && \
+    defined( FBL_ENABLE_COMPRESSION_MODE )
+V_MEMRAM0 static V_MEMRAM1 tFblApLzssState V_MEMRAM2 lzssState;      /**< Decompression state */
+#endif /* FBL_ENABLE_DATA_PROCESSING && FBL_ENABLE_COMPRESSION_MODE */
+
 /***********************************************************************************************************************
  *  EXTERNAL DATA
  **********************************************************************************************************************/
@@ -403,6 +449,10 @@ V_MEMRAM0 static V_MEMRAM1 vuint8 V_MEMRAM2 securitySeedResponse;    /**< Seed r
 /***********************************************************************************************************************
  *  LOCAL FUNCTION PROTOTYPES
  **********************************************************************************************************************/
+#if defined( FBL_ENABLE_DATA_PROCESSING ) && \
+    defined( FBL_ENABLE_COMPRESSION_MODE )
+static tFblResult ApplFblLzssDecompress( tProcParam * procParam );
+#endif /* FBL_ENABLE_DATA_PROCESSING && FBL_ENABLE_COMPRESSION_MODE */
 unsigned char test;//vcshzdn
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
@@ -792,6 +842,13 @@ vuint8 ApplFblCheckProgDependencies( void )
       {
          result = kDiagCheckCompatibilityFailed;   /* General failure - validity flags couldn't be read */
       }
+# if defined( FBL_ENABLE_AB_BANK_MODE )
+      else
+      {
+         /* Mandatory banked blocks are present if either bank is valid */
+         ApplFblMergeBankValidity(validityFlags);
+      }
+# endif /* FBL_ENABLE_AB_BANK_MODE */
 #endif
       if (result == kDiagCheckCompatibilityOk)
       {
@@ -1066,6 +1123,99 @@ vuint8 ApplFblSecurityInit( void )
 }
 
 #if defined( FBL_ENABLE_DATA_PROCESSING )
+# if defined( FBL_ENABLE_COMPRESSION_MODE )
+/***********************************************************************************************************************
+ *  ApplFblLzssDecompress
+ **********************************************************************************************************************/
+/*! \brief         Streaming LZSS decompression
+ *  \details       Produces at most dataOutMaxLength bytes per call. Partially received items and pending matches are
+ *                 kept in lzssState, so the compressed stream may be split at arbitrary positions.
+ *  \pre           Decompression initialized by ApplFblInitDataProcessing
+ *  \param[in,out] procParam Processing parameter data structure
+ *  \return        kFblOk if stream is consistent, kFblFailed otherwise
+ **********************************************************************************************************************/
+static tFblResult ApplFblLzssDecompress( tProcParam * procParam )
+{
+   tFblResult result;
+   vuint16 inPos;
+   vuint16 outPos;
+   vuint8  data;
+
+   result = kFblOk;
+   inPos  = 0u;
+   outPos = 0u;
+
+   while ((outPos < procParam->dataOutMaxLength) && (kFblOk == result))
+   {
+      if (lzssState.matchLength > 0u)
+      {
+         /* Continue active match from history window */
+         data = lzssState.window[(vuint16)(lzssState.windowPos - lzssState.matchDistance) & (FBL_AP_LZSS_WINDOW_SIZE - 1u)];
+         lzssState.matchLength--;
+      }
+      else if (inPos >= procParam->dataLength)
+      {
+         /* Wait for more input data */
+         break;
+      }
+      else if (0u == lzssState.flagCount)
+      {
+         lzssState.flags     = procParam->dataBuffer[inPos];
+         lzssState.flagCount = FBL_AP_LZSS_FLAG_COUNT;
+         inPos++;
+         continue;
+      }
+      else if ((lzssState.flags & 0x01u) != 0u)
+      {
+         /* Literal */
+         data = procParam->dataBuffer[inPos];
+         inPos++;
+         lzssState.flags >>= 1u;
+         lzssState.flagCount--;
+      }
+      else if (0u == lzssState.tokenPending)
+      {
+         /* First byte of match token */
+         lzssState.token        = procParam->dataBuffer[inPos];
+         lzssState.tokenPending = 1u;
+         inPos++;
+         continue;
+      }
+      else
+      {
+         /* Match token complete */
+         data = procParam->dataBuffer[inPos];
+         inPos++;
+         lzssState.flags >>= 1u;
+         lzssState.flagCount--;
+         lzssState.tokenPending  = 0u;
+         lzssState.matchDistance = (vuint16)((((vuint16)lzssState.token << 8u) | data) >> FBL_AP_LZSS_DISTANCE_SHIFT) + 1u;
+         lzssState.matchLength   = (vuint16)(data & FBL_AP_LZSS_LENGTH_MASK) + FBL_AP_LZSS_MIN_MATCH;
+
+         /* Distance must not reach beyond start of data */
+         if (lzssState.matchDistance > lzssState.outputCount)
+         {
+            result = kFblFailed;
+         }
+         continue;
+      }
+
+      /* Store decompressed byte in output buffer and history window */
+      procParam->dataOutBuffer[outPos] = data;
+      outPos++;
+      lzssState.window[lzssState.windowPos] = data;
+      lzssState.windowPos = (vuint16)(lzssState.windowPos + 1u) & (FBL_AP_LZSS_WINDOW_SIZE - 1u);
+      lzssState.outputCount++;
+   }
+
+   /* Report consumed and produced length */
+   procParam->dataLength    = inPos;
+   procParam->dataOutLength = outPos;
+
+   return result;
+}
+# endif /* FBL_ENABLE_COMPRESSION_MODE */
+
 /***********************************************************************************************************************
  *  ApplFblInitDataProcessing
  **********************************************************************************************************************/
@@ -1075,11 +1225,32 @@ vuint8 ApplFblSecurityInit( void )
  **********************************************************************************************************************/
 tFblResult ApplFblInitDataProcessing( tProcParam * procParam )
 {
-   /* Example implementation. Data not processed at all. */
    tFblResult result;
 
    result = kFblOk;
 
+# if defined( FBL_ENABLE_COMPRESSION_MODE )
+   if (GetOemCompressionMode(procParam->mode))
+   {
+      /* Reset decompression state */
+      lzssState.outputCount   = 0u;
+      lzssState.windowPos     = 0u;
+      lzssState.matchLength   = 0u;
+      lzssState.flagCount     = 0u;
+      lzssState.tokenPending  = 0u;
+   }
+   else
+# endif /* FBL_ENABLE_COMPRESSION_MODE */
+   if (FblDiagGetCompressionMode(procParam->mode) != kDiagSubNoCompression)
+   {
+      /* Compression routine not supported */
+      result = kFblFailed;
+   }
+   else
+   {
+      /* Example implementation. Data not processed at all. */
+   }
+
    return result;
 }
 
@@ -1093,27 +1264,38 @@ tFblResult ApplFblInitDataProcessing( tProcParam * procParam )
  **********************************************************************************************************************/
 tFblResult ApplFblDataProcessing( tProcParam * procParam )
 {
-   /* Example implementation. Data not processed at all. */
    tFblResult result;
 
    result = kFblOk;
 
-   /* Calculate output length. Length will not change */
-   if (procParam->dataLength > procParam->dataOutMaxLength)
+   FblLookForWatchdogVoid();
+
+# if defined( FBL_ENABLE_COMPRESSION_MODE )
+   if (GetOemCompressionMode(procParam->mode))
    {
-      procParam->dataOutLength = procParam->dataOutMaxLength;
+      result = ApplFblLzssDecompress(procParam);
    }
    else
+# endif /* FBL_ENABLE_COMPRESSION_MODE */
    {
-      procParam->dataOutLength = procParam->dataLength;
-   }
+      /* Example implementation. Data not processed at all. */
 
-   /* Update actually consumed length */
-   procParam->dataLength = procParam->dataOutLength;
+      /* Calculate output length. Length will not change */
+      if (procParam->dataLength > procParam->dataOutMaxLength)
+      {
+         procParam->dataOutLength = procParam->dataOutMaxLength;
+      }
+      else
+      {
+         procParam->dataOutLength = procParam->dataLength;
+      }
 
-   /* Copy data from input to output buffer. */
-   FblLookForWatchdogVoid();
-   (void)MEMCPY(procParam->dataOutBuffer, procParam->dataBuffer, procParam->dataOutLength);
+      /* Update actually consumed length */
+      procParam->dataLength = procParam->dataOutLength;
+
+      /* Copy data from input to output buffer. */
+      (void)MEMCPY(procParam->dataOutBuffer, procParam->dataBuffer, procParam->dataOutLength);
+   }
 
    return result;
 }
@@ -1128,12 +1310,22 @@ tFblResult ApplFblDataProcessing( tProcParam * procParam )
  **********************************************************************************************************************/
 tFblResult ApplFblDeinitDataProcessing( tProcParam * procParam )
 {
-   /* Example implementation. Data not processed at all. */
    tFblResult result;
 
    /* Conclude data processing in last round */
    result = ApplFblDataProcessing(procParam);
 
+# if defined( FBL_ENABLE_COMPRESSION_MODE )
+   if (GetOemCompressionMode(procParam->mode))
+   {
+      /* Compressed stream must not end within a match */
+      if ((lzssState.matchLength != 0u) || (lzssState.tokenPending != 0u))
+      {
+         result = kFblFailed;
+      }
+   }
+# endif /* FBL_ENABLE_COMPRESSION_MODE */
+
    return result;
 }
 #endif /* FBL_ENABLE_DATA_PROCESSING */
@@ -1178,6 +1370,19 @@ void ApplFblStateTask( void )
 }
 #endif /* FBL_ENABLE_APPL_TASK || FBL_ENABLE_APPL_STATE_TASK */
 
+#if defined( FBL_MAIN_ENABLE_EVENT_SCHEDULER )
+/***********************************************************************************************************************
+ *  ApplFblIdleTask
+ **********************************************************************************************************************/
+/*! \brief       Called by the main loop if no event is pending.
+ *  \details     The CPU may be put into a low power state (e.g. HALT) here. This is only allowed if the 1ms timer
+ *               and the CAN controller are configured as wake-up sources, as both are polled by the main loop.
+ **********************************************************************************************************************/
+void ApplFblIdleTask( void )
+{
+}
+#endif /* FBL_MAIN_ENABLE_EVENT_SCHEDULER */
+
 #if defined( FBL_ENABLE_ASSERTION )
 /***********************************************************************************************************************
  *  ApplFblFatalError
@@ -1317,8 +1522,18 @@ void ApplFblBusSleep( void )
  **********************************************************************************************************************/
 void ApplFblStartApplication( void )
 {
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+   tFblAddress applVect;
+
+   /* Start application located in active bank */
+   if (ApplFblGetActiveApplVect(&applVect) == kFblOk)
+   {
+      JSR(((volatile vuint32 *)applVect)[1u]); /* PRQA S 0306 */ /* MD_FblKbApi_0306 */
+   }
+#else
    /* Start application */
    JSR_APPL();
+#endif /* FBL_ENABLE_AB_BANK_MODE */
 
 #if defined( FBL_ENABLE_SYSTEM_CHECK )
    /* Code should never be reached */
@@ -1331,6 +1546,11 @@ void ApplFblStartApplication( void )
 
 /* Module specific MISRA deviations:
 
+   MD_FblKbApi_0306:
+      Reason: Address of application vector table is stored as integral value in the logical block bank table.
+      Risk: Size of integer type may not be sufficient to hold the pointer value.
+      Prevention: Integer type used for addresses is large enough on this platform.
+
    MD_FblKbApi_3201:
       Reason: Configuration or platform specific dependent unreachable code.
       Risk: Incorrect behavior depend on settings.
@@ -406,6 +406,10 @@ void ApplFblReadDataByIdentifier( vuint8 * pbDiagData, tTpDataType diagReqDataLe
    {
       /* Bootloader Version */
       { 0xF123u, 3u }
+#if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+      /* Runtime statistic of bootloader tasks */
+      ,{ 0xFD00u, kFblMainRuntimeDumpSize }
+#endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
    };
 
    vuint16 diagRespDataLen;
@@ -497,6 +501,15 @@ void ApplFblReadDataByIdentifier( vuint8 * pbDiagData, tTpDataType diagReqDataLe
 
                break;
             }
+#if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+            /* Runtime statistic of bootloader tasks */
+            case 0xFD00u:
+            {
+               (void)FblMainRuntimeDump(&diagData[2], kFblMainRuntimeDumpSize);
+
+               break;
+            }
+#endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
             default:
             {
                break;
@@ -325,11 +325,36 @@ V_MEMROM0 static V_MEMROM1 vuint8 V_MEMROM2 blockPresencePattern[kFblPresencePat
 /* PRQA L:TAG_FblApNv_3453_1 */
 #endif /* FBL_ENABLE_PRESENCE_PATTERN */
 
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+/* PRQA S 3453 2 */ /* MD_MSR_19.7 */
+/* Check validity of logical block in validity bitfield (stored inverted) */
+# define ApplFblIsValidityFlagSet(flags, blockNr)      (((flags)[(blockNr) >> 3u] & (vuint8)(0x01u << ((blockNr) & 0x07u))) == 0x00u)
+#endif /* FBL_ENABLE_AB_BANK_MODE */
+
 /* Configuration check */
 # if ( kEepSizeValidityFlags != kNrOfValidationBytes )
 #  error "Size of block validity data is not correct. Check GENy configuration of size."
 # endif
 
+#if defined( FBL_ENABLE_AB_BANK_MODE ) && \
+    defined( FBL_ENABLE_PRESENCE_PATTERN ) && \
+    defined( FBL_APPL_ENABLE_STARTUP_DEPENDENCY_CHECK )
+# error "A/B bank mode requires block validity flags stored in NV-memory."
+#endif
+
+#if defined( FBL_ENABLE_BOOT_DESCRIPTOR )
+# if defined( FBL_APPL_ENABLE_STARTUP_DEPENDENCY_CHECK )
+#  error "Boot descriptor is written by ApplFblValidateApp and not available with startup dependency check."
+# endif
+# if defined( SEC_ENABLE_CRC_TYPE_CRC32 )
+# else
+#  error "Boot descriptor requires CRC-32 support of the security module."
+# endif
+# if ( kEepSizeBootDescriptor != (kBootDescOffsetCrc + kBootDescSizeCrc) )
+#  error "Size of boot descriptor is not correct. Check GENy configuration of size."
+# endif
+#endif /* FBL_ENABLE_BOOT_DESCRIPTOR */
+
 /***********************************************************************************************************************
  *  LOCAL DATA TYPES AND STRUCTURES
  **********************************************************************************************************************/
@@ -355,9 +380,10 @@ V_MEMRAM0 static V_MEMRAM1 vuint8 V_MEMRAM2 blockFingerprint[kEepSizeFingerprint
 
 #if defined( FBL_APPL_ENABLE_STARTUP_DEPENDENCY_CHECK )
 #else
-# if defined( FBL_ENABLE_PRESENCE_PATTERN )
+# if defined( FBL_ENABLE_PRESENCE_PATTERN ) || \
+     defined( FBL_ENABLE_BOOT_DESCRIPTOR )
 V_MEMRAM0 static V_MEMRAM1 tBlockDescriptor V_MEMRAM2 currentValidatedBlock;
-# endif /* FBL_ENABLE_PRESENCE_PATTERN */
+# endif /* FBL_ENABLE_PRESENCE_PATTERN || FBL_ENABLE_BOOT_DESCRIPTOR */
 #endif /* FBL_APPL_ENABLE_STARTUP_DEPENDENCY_CHECK */
 
 /***********************************************************************************************************************
@@ -374,6 +400,12 @@ static tFblResult ApplFblClrModulePresence( tBlockDescriptor * blockDescriptor )
 #else
 static tFblResult ApplFblChgBlockValid( vuint8 mode, tBlockDescriptor descriptor );
 #endif /* FBL_ENABLE_PRESENCE_PATTERN */
+#if defined( FBL_ENABLE_BOOT_DESCRIPTOR )
+static tFblResult ApplFblGetBootGeneration( vuint8 blockNr, V_MEMRAM1 vuint16 V_MEMRAM2 V_MEMRAM3 * generation );
+static vuint32 ApplFblCalcBootDescriptorCrc( const V_MEMRAM1 vuint8 V_MEMRAM2 V_MEMRAM3 * bootDescriptor );
+static tFblResult ApplFblWriteBootDescriptor( vuint8 blockNr, vuint8 state );
+static tApplStatus ApplFblChkBootDescriptor( void );
+#endif /* FBL_ENABLE_BOOT_DESCRIPTOR */
 
 /***********************************************************************************************************************
  *   GLOBAL FUNCTIONS
@@ -387,6 +419,8 @@ static tFblResult ApplFblChgBlockValid( vuint8 mode, tBlockDescriptor descriptor
  **********************************************************************************************************************/
 /*! \brief       This function changes the validation flag of a logical block.
  *               The state information is stored inverted.
+ *  \details     In A/B bank mode the validation of a banked logical block invalidates the alternate bank with the same
+ *               write access. This activates the new bank by a single update of the validity flags.
  *  \pre         EEPROM driver must be initialized before call
  *  \param[in]   mode (kEepValidateBlock/kEepInvalidateBlock)
  *  \param[in]   descriptor Block descriptor
@@ -400,9 +434,14 @@ static tFblResult ApplFblChgBlockValid( vuint8 mode, tBlockDescriptor descriptor
    vuint8         byteIdx;
    vuint8         validityFlags[kEepSizeValidityFlags];
    vuint8         validityCheck[kEepSizeValidityFlags];
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+   vuint8         partnerBlockNr;
+#endif /* FBL_ENABLE_AB_BANK_MODE */
+   vuint8         partnerByteIdx;
 
    byteIdx = (vuint8)(descriptor.blockNr >> 0x03u);
    validityMask = (vuint8)(0x01u << (descriptor.blockNr & 0x07u));
+   partnerByteIdx = byteIdx;
 
    result = kFblFailed;
 
@@ -411,6 +450,15 @@ static tFblResult ApplFblChgBlockValid( vuint8 mode, tBlockDescriptor descriptor
       if (mode == kEepValidateBlock)
       {
          validityFlags[byteIdx] &= FblInvert8Bit(validityMask);
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+         if (FblLbtIsBanked(descriptor.blockNr))
+         {
+            /* Switch over to new bank: invalidate alternate bank */
+            partnerBlockNr = FblLbtGetBankPartner(descriptor.blockNr);
+            partnerByteIdx = (vuint8)(partnerBlockNr >> 0x03u);
+            validityFlags[partnerByteIdx] |= (vuint8)(0x01u << (partnerBlockNr & 0x07u));
+         }
+#endif /* FBL_ENABLE_AB_BANK_MODE */
       }
       else
       {
@@ -424,7 +472,7 @@ static tFblResult ApplFblChgBlockValid( vuint8 mode, tBlockDescriptor descriptor
          if (ApplFblNvReadValidityFlags(validityCheck) == kFblOk)
          {
             /* Check if flags were written correctly */
-            if (validityCheck[byteIdx] == validityFlags[byteIdx])
+            if ((validityCheck[byteIdx] == validityFlags[byteIdx]) && (validityCheck[partnerByteIdx] == validityFlags[partnerByteIdx]))
             {
                result = kFblOk;
             }
@@ -435,6 +483,138 @@ static tFblResult ApplFblChgBlockValid( vuint8 mode, tBlockDescriptor descriptor
 }
 #endif /* FBL_ENABLE_PRESENCE_PATTERN */
 
+#if defined( FBL_ENABLE_BOOT_DESCRIPTOR )
+/***********************************************************************************************************************
+ *  ApplFblGetBootGeneration
+ **********************************************************************************************************************/
+/*! \brief       Read the generation of a logical block
+ *  \details     The programming attempt counter of the logical block is used as generation. It is incremented by
+ *               every erase operation, so a descriptor written before the last erase doesn't match anymore.
+ *  \param[in]   blockNr Logical block number
+ *  \param[out]  generation Current generation
+ *  \return      kFblOk if the counter could be read, kFblFailed otherwise
+ **********************************************************************************************************************/
+static tFblResult ApplFblGetBootGeneration( vuint8 blockNr, V_MEMRAM1 vuint16 V_MEMRAM2 V_MEMRAM3 * generation )
+{
+   tFblResult  result;
+   vuint8      nvBuffer[kEepSizeProgAttempts];
+
+   result = kFblFailed;
+
+   if (ApplFblNvReadProgAttempts(blockNr, nvBuffer) == kFblOk)
+   {
+      *generation = (vuint16)FblMemGetInteger(kEepSizeProgAttempts, nvBuffer);
+      result = kFblOk;
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  ApplFblCalcBootDescriptorCrc
+ **********************************************************************************************************************/
+/*! \brief       Calculate CRC over the boot descriptor contents preceding the CRC field
+ *  \param[in]   bootDescriptor Boot descriptor record
+ *  \return      CRC value
+ **********************************************************************************************************************/
+static vuint32 ApplFblCalcBootDescriptorCrc( const V_MEMRAM1 vuint8 V_MEMRAM2 V_MEMRAM3 * bootDescriptor )
+{
+   SecM_CRCParamType crcParam;
+
+   crcParam.wdTriggerFct = (FL_WDTriggerFctType)FblLookForWatchdog;
+
+   crcParam.crcState = SEC_CRC_INIT;
+   (void)SecM_ComputeCRC(&crcParam);
+
+   crcParam.crcState = SEC_CRC_COMPUTE;
+   crcParam.crcSourceBuffer = bootDescriptor;
+   crcParam.crcByteCount = (SecM_LengthType)kBootDescOffsetCrc;
+   (void)SecM_ComputeCRC(&crcParam);
+
+   crcParam.crcState = SEC_CRC_FINALIZE;
+   (void)SecM_ComputeCRC(&crcParam);
+
+   return (vuint32)crcParam.currentCRC;
+}
+
+/***********************************************************************************************************************
+ *  ApplFblWriteBootDescriptor
+ **********************************************************************************************************************/
+/*! \brief       Store the application validity decision in the boot descriptor
+ *  \details     The record is bound to the generation of the logical block and protected by a CRC. An invalid
+ *               descriptor is written with a deliberately wrong CRC.
+ *  \param[in]   blockNr Logical block the decision is bound to
+ *  \param[in]   state kEepBootDescriptorValid or kEepBootDescriptorInvalid
+ *  \return      kFblOk if descriptor was written, kFblFailed otherwise
+ **********************************************************************************************************************/
+static tFblResult ApplFblWriteBootDescriptor( vuint8 blockNr, vuint8 state )
+{
+   tFblResult  result;
+   vuint16     generation;
+   vuint32     crc;
+   vuint8      bootDescriptor[kEepSizeBootDescriptor];
+
+   result = ApplFblGetBootGeneration(blockNr, &generation);
+
+   if (result == kFblOk)
+   {
+      FblMemSetInteger(kBootDescSizeGeneration, generation, &bootDescriptor[kBootDescOffsetGeneration]);
+      bootDescriptor[kBootDescOffsetState]      = state;
+      bootDescriptor[kBootDescOffsetBlockNr]    = blockNr;
+
+      crc = ApplFblCalcBootDescriptorCrc(bootDescriptor);
+      if (state != kEepBootDescriptorValid)
+      {
+         crc = FblInvert32Bit(crc);
+      }
+      FblMemSetInteger(kBootDescSizeCrc, crc, &bootDescriptor[kBootDescOffsetCrc]);
+
+      if (ApplFblNvWriteBootDescriptor(bootDescriptor) != kFblOk)
+      {
+         result = kFblFailed;
+      }
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  ApplFblChkBootDescriptor
+ **********************************************************************************************************************/
+/*! \brief       Fast check of the application validity based on the boot descriptor
+ *  \details     The descriptor is only accepted if the CRC is correct, it reports a valid application and matches
+ *               the current generation of the referenced logical block.
+ *  \return      kApplValid if the cached decision can be used, kApplInvalid if the full check is required
+ **********************************************************************************************************************/
+static tApplStatus ApplFblChkBootDescriptor( void )
+{
+   tApplStatus applicationStatus;
+   vuint16     generation;
+   vuint8      bootDescriptor[kEepSizeBootDescriptor];
+
+   applicationStatus = kApplInvalid;
+
+   if (ApplFblNvReadBootDescriptor(bootDescriptor) == kFblOk)
+   {
+      if (   (bootDescriptor[kBootDescOffsetState] == kEepBootDescriptorValid)
+          && (bootDescriptor[kBootDescOffsetBlockNr] < (vuint8)FBL_MTAB_NO_OF_BLOCKS)
+          && (FblMemGetInteger(kBootDescSizeCrc, &bootDescriptor[kBootDescOffsetCrc]) == ApplFblCalcBootDescriptorCrc(bootDescriptor)))
+      {
+         /* Descriptor is intact, check that the logical block wasn't erased since it has been written */
+         if (ApplFblGetBootGeneration(bootDescriptor[kBootDescOffsetBlockNr], &generation) == kFblOk)
+         {
+            if (generation == (vuint16)FblMemGetInteger(kBootDescSizeGeneration, &bootDescriptor[kBootDescOffsetGeneration]))
+            {
+               applicationStatus = kApplValid;
+            }
+         }
+      }
+   }
+
+   return applicationStatus;
+}
+#endif /* FBL_ENABLE_BOOT_DESCRIPTOR */
+
 #if defined( FBL_ENABLE_PRESENCE_PATTERN )
 
 /***********************************************************************************************************************
@@ -533,6 +713,11 @@ static tFblResult ApplFblSetModulePresence( tBlockDescriptor * blockDescriptor )
 #endif
       (void)FblRealTimeSupport();
 
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+      /* Presence pattern is written directly through memory driver */
+      FblMemDiscardErasedState(presPtnAddress, presPtnLen);
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
+
       /* Write presence pattern */
       if (!ApplFblWritePattern(pFlashHeader, presPtnLen, presPtnAddress))
       {
@@ -613,6 +798,10 @@ static tFblResult ApplFblClrModulePresence( tBlockDescriptor * blockDescriptor )
             pFlashHeader[i] = 0;
          }
 #endif
+#if defined( FBL_MEM_ENABLE_ERASE_BLANK_CHECK )
+         /* Mask pattern is written directly through memory driver */
+         FblMemDiscardErasedState((presPtnAddress + presPtnLen), presPtnLen);
+#endif /* FBL_MEM_ENABLE_ERASE_BLANK_CHECK */
          /* Now write them */
          if (!ApplFblWritePattern(pFlashHeader, presPtnLen, (presPtnAddress + presPtnLen)))
          {
@@ -814,11 +1003,12 @@ tFblResult ApplFblValidateBlock( tBlockDescriptor blockDescriptor )
       result = kFblFailed;
    }
 #else
-# if defined( FBL_ENABLE_PRESENCE_PATTERN )
+# if defined( FBL_ENABLE_PRESENCE_PATTERN ) || \
+     defined( FBL_ENABLE_BOOT_DESCRIPTOR )
    /* Save block descriptor of currently validated block.
     * The block descriptor will be used to validate the application. */
    currentValidatedBlock = blockDescriptor;
-# endif /* FBL_ENABLE_PRESENCE_PATTERN */
+# endif /* FBL_ENABLE_PRESENCE_PATTERN || FBL_ENABLE_BOOT_DESCRIPTOR */
 
    /* Set current block valid */
    if (ApplFblChgBlockValid(kEepValidateBlock, blockDescriptor) != kFblOk)
@@ -856,6 +1046,22 @@ tFblResult ApplFblInvalidateBlock( tBlockDescriptor blockDescriptor )
 # if defined( FBL_APPL_ENABLE_STARTUP_DEPENDENCY_CHECK )
    result = kFblOk;
 # else
+#  if defined( FBL_ENABLE_BOOT_DESCRIPTOR )
+   /* Discard cached validity decision before any memory is changed */
+   if (ApplFblWriteBootDescriptor(blockDescriptor.blockNr, kEepBootDescriptorInvalid) != kFblOk)
+   {
+      result = kFblFailed;
+   }
+   else
+#  endif /* FBL_ENABLE_BOOT_DESCRIPTOR */
+#  if defined( FBL_ENABLE_AB_BANK_MODE )
+   /* Alternate bank holds a valid image: application stays valid while the inactive bank is reprogrammed */
+   if (kFblOk == ApplFblIsValidBankPartner(blockDescriptor.blockNr))
+   {
+      result = kFblOk;
+   }
+   else
+#  endif /* FBL_ENABLE_AB_BANK_MODE */
       /* Invalidate application validity flag */
       {
          result = ApplFblInvalidateApp();
@@ -886,6 +1092,8 @@ tFblResult ApplFblInvalidateBlock( tBlockDescriptor blockDescriptor )
 /*! \brief       Function is called on power-up to check if the application is successfully validated or not.
  *  \details     Returns kApplValid if application is valid (all mandatory blocks available) and application start is
  *               allowed. Otherwise it returns kApplInvalid.
+ *               With boot descriptor enabled the decision cached at the end of programming is used if it is still
+ *               consistent, the full check is only executed as fallback.
  **********************************************************************************************************************/
 tApplStatus ApplFblIsValidApp( void )
 {
@@ -899,43 +1107,74 @@ tApplStatus ApplFblIsValidApp( void )
    vuint8 applValidity;
 # endif /* FBL_ENABLE_PRESENCE_PATTERN */
 #endif /* FBL_APPL_ENABLE_STARTUP_DEPENDENCY_CHECK */
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+   tFblAddress applVect;
+#endif /* FBL_ENABLE_AB_BANK_MODE */
 
    /* Initialize variables */
    applicationStatus = kApplInvalid;
 
-#if defined( FBL_APPL_ENABLE_STARTUP_DEPENDENCY_CHECK )
-   /* Execute programming dependencies check here. Block validity has to be checked as well. */
-   if (ApplFblCheckProgDependencies() == 0x00u)
+#if defined( FBL_ENABLE_BOOT_DESCRIPTOR )
+   /* Fast path: use the validity decision cached at the end of programming */
+   applicationStatus = ApplFblChkBootDescriptor();
+   if (applicationStatus == kApplInvalid)
+#endif /* FBL_ENABLE_BOOT_DESCRIPTOR */
    {
-      applicationStatus = kApplValid;
-   }
+#if defined( FBL_APPL_ENABLE_STARTUP_DEPENDENCY_CHECK )
+      /* Execute programming dependencies check here. Block validity has to be checked as well. */
+      if (ApplFblCheckProgDependencies() == 0x00u)
+      {
+         applicationStatus = kApplValid;
+      }
 #else
 # if defined( FBL_ENABLE_PRESENCE_PATTERN )
-   /* Read validity from application validity pattern
-    * Scan all logical blocks until one block with application valid flag is found */
-   currentBlockNr = FBL_MTAB_NO_OF_BLOCKS;
-   while ((currentBlockNr > 0u) && (applicationStatus == kApplInvalid))
-   {
-      currentBlockNr--;
-      tempBlockDescriptor = FblLogicalBlockTable.logicalBlock[currentBlockNr];
-      if (ApplFblChkModulePresence(&tempBlockDescriptor) == kFblOk)
+      /* Read validity from application validity pattern
+       * Scan all logical blocks until one block with application valid flag is found */
+      currentBlockNr = FBL_MTAB_NO_OF_BLOCKS;
+      while ((currentBlockNr > 0u) && (applicationStatus == kApplInvalid))
       {
-         applicationStatus = kApplValid;
+         currentBlockNr--;
+         tempBlockDescriptor = FblLogicalBlockTable.logicalBlock[currentBlockNr];
+         if (ApplFblChkModulePresence(&tempBlockDescriptor) == kFblOk)
+         {
+            applicationStatus = kApplValid;
+         }
       }
-   }
 # else
-   /* Read validity from NV-memory */
-   if (ApplFblNvReadApplValidity(&applValidity) == kFblOk)
-   {
-      if (applValidity == kEepApplConsistent)
+      /* Read validity from NV-memory */
+      if (ApplFblNvReadApplValidity(&applValidity) == kFblOk)
       {
-         applicationStatus = kApplValid;
+         if (applValidity == kEepApplConsistent)
+         {
+            applicationStatus = kApplValid;
+         }
       }
-   }
 # endif /* FBL_ENABLE_PRESENCE_PATTERN */
 #endif /* FBL_APPL_ENABLE_STARTUP_DEPENDENCY_CHECK */
+   }
 
-#if ( FBL_PROJECT_STATE >= FBL_INTEGRATION )
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+   if (applicationStatus == kApplValid)
+   {
+      /* Application can only be started if a bank holding the application vector table is active */
+      if (ApplFblGetActiveApplVect(&applVect) != kFblOk)
+      {
+         applicationStatus = kApplInvalid;
+      }
+# if ( FBL_PROJECT_STATE >= FBL_INTEGRATION )
+      else if (((volatile vuint32 *)applVect)[0u] == APPLVECT_FROM_BOOT) /* PRQA S 0306 */ /* MD_FblKbApi_0306 */
+      {
+         /* Active bank contains an APPLVECT_FROM_BOOT, start of application not possible */
+         applicationStatus = kApplInvalid;
+      }
+# endif /* FBL_PROJECT_STATE >= FBL_INTEGRATION */
+      else
+      {
+         /* Application in active bank can be started */
+      }
+   }
+#else
+# if ( FBL_PROJECT_STATE >= FBL_INTEGRATION )
    if ((applicationStatus == kApplValid) && (FblCheckBootVectTableIsValid()))
    {
       /* Application is valid but contains an APPLVECT_FROM_BOOT.
@@ -943,7 +1182,8 @@ tApplStatus ApplFblIsValidApp( void )
        * Probably the Bootloader was reprogrammed with a debugger. */
       applicationStatus = kApplInvalid;
    }
-#endif /* FBL_PROJECT_STATE >= FBL_INTEGRATION */
+# endif /* FBL_PROJECT_STATE >= FBL_INTEGRATION */
+#endif /* FBL_ENABLE_AB_BANK_MODE */
 
    return applicationStatus;
 }  /* PRQA S 2006 */ /* MD_MSR_14.7 */
@@ -1240,14 +1480,35 @@ tFblResult ApplFblValidateApp( void )
    vuint8 applValidity;
 # endif /* FBL_ENABLE_PRESENCE_PATTERN */
 
+   /* Application validity and boot descriptor become visible together */
+   if (ApplFblNvTransactionStart() != kFblOk)
+   {
+      result = kFblFailed;
+   }
+   else
+   {
 # if defined( FBL_ENABLE_PRESENCE_PATTERN )
-   /* Set presence pattern in last flashed logical block. */
-   result = ApplFblSetModulePresence(&currentValidatedBlock);
+      /* Set presence pattern in last flashed logical block. */
+      result = ApplFblSetModulePresence(&currentValidatedBlock);
 # else
-   applValidity = kEepApplConsistent;
-   result = (tFblResult)ApplFblNvWriteApplValidity(&applValidity);
+      applValidity = kEepApplConsistent;
+      result = (tFblResult)ApplFblNvWriteApplValidity(&applValidity);
 # endif /* FBL_ENABLE_PRESENCE_PATTERN */
 
+# if defined( FBL_ENABLE_BOOT_DESCRIPTOR )
+      if (result == kFblOk)
+      {
+         /* Cache validity decision for the next startup. Not fatal if it fails, full check is done instead. */
+         (void)ApplFblWriteBootDescriptor(currentValidatedBlock.blockNr, kEepBootDescriptorValid);
+      }
+# endif /* FBL_ENABLE_BOOT_DESCRIPTOR */
+
+      if (ApplFblNvTransactionCommit() != kFblOk)
+      {
+         result = kFblFailed;
+      }
+   }
+
    return result;
 }
 
@@ -1288,7 +1549,108 @@ tFblResult ApplFblInvalidateApp( void )
 }
 #endif /* FBL_APPL_ENABLE_STARTUP_DEPENDENCY_CHECK */
 
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+/***********************************************************************************************************************
+ *  ApplFblIsValidBankPartner
+ **********************************************************************************************************************/
+/*! \brief       Check if the alternate bank of a logical block holds a valid image
+ *  \param[in]   blockNr Logical block number
+ *  \return      kFblOk if block is banked and the alternate bank is valid, kFblFailed otherwise
+ **********************************************************************************************************************/
+tFblResult ApplFblIsValidBankPartner( vuint8 blockNr )
+{
+   tFblResult  result;
+   vuint8      validityFlags[kEepSizeValidityFlags];
+
+   result = kFblFailed;
+
+   if (FblLbtIsBanked(blockNr))
+   {
+      if (ApplFblNvReadValidityFlags(validityFlags) == kFblOk)
+      {
+         if (ApplFblIsValidityFlagSet(validityFlags, FblLbtGetBankPartner(blockNr)))
+         {
+            result = kFblOk;
+         }
+      }
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  ApplFblGetActiveApplVect
+ **********************************************************************************************************************/
+/*! \brief       Get application vector table of the active bank
+ *  \details     The active bank is the valid logical block which contains an application vector table.
+ *  \param[out]  applVect Address of application vector table
+ *  \return      kFblOk if an active bank was found, kFblFailed otherwise
+ **********************************************************************************************************************/
+tFblResult ApplFblGetActiveApplVect( V_MEMRAM1 tFblAddress V_MEMRAM2 V_MEMRAM3 * applVect )
+{
+   tFblResult  result;
+   vuintx      currentBlockNr;
+   vuint8      validityFlags[kEepSizeValidityFlags];
+
+   result = kFblFailed;
+
+   if (ApplFblNvReadValidityFlags(validityFlags) == kFblOk)
+   {
+      currentBlockNr = 0u;
+      while ((currentBlockNr < FBL_MTAB_NO_OF_BLOCKS) && (result == kFblFailed))
+      {
+         if (  (FblLogicalBlockBankTable[currentBlockNr].applVectAddress != FBL_MTAB_NO_APPLVECT)
+            && (ApplFblIsValidityFlagSet(validityFlags, currentBlockNr)) )
+         {
+            *applVect = FblLogicalBlockBankTable[currentBlockNr].applVectAddress;
+            result = kFblOk;
+         }
+
+         currentBlockNr++;
+      }
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  ApplFblMergeBankValidity
+ **********************************************************************************************************************/
+/*! \brief         Merge validity of banked logical blocks
+ *  \details       A banked logical block is reported as valid if either bank holds a valid image. Used for the check of
+ *                 mandatory logical blocks.
+ *  \param[in,out] validityFlags Validity bitfield as stored in NV-memory (inverted)
+ **********************************************************************************************************************/
+void ApplFblMergeBankValidity( V_MEMRAM1 vuint8 V_MEMRAM2 V_MEMRAM3 * validityFlags )
+{
+   vuint8   currentBlockNr;
+   vuint8   partnerBlockNr;
+   vuint8   mergedFlags[kEepSizeValidityFlags];
+
+   /* Evaluate original flags only */
+   (void)MEMCPY(mergedFlags, validityFlags, kEepSizeValidityFlags);
+
+   for (currentBlockNr = 0u; currentBlockNr < FBL_MTAB_NO_OF_BLOCKS; currentBlockNr++)
+   {
+      partnerBlockNr = FblLbtGetBankPartner(currentBlockNr);
+
+      if (ApplFblIsValidityFlagSet(validityFlags, partnerBlockNr))
+      {
+         /* Alternate bank valid: report block as valid */
+         mergedFlags[currentBlockNr >> 3u] &= FblInvert8Bit((vuint8)(0x01u << (currentBlockNr & 0x07u)));
+      }
+   }
+
+   (void)MEMCPY(validityFlags, mergedFlags, kEepSizeValidityFlags);
+}
+#endif /* FBL_ENABLE_AB_BANK_MODE */
+
 /* Module specific MISRA deviations:
+   MD_FblKbApi_0306:
+      Reason: Address of application vector table is stored as integral value in the logical block bank table.
+      Risk: Size of integer type may not be sufficient to hold the pointer value.
+      Prevention: Integer type used for addresses is large enough on this platform.
+
    MD_FblKbApi_3201:
       Reason: Configuration or platform specific dependent unreachable code.
       Risk: Incorrect behavior depend on settings.
@@ -0,0 +1,513 @@
+/* -----------------------------------------------------------------------------
+  Filename:    fbl_apfb.c
+  Description: Host build flash block table of the demo bootloader
+
+               Derived from Demo/DemoFbl/Appl/GenData/fbl_apfb.c (P1M, GreenHills).
+               The code flash is extended to 4 MB (32 KB blocks up to 0x3FFFF,
+               64 KB blocks up to 0x3FFFFF) to allow downloads of several MB.
+ ----------------------------------------------------------------------------- */
+/* -----------------------------------------------------------------------------
+  C O P Y R I G H T
+ -------------------------------------------------------------------------------
+  Copyright (c) 2001-2015 by Vector Informatik GmbH. All rights reserved.
+ 
+  This software is copyright protected and proprietary to Vector Informatik 
+  GmbH.
+  
+  Vector Informatik GmbH grants to you only those rights as set out in the 
+  license conditions.
+  
+  All other rights remain with Vector Informatik GmbH.
+ -------------------------------------------------------------------------------
+ ----------------------------------------------------------------------------- */
+
+/* -----------------------------------------------------------------------------
+    &&&~ 
+ ----------------------------------------------------------------------------- */
+
+#define FBL_FBT_SOURCE
+
+/* Includes ****************************************************************** */
+#include "fbl_inc.h"
+
+/* Global data *************************************************************** */
+#define FBL_FBT_START_SEC_CONST
+#include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+V_MEMROM0 V_MEMROM1_FAR tFlashBlock V_MEMROM2_FAR FlashBlock[67] = 
+{
+  
+  {
+    0x018000u /* 32KB Block5 */, 
+    0x01FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x020000u /* 32KB Block6 */, 
+    0x027FFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x028000u /* 32KB Block7 */, 
+    0x02FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x030000u /* 32KB Block8 */, 
+    0x037FFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x038000u /* 32KB Block9 */, 
+    0x03FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x040000u /* 64KB Block10 */, 
+    0x04FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x050000u /* 64KB Block11 */, 
+    0x05FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x060000u /* 64KB Block12 */, 
+    0x06FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x070000u /* 64KB Block13 */, 
+    0x07FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x080000u /* 64KB Block14 */, 
+    0x08FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x090000u /* 64KB Block15 */, 
+    0x09FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x0A0000u /* 64KB Block16 */, 
+    0x0AFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x0B0000u /* 64KB Block17 */, 
+    0x0BFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x0C0000u /* 64KB Block18 */, 
+    0x0CFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x0D0000u /* 64KB Block19 */, 
+    0x0DFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x0E0000u /* 64KB Block20 */, 
+    0x0EFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x0F0000u /* 64KB Block21 */, 
+    0x0FFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x100000u /* 64KB Block22 */, 
+    0x10FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x110000u /* 64KB Block23 */, 
+    0x11FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x120000u /* 64KB Block24 */, 
+    0x12FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x130000u /* 64KB Block25 */, 
+    0x13FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x140000u /* 64KB Block26 */, 
+    0x14FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x150000u /* 64KB Block27 */, 
+    0x15FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x160000u /* 64KB Block28 */, 
+    0x16FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x170000u /* 64KB Block29 */, 
+    0x17FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x180000u /* 64KB Block30 */, 
+    0x18FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x190000u /* 64KB Block31 */, 
+    0x19FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x1A0000u /* 64KB Block32 */, 
+    0x1AFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x1B0000u /* 64KB Block33 */, 
+    0x1BFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x1C0000u /* 64KB Block34 */, 
+    0x1CFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x1D0000u /* 64KB Block35 */, 
+    0x1DFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x1E0000u /* 64KB Block36 */, 
+    0x1EFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x1F0000u /* 64KB Block37 */, 
+    0x1FFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x200000u /* 64KB Block38 */, 
+    0x20FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x210000u /* 64KB Block39 */, 
+    0x21FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x220000u /* 64KB Block40 */, 
+    0x22FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x230000u /* 64KB Block41 */, 
+    0x23FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x240000u /* 64KB Block42 */, 
+    0x24FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x250000u /* 64KB Block43 */, 
+    0x25FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x260000u /* 64KB Block44 */, 
+    0x26FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x270000u /* 64KB Block45 */, 
+    0x27FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x280000u /* 64KB Block46 */, 
+    0x28FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x290000u /* 64KB Block47 */, 
+    0x29FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x2A0000u /* 64KB Block48 */, 
+    0x2AFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x2B0000u /* 64KB Block49 */, 
+    0x2BFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x2C0000u /* 64KB Block50 */, 
+    0x2CFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x2D0000u /* 64KB Block51 */, 
+    0x2DFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x2E0000u /* 64KB Block52 */, 
+    0x2EFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x2F0000u /* 64KB Block53 */, 
+    0x2FFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x300000u /* 64KB Block54 */, 
+    0x30FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x310000u /* 64KB Block55 */, 
+    0x31FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x320000u /* 64KB Block56 */, 
+    0x32FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x330000u /* 64KB Block57 */, 
+    0x33FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x340000u /* 64KB Block58 */, 
+    0x34FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x350000u /* 64KB Block59 */, 
+    0x35FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x360000u /* 64KB Block60 */, 
+    0x36FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x370000u /* 64KB Block61 */, 
+    0x37FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x380000u /* 64KB Block62 */, 
+    0x38FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x390000u /* 64KB Block63 */, 
+    0x39FFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x3A0000u /* 64KB Block64 */, 
+    0x3AFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x3B0000u /* 64KB Block65 */, 
+    0x3BFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x3C0000u /* 64KB Block66 */, 
+    0x3CFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x3D0000u /* 64KB Block67 */, 
+    0x3DFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x3E0000u /* 64KB Block68 */, 
+    0x3EFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x3F0000u /* 64KB Block69 */, 
+    0x3FFFFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0x01000000u /* Extended User Area (32KB) */, 
+    0x01007FFFu, 
+    kMioDeviceFlash
+  }, 
+  
+  {
+    0xFEDE3020u, 
+    0xFEDE30FFu, 
+    kMioDeviceEeprom
+  }
+};
+V_MEMROM0 V_MEMROM1_FAR vuint8 V_MEMROM2_FAR kNrOfFlashBlock = sizeof(FlashBlock) / sizeof(FlashBlock[0]);
+
+V_MEMROM0 V_MEMROM1_FAR tMemDrv V_MEMROM2_FAR memDrvLst[2] = 
+{
+  
+  {
+    FlashDriver_InitSync, 
+    FlashDriver_DeinitSync, 
+    FlashDriver_REraseSync, 
+    FlashDriver_RWriteSync, 
+    FlashDriver_RReadSync, 
+    FLASH_SEGMENT_SIZE
+  }, 
+  
+  {
+    EepromDriver_InitSync, 
+    EepromDriver_DeinitSync, 
+    EepromDriver_REraseSync, 
+    EepromDriver_RWriteSync, 
+    EepromDriver_RReadSync, 
+    1
+  }
+};
+V_MEMROM0 V_MEMROM1_FAR vuint8 V_MEMROM2_FAR kNrOfMemDrv = sizeof(memDrvLst) / sizeof(memDrvLst[0]);
+#define FBL_FBT_STOP_SEC_CONST
+#include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+
+/* Try to check consistency between memory device driver */
+/* header files (e.g. flashdrv.h) and GENy configuration */
+#ifdef FLASH_SEGMENT_SIZE
+#if (FLASH_SEGMENT_SIZE != 256)
+# error "Consistency check failed! Adjust GENy configuration!"
+#endif
+
+#endif
+
+#ifdef FBL_FLASH_DELETED
+#if (FBL_FLASH_DELETED != 0xFFu)
+# error "Consistency check failed! Adjust GENy configuration!"
+#endif
+
+#endif
+
+#ifdef EEPROM_SEGMENT_SIZE
+#if (EEPROM_SEGMENT_SIZE != 1)
+# error "Consistency check failed! Adjust GENy configuration!"
+#endif
+
+#endif
+
+#ifdef FBL_EEPROM_DELETED
+#if (FBL_EEPROM_DELETED != 0xFFu)
+# error "Consistency check failed! Adjust GENy configuration!"
+#endif
+
+#endif
+
+
+
+/* begin Fileversion check */
+#ifndef SKIP_MAGIC_NUMBER
+#ifdef MAGIC_NUMBER
+  #if MAGIC_NUMBER != 281688174
+      #error "The magic number of the generated file <D:\usr\usage\Delivery\CBD17x\CBD1701035\D00\external\Demo\DemoFbl\Appl\GenData\fbl_apfb.c> is different. Please check time and date of generated files!"
+  #endif
+#else
+  #error "The magic number is not defined in the generated file <D:\usr\usage\Delivery\CBD17x\CBD1701035\D00\external\Demo\DemoFbl\Appl\GenData\fbl_apfb.c> "
+
+#endif  /* MAGIC_NUMBER */
+#endif  /* SKIP_MAGIC_NUMBER */
+
+/* end Fileversion check */
+
@@ -0,0 +1,66 @@
+/* -----------------------------------------------------------------------------
+  Filename:    fbl_apfb.h
+  Description: Host build flash block table of the demo bootloader
+
+               Derived from Demo/DemoFbl/Appl/GenData/fbl_apfb.h (P1M, GreenHills).
+ ----------------------------------------------------------------------------- */
+/* -----------------------------------------------------------------------------
+  C O P Y R I G H T
+ -------------------------------------------------------------------------------
+  Copyright (c) 2001-2015 by Vector Informatik GmbH. All rights reserved.
+ 
+  This software is copyright protected and proprietary to Vector Informatik 
+  GmbH.
+  
+  Vector Informatik GmbH grants to you only those rights as set out in the 
+  license conditions.
+  
+  All other rights remain with Vector Informatik GmbH.
+ -------------------------------------------------------------------------------
+ ----------------------------------------------------------------------------- */
+
+#if !defined(__FBL_APFB_H__)
+#define __FBL_APFB_H__
+
+/* -----------------------------------------------------------------------------
+    &&&~ 
+ ----------------------------------------------------------------------------- */
+
+/* Defines ******************************************************************* */
+#define kMioDeviceFlash                      0
+#define kMioDeviceEeprom                     1
+
+/* Typedefs ****************************************************************** */
+typedef struct tFlashBlockTag
+{
+  tFblAddress begin;
+  tFblAddress end;
+  vuint8 device;
+} tFlashBlock;
+
+/* Global data *************************************************************** */
+#define FBL_FBT_START_SEC_CONST
+#include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+V_MEMROM0 extern  V_MEMROM1_FAR tFlashBlock V_MEMROM2_FAR FlashBlock[67];
+V_MEMROM0 extern  V_MEMROM1_FAR vuint8 V_MEMROM2_FAR kNrOfFlashBlock;
+
+V_MEMROM0 extern  V_MEMROM1_FAR tMemDrv V_MEMROM2_FAR memDrvLst[2];
+V_MEMROM0 extern  V_MEMROM1_FAR vuint8 V_MEMROM2_FAR kNrOfMemDrv;
+#define FBL_FBT_STOP_SEC_CONST
+#include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+
+
+/* begin Fileversion check */
+#ifndef SKIP_MAGIC_NUMBER
+#ifdef MAGIC_NUMBER
+  #if MAGIC_NUMBER != 281688174
+      #error "The magic number of the generated file <D:\usr\usage\Delivery\CBD17x\CBD1701035\D00\external\Demo\DemoFbl\Appl\GenData\fbl_apfb.h> is different. Please check time and date of generated files!"
+  #endif
+#else
+  #define MAGIC_NUMBER 281688174
+#endif  /* MAGIC_NUMBER */
+#endif  /* SKIP_MAGIC_NUMBER */
+
+/* end Fileversion check */
+
+#endif /* __FBL_APFB_H__ */
@@ -0,0 +1,122 @@
+/* -----------------------------------------------------------------------------
+  Filename:    fbl_mtab.c
+  Description: Host build logical block table of the demo bootloader
+
+               Derived from Demo/DemoFbl/Appl/GenData/fbl_mtab.c (P1M, GreenHills).
+               Block 'DemoAppl' covers the 4 MB code flash up to the calibration
+               blocks, only this block is mandatory.
+ ----------------------------------------------------------------------------- */
+/* -----------------------------------------------------------------------------
+  C O P Y R I G H T
+ -------------------------------------------------------------------------------
+  Copyright (c) 2001-2015 by Vector Informatik GmbH. All rights reserved.
+ 
+  This software is copyright protected and proprietary to Vector Informatik 
+  GmbH.
+  
+  Vector Informatik GmbH grants to you only those rights as set out in the 
+  license conditions.
+  
+  All other rights remain with Vector Informatik GmbH.
+ -------------------------------------------------------------------------------
+ ----------------------------------------------------------------------------- */
+
+/* -----------------------------------------------------------------------------
+    &&&~ 
+ ----------------------------------------------------------------------------- */
+
+#define FBL_LBT_SOURCE
+
+/* Includes ****************************************************************** */
+#include "fbl_inc.h"
+
+/* Global data *************************************************************** */
+#define FBL_LBT_START_SEC_CONST
+#include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+V_MEMROM0 V_MEMROM1 tLogicalBlockTable V_MEMROM2 FblLogicalBlockTable = 
+{
+  FBL_MTAB_MAGIC_FLAG, 
+  
+  {
+    0x1
+  } /* Disposability bit field (mandatory/optional) */, 
+  FBL_MTAB_NO_OF_BLOCKS, 
+  
+  {
+    
+    {
+      0, 
+      0x018000u /* Block Start Address */, 
+      0x3A8000u /* Block Length (End Address = 0x3BFFFF) */, 
+      0x00 /* Max Prog Attempts */, 
+      (tExportFct)SecM_Verification /* Output Verification */
+    } /* Name 'DemoAppl', Mandatory */, 
+    
+    {
+      1, 
+      0x3C0000u /* Block Start Address */, 
+      0x020000u /* Block Length (End Address = 0x3DFFFF) */, 
+      0x00 /* Max Prog Attempts */, 
+      (tExportFct)SecM_Verification /* Output Verification */
+    } /* Name 'Cal1', Optional */, 
+    
+    {
+      2, 
+      0x3E0000u /* Block Start Address */, 
+      0x020000u /* Block Length (End Address = 0x3FFFFF) */, 
+      0x00 /* Max Prog Attempts */, 
+      (tExportFct)SecM_Verification /* Output Verification */
+    } /* Name 'Cal2', Optional */, 
+    
+    {
+      3, 
+      0xFEDE3020u /* Block Start Address */, 
+      0xE0u /* Block Length (End Address = 0xFEDE30FF) */, 
+      0x00 /* Max Prog Attempts */, 
+      (tExportFct)SecM_Verification /* Output Verification */
+    } /* Name 'Cal3', Optional */
+  }
+};
+#if defined( FBL_ENABLE_AB_BANK_MODE )
+V_MEMROM0 V_MEMROM1 tBlockBankDescriptor V_MEMROM2 FblLogicalBlockBankTable[FBL_MTAB_NO_OF_BLOCKS] = 
+{
+  
+  {
+    FBL_MTAB_DEMOAPPL_BLOCK_NUMBER /* Alternate Bank */, 
+    0x018000u /* Application Vector Table */
+  } /* Name 'DemoAppl' */, 
+  
+  {
+    FBL_MTAB_CAL1_BLOCK_NUMBER /* Alternate Bank */, 
+    FBL_MTAB_NO_APPLVECT /* Application Vector Table */
+  } /* Name 'Cal1' */, 
+  
+  {
+    FBL_MTAB_CAL2_BLOCK_NUMBER /* Alternate Bank */, 
+    FBL_MTAB_NO_APPLVECT /* Application Vector Table */
+  } /* Name 'Cal2' */, 
+  
+  {
+    FBL_MTAB_CAL3_BLOCK_NUMBER /* Alternate Bank */, 
+    FBL_MTAB_NO_APPLVECT /* Application Vector Table */
+  } /* Name 'Cal3' */
+};
+#endif /* FBL_ENABLE_AB_BANK_MODE */
+#define FBL_LBT_STOP_SEC_CONST
+#include "MemMap.h" /* PRQA S 5087 */ /* MD_MSR_19.1 */
+
+
+/* begin Fileversion check */
+#ifndef SKIP_MAGIC_NUMBER
+#ifdef MAGIC_NUMBER
+  #if MAGIC_NUMBER != 281688174
+      #error "The magic number of the generated file <D:\usr\usage\Delivery\CBD17x\CBD1701035\D00\external\Demo\DemoFbl\Appl\GenData\fbl_mtab.c> is different. Please check time and date of generated files!"
+  #endif
+#else
+  #error "The magic number is not defined in the generated file <D:\usr\usage\Delivery\CBD17x\CBD1701035\D00\external\Demo\DemoFbl\Appl\GenData\fbl_mtab.c> "
+
+#endif  /* MAGIC_NUMBER */
+#endif  /* SKIP_MAGIC_NUMBER */
+
+/* end Fileversion check */
+
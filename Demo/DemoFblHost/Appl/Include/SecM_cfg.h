@@ -0,0 +1,6 @@
+/* Configuration adapter for the host build: CRC implementation selectable by the Makefile (CRC_OPT) */
+#include "../../../DemoFbl/Appl/GenData/SecM_cfg.h"
+#if defined( FBL_HOST_SEC_CRC_OPT )
+# undef SEC_CRC_OPT
+# define SEC_CRC_OPT                          FBL_HOST_SEC_CRC_OPT
+#endif /* FBL_HOST_SEC_CRC_OPT */
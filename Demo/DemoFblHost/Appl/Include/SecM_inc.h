@@ -0,0 +1,2 @@
+/* Case adapter for the host build: SecMPar.c/.h include SecM_inc.h, the module header is SecM_Inc.h */
+#include "SecM_Inc.h"
@@ -0,0 +1,2 @@
+/* Case adapter for the host build: WrapNv.h includes WrapNv_Cfg.h, the generated file is WrapNv_cfg.h */
+#include "WrapNv_cfg.h"
@@ -0,0 +1,110 @@
+/***********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/** \file
+ *  \brief         Host build of the demo bootloader: virtual time, CAN bus and flash memory model
+ *  \details       The bootloader is executed on a PC (Linux, gcc) against models of the hardware used by fbl_hw.c and
+ *                 the Renesas flash library. All timing is based on a virtual clock, which is advanced by polling of
+ *                 the CAN controller and the flash library, by the CAN bus and by flash operations. Results therefore
+ *                 do not depend on the speed of the host.
+ */
+/**********************************************************************************************************************/
+
+#ifndef __FBL_HOST_H__
+#define __FBL_HOST_H__
+
+/***********************************************************************************************************************
+ *  DEFINES
+ **********************************************************************************************************************/
+
+/* Default model parameters, may be overwritten on the command line of the benchmark */
+#if !defined( FBL_HOST_CAN_BITRATE )
+/** CAN bit rate [bit/s] */
+# define FBL_HOST_CAN_BITRATE          500000ul
+#endif
+#if !defined( FBL_HOST_POLL_TIME_NS )
+/** CPU time consumed by one poll of the CAN controller or the flash library [ns] */
+# define FBL_HOST_POLL_TIME_NS         1000ul
+#endif
+#if !defined( FBL_HOST_FLASH_ERASE_TIME_US )
+/** Erase time of one 32 KB code flash block [us] */
+# define FBL_HOST_FLASH_ERASE_TIME_US  200000ul
+#endif
+#if !defined( FBL_HOST_FLASH_WRITE_TIME_US )
+/** Programming time of one 256 byte code flash unit [us] */
+# define FBL_HOST_FLASH_WRITE_TIME_US  300ul
+#endif
+
+/** Simulated code flash: 4 MB starting at address 0, the first 64 KB are occupied by the bootloader */
+#define FBL_HOST_CODE_FLASH_START      0x00010000ul
+#define FBL_HOST_CODE_FLASH_END        0x003FFFFFul
+/** Extended user area (user boot area of the flash library) */
+#define FBL_HOST_USER_AREA_START       0x01000000ul
+#define FBL_HOST_USER_AREA_END         0x01007FFFul
+/** Peripheral registers: read and written as plain memory */
+#define FBL_HOST_SFR_START             0xFF000000ul
+#define FBL_HOST_SFR_SIZE              0x01000000ul
+
+/** Number of CAN frames buffered in the receive FIFO (FIFO depth configured by fbl_hw.c) */
+#define FBL_HOST_CAN_RX_FIFO_SIZE      64u
+/** Number of CAN frames the tester may queue for transmission */
+#define FBL_HOST_CAN_TESTER_QUEUE_SIZE 16u
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+/** Virtual time [ns] */
+typedef unsigned long long tFblHostTime;
+
+/** Model parameters */
+typedef struct
+{
+   unsigned long canBitrate;           /**< CAN bit rate [bit/s] */
+   unsigned long pollTimeNs;           /**< CPU time of one poll [ns] */
+   unsigned long flashEraseTimeUs;     /**< Erase time per 32 KB block [us] */
+   unsigned long flashWriteTimeUs;     /**< Programming time per 256 byte unit [us] */
+} tFblHostParam;
+
+/** Statistics collected by the models */
+typedef struct
+{
+   unsigned long canFramesEcu;         /**< CAN frames sent by the ECU */
+   unsigned long canFramesTester;      /**< CAN frames sent by the tester */
+   unsigned long canRxOverruns;        /**< Frames lost because the receive FIFO was full */
+   unsigned long canPolls;             /**< Polls of the CAN controller */
+   unsigned long flashEraseBlocks;     /**< Erased 32 KB blocks */
+   unsigned long flashWriteUnits;      /**< Programmed 256 byte units */
+   unsigned long flashPolls;           /**< Calls of the flash library handler */
+   tFblHostTime  flashBusyTime;        /**< Time the flash library was busy with erase/write */
+} tFblHostStatistics;
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA
+ **********************************************************************************************************************/
+
+extern tFblHostParam      fblHostParam;
+extern tFblHostStatistics fblHostStatistics;
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+
+/* Memory and register model (fbl_hw_host.c) */
+void FblHostInitMemory( void );
+tFblHostTime FblHostGetTime( void );
+void FblHostAdvanceTime( tFblHostTime duration );
+
+/* CAN bus model (fbl_hw_host.c), frames sent on behalf of the tester */
+vuint8 FblHostCanTesterTransmit( vuint32 id, const vuint8 * data, vuint8 dlc, tFblHostTime readyTime );
+
+/* Tester (fbl_bench.c), called by the CAN bus model */
+void FblBenchCanIndication( vuint32 id, const vuint8 * data, vuint8 dlc );
+void FblBenchCanConfirmation( vuint32 id );
+void FblBenchCheckTimeout( void );
+
+#endif /* __FBL_HOST_H__ */
+
+/***********************************************************************************************************************
+ *  END OF FILE: FBL_HOST.H
+ **********************************************************************************************************************/
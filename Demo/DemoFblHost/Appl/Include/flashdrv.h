@@ -0,0 +1,54 @@
+/***********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/** \file
+ *  \brief         Flash driver interface adaption for the host build
+ *  \details       Includes BSW/Flash/flashdrv.h and redefines the function call macros. The call table of the
+ *                 downloaded flash driver holds 32 bit addresses, while tFlashUint32 is 64 bit wide on the host.
+ */
+/**********************************************************************************************************************/
+
+#ifndef __FLASHDRV_HOST_H__
+#define __FLASHDRV_HOST_H__
+
+#include_next "flashdrv.h"
+
+/***********************************************************************************************************************
+ *  DEFINES
+ **********************************************************************************************************************/
+
+/** Entry of the flash driver call table (32 bit address, independent of host word size) */
+#define FLASH_DRIVER_HOST_FCT(flashCode, offset)   ((tFlashFct)(unsigned long)(*(unsigned int *)&(flashCode)[(offset)]))
+
+#undef FLASH_DRIVER_WRITE
+#undef FLASH_DRIVER_ERASE
+#undef FLASH_DRIVER_INIT
+#undef FLASH_DRIVER_DEINIT
+#define FLASH_DRIVER_WRITE(flashCode, flashParam)   FLASH_DRIVER_HOST_FCT((flashCode), FLASH_DRIVER_WRITE_OFFSET)(flashParam)
+#define FLASH_DRIVER_ERASE(flashCode, flashParam)   FLASH_DRIVER_HOST_FCT((flashCode), FLASH_DRIVER_ERASE_OFFSET)(flashParam)
+#define FLASH_DRIVER_INIT(flashCode, flashParam)    FLASH_DRIVER_HOST_FCT((flashCode), FLASH_DRIVER_INIT_OFFSET)(flashParam)
+#define FLASH_DRIVER_DEINIT(flashCode, flashParam)  FLASH_DRIVER_HOST_FCT((flashCode), FLASH_DRIVER_DEINIT_OFFSET)(flashParam)
+
+#if defined( FLASH_ENABLE_SET_RESETVECTOR_API )
+# undef FLASH_DRIVER_SET_RESET_VECTOR
+# define FLASH_DRIVER_SET_RESET_VECTOR(flashCode, flashParam) \
+   FLASH_DRIVER_HOST_FCT((flashCode), FLASH_DRIVER_SETRESVEC_OFFSET)(flashParam)
+#endif /* FLASH_ENABLE_SET_RESETVECTOR_API */
+
+#if defined( FLASH_ENABLE_ASYNC_API )
+# undef FLASH_DRIVER_ERASE_START
+# undef FLASH_DRIVER_WRITE_START
+# undef FLASH_DRIVER_POLL
+# define FLASH_DRIVER_ERASE_START(flashCode, flashParam) \
+   FLASH_DRIVER_HOST_FCT((flashCode), FLASH_DRIVER_ERASE_START_OFFSET)(flashParam)
+# define FLASH_DRIVER_WRITE_START(flashCode, flashParam) \
+   FLASH_DRIVER_HOST_FCT((flashCode), FLASH_DRIVER_WRITE_START_OFFSET)(flashParam)
+# define FLASH_DRIVER_POLL(flashCode, flashParam) \
+   FLASH_DRIVER_HOST_FCT((flashCode), FLASH_DRIVER_POLL_OFFSET)(flashParam)
+#endif /* FLASH_ENABLE_ASYNC_API */
+
+#endif /* __FLASHDRV_HOST_H__ */
+
+/***********************************************************************************************************************
+ *  END OF FILE: FLASHDRV.H
+ **********************************************************************************************************************/
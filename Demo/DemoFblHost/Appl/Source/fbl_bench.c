@@ -0,0 +1,1375 @@
+/***********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/** \file
+ *  \brief         Host build of the demo bootloader: download benchmark
+ *  \details       Runs the bootloader against a simulated tester, which performs a complete reprogramming sequence
+ *                 (flash driver download, erase, RequestDownload/TransferData/RequestTransferExit of a generated
+ *                 image, checksum and programming dependency check, ECU reset) via ISO 15765-2 on the CAN bus model.
+ *                 At the end the throughput, the duration of each phase, the number of FblMemTask iterations and the
+ *                 statistics of the models are reported. The programmed memory is compared against the image.
+ */
+/**********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  INCLUDES
+ **********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+
+#include "fbl_inc.h"
+#include "flashdrv.h"
+#include "fbl_host.h"
+
+/***********************************************************************************************************************
+ *  DEFINES
+ **********************************************************************************************************************/
+
+/** CAN identifiers of the diagnostic connection */
+#define BENCH_CAN_ID_REQUEST           0x5A0u
+#define BENCH_CAN_ID_RESPONSE          0x5B0u
+
+/** Maximum length of a diagnostic message (ISO 15765-2, 12 bit length) */
+#define BENCH_MAX_MESSAGE_LENGTH       4095u
+
+/** Time of the first request after power on [ns] */
+#define BENCH_START_TIME               (20ull * 1000000ull)
+/** Timeout for the first frame of the response after a request [ns] (P2server) */
+#define BENCH_P2_TIMEOUT               (50ull * 1000000ull)
+/** Response timeout after a response pending message or a first frame [ns] (P2*server + margin) */
+#define BENCH_RESPONSE_TIMEOUT         (5500ull * 1000000ull)
+/** Timeout for a flow control frame of the bootloader [ns] (N_Bs) */
+#define BENCH_FLOW_CONTROL_TIMEOUT     (1000ull * 1000000ull)
+/** Retry interval if the bootloader requires a delay before security access [ns] */
+#define BENCH_RETRY_DELAY              (500ull * 1000000ull)
+
+/** Stack of the bootloader, mapped below 4 GB: addresses of local buffers are passed as tFblAddress */
+#define BENCH_STACK_SIZE               0x100000ul
+
+/** Processed data of the CRC throughput measurement */
+#define BENCH_CRC_DATA_SIZE            0x100000ul
+#define BENCH_CRC_REPETITIONS          64u
+/** Data passed per SecM_ComputeCRC call, limited by SecM_LengthType */
+#define BENCH_CRC_SEGMENTATION         0x8000u
+
+/** Default size of the downloaded image */
+#define BENCH_DEFAULT_IMAGE_SIZE       0x300000ul
+
+/** Negative response codes evaluated by the tester */
+#define BENCH_NRC_RESPONSE_PENDING     0x78u
+#define BENCH_NRC_TIME_DELAY           0x37u
+
+/** Constant used by the example seed/key algorithm (Sec_SeedKeyVendor.c) */
+#define BENCH_SEC_KEY_CONSTANT         0xFFFFFFFFul
+
+/** Reprogramming sequence */
+#define BENCH_STEP_EXTENDED_SESSION    0u
+#define BENCH_STEP_PRECONDITIONS       1u
+#define BENCH_STEP_PROGRAMMING_SESSION 2u
+#define BENCH_STEP_REQUEST_SEED        3u
+#define BENCH_STEP_SEND_KEY            4u
+#define BENCH_STEP_FINGERPRINT         5u
+#define BENCH_STEP_DRIVER_DOWNLOAD     6u
+#define BENCH_STEP_DRIVER_TRANSFER     7u
+#define BENCH_STEP_DRIVER_EXIT         8u
+#define BENCH_STEP_DRIVER_CHECKSUM     9u
+#define BENCH_STEP_ERASE               10u
+#define BENCH_STEP_DOWNLOAD            11u
+#define BENCH_STEP_TRANSFER            12u
+#define BENCH_STEP_EXIT                13u
+#define BENCH_STEP_CHECKSUM            14u
+#define BENCH_STEP_DEPENDENCIES        15u
+#define BENCH_STEP_RESET               16u
+#define BENCH_STEP_DONE                17u
+
+/** Phases of the sequence reported by the benchmark */
+#define BENCH_PHASE_SETUP              0u
+#define BENCH_PHASE_DRIVER             1u
+#define BENCH_PHASE_ERASE              2u
+#define BENCH_PHASE_TRANSFER           3u
+#define BENCH_PHASE_CHECKSUM           4u
+#define BENCH_PHASE_FINISH             5u
+#define BENCH_PHASE_COUNT              6u
+
+/** ISO 15765-2 transmit states */
+#define BENCH_TX_IDLE                  0u
+#define BENCH_TX_FRAME                 1u
+#define BENCH_TX_WAIT_FC               2u
+
+/***********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+/** Downloaded memory area */
+typedef struct
+{
+   unsigned long address;
+   unsigned long length;
+   const vuint8 * data;
+   const vuint8 * transferData;     /**< Data sent by TransferData, differs from data for a delta patch stream */
+   unsigned long transferLength;
+   vuint8 dataFormat;               /**< Data format identifier of RequestDownload */
+} tBenchDownload;
+
+/***********************************************************************************************************************
+ *  LOCAL DATA
+ **********************************************************************************************************************/
+
+static const char * const benchPhaseName[BENCH_PHASE_COUNT] =
+{
+   "setup (session, security, fingerprint)",
+   "flash driver download",
+   "erase",
+   "download (34/36/37)",
+   "checksum",
+   "dependencies, reset"
+};
+
+/** Phase of each step of the sequence */
+static const vuint8 benchStepPhase[BENCH_STEP_DONE + 1u] =
+{
+   BENCH_PHASE_SETUP, BENCH_PHASE_SETUP, BENCH_PHASE_SETUP, BENCH_PHASE_SETUP, BENCH_PHASE_SETUP, BENCH_PHASE_SETUP,
+   BENCH_PHASE_DRIVER, BENCH_PHASE_DRIVER, BENCH_PHASE_DRIVER, BENCH_PHASE_DRIVER,
+   BENCH_PHASE_ERASE,
+   BENCH_PHASE_TRANSFER, BENCH_PHASE_TRANSFER, BENCH_PHASE_TRANSFER,
+   BENCH_PHASE_CHECKSUM,
+   BENCH_PHASE_FINISH, BENCH_PHASE_FINISH, BENCH_PHASE_FINISH
+};
+
+/** Downloaded flash driver and application image */
+static vuint8 benchDriverImage[FLASH_SIZE];
+static tBenchDownload benchDriver;
+static tBenchDownload benchImage;
+/** Currently downloaded area */
+static const tBenchDownload * benchActive;
+static unsigned long benchOffset;
+static unsigned long benchBlockLength;
+static vuint8 benchSequenceCounter;
+
+/** Sequence state */
+static vuintx benchStep;
+static vuint32 benchSeed;
+static tFblHostTime benchPhaseStart[BENCH_PHASE_COUNT];
+static tFblHostTime benchPhaseTime[BENCH_PHASE_COUNT];
+static tFblHostTime benchDeadline;
+
+/** ISO 15765-2 transmitter */
+static vuint8 benchTxBuffer[BENCH_MAX_MESSAGE_LENGTH];
+static vuintx benchTxLength;
+static vuintx benchTxPos;
+static vuint8 benchTxSn;
+static vuint8 benchTxState;
+static vuint8 benchTxBlockSize;
+static vuint8 benchTxBlockCount;
+static tFblHostTime benchTxStmin;
+static vuint8 benchTxRequestPending;
+
+/** ISO 15765-2 receiver */
+static vuint8 benchRxBuffer[BENCH_MAX_MESSAGE_LENGTH];
+static vuintx benchRxLength;
+static vuintx benchRxPos;
+static vuint8 benchRxSn;
+static vuint8 benchWaitResponse;
+static vuint8 benchWaitFirstFrame;
+static tFblHostTime benchRequestEnd;
+
+/** Statistics of the tester */
+static unsigned long benchRequests;
+static unsigned long benchResponsePending;
+static unsigned long benchTransferBlocks;
+static unsigned long benchMemTaskCalls;
+static unsigned long benchMemTaskCallsTransfer;
+static tFblHostTime benchP2Max;
+static unsigned long benchCrcWatchdogCalls;
+
+/** Host time at start of the run */
+static struct timespec benchWallStart;
+
+/** Execution context of the bootloader */
+static ucontext_t benchMainContext;
+static ucontext_t benchFblContext;
+
+/***********************************************************************************************************************
+ *  PROTOTYPES
+ **********************************************************************************************************************/
+
+void __real_FblMemTask( void );
+void __wrap_FblMemTask( void );
+void __wrap_ApplFblReset( void );
+void __wrap_ApplFblFatalError( FBL_DECL_ASSERT_EXTENDED_INFO(vuint8 errorCode) );
+int FblMain( void );
+
+/* Functions of the flash driver (flashdrv.c), entered into the call table of the downloaded driver */
+void ExpFlashInit( tFlashParam * flashParam );
+void ExpFlashDeinit( tFlashParam * flashParam );
+void ExpFlashErase( tFlashParam * flashParam );
+void ExpFlashWrite( tFlashParam * flashParam );
+#if defined( FLASH_ENABLE_SET_RESETVECTOR_API )
+void ExpFlashSetResetVector( tFlashParam * flashParam );
+#endif /* FLASH_ENABLE_SET_RESETVECTOR_API */
+#if defined( FLASH_ENABLE_ASYNC_API )
+void ExpFlashEraseStart( tFlashParam * flashParam );
+void ExpFlashWriteStart( tFlashParam * flashParam );
+void ExpFlashPoll( tFlashParam * flashParam );
+#endif /* FLASH_ENABLE_ASYNC_API */
+#if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+/* Patch generator of expdatproc (expdat_delta.c) */
+unsigned long ExpDat_DeltaEncode( const unsigned char * refData, unsigned long refLength, unsigned long refAddress,
+                                  const unsigned char * newData, unsigned long newLength, unsigned char * patchData );
+#endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
+
+static void BenchFail( const char * reason, unsigned long info );
+static void BenchSendRequest( void );
+
+/***********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  BenchCrc32
+ **********************************************************************************************************************/
+/*! \brief       CRC-32 (IEEE 802.3) as used by the verification of the demo configuration
+ *  \param[in]   data Input data
+ *  \param[in]   length Length of data
+ *  \return      CRC value
+ **********************************************************************************************************************/
+static vuint32 BenchCrc32( const vuint8 * data, unsigned long length )
+{
+   vuint32 crc;
+   unsigned long i;
+   vuintx bit;
+
+   crc = 0xFFFFFFFFul;
+   for (i = 0u; i < length; i++)
+   {
+      crc ^= data[i];
+      for (bit = 0u; bit < 8u; bit++)
+      {
+         crc = ((crc & 0x01u) != 0u) ? ((crc >> 1u) ^ 0xEDB88320ul) : (crc >> 1u);
+      }
+   }
+
+   return (crc ^ 0xFFFFFFFFul) & 0xFFFFFFFFul;
+}
+
+/***********************************************************************************************************************
+ *  BenchSetInteger
+ **********************************************************************************************************************/
+/*! \brief       Store value in big endian format
+ **********************************************************************************************************************/
+static void BenchSetInteger( vuintx count, vuint32 value, vuint8 * buffer )
+{
+   while (count > 0u)
+   {
+      count--;
+      buffer[count] = (vuint8)(value & 0xFFu);
+      value >>= 8u;
+   }
+}
+
+/***********************************************************************************************************************
+ *  BenchGetInteger
+ **********************************************************************************************************************/
+/*! \brief       Read value in big endian format
+ **********************************************************************************************************************/
+static vuint32 BenchGetInteger( vuintx count, const vuint8 * buffer )
+{
+   vuint32 value;
+   vuintx i;
+
+   value = 0u;
+   for (i = 0u; i < count; i++)
+   {
+      value = (value << 8u) | buffer[i];
+   }
+
+   return value;
+}
+
+/***********************************************************************************************************************
+ *  BenchElapsedWallTime
+ **********************************************************************************************************************/
+/*! \brief       Host time since start of the run [s]
+ **********************************************************************************************************************/
+static double BenchElapsedWallTime( void )
+{
+   struct timespec now;
+
+   (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+   return (double)(now.tv_sec - benchWallStart.tv_sec) + ((double)(now.tv_nsec - benchWallStart.tv_nsec) / 1e9);
+}
+
+/***********************************************************************************************************************
+ *  BenchMs
+ **********************************************************************************************************************/
+/*! \brief       Convert virtual time to milliseconds
+ **********************************************************************************************************************/
+static double BenchMs( tFblHostTime time )
+{
+   return (double)time / 1e6;
+}
+
+#if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+/***********************************************************************************************************************
+ *  BenchReportRuntime
+ **********************************************************************************************************************/
+/*! \brief       Print the runtime statistic of the bootloader tasks as reported by FblMainRuntimeDump
+ **********************************************************************************************************************/
+static void BenchReportRuntime( void )
+{
+   static const char * const taskName[kFblMainRuntimeNumberOfTasks] =
+   {
+      "main loop cycle", "FblDiagStateTask", "FblMemTask", "FblTpTask",
+      "SecM verification", "flash write", "flash erase", "flash poll"
+   };
+   vuint8 dump[kFblMainRuntimeDumpSize];
+   const vuint8 * record;
+   vuintx task;
+   vuintx histClass;
+
+   if (FblMainRuntimeDump(dump, sizeof(dump)) != kFblMainRuntimeDumpSize)
+   {
+      BenchFail("runtime dump", 0u);
+   }
+
+   printf("\nRuntime (virtual time) [us]  count       min       max      mean   histogram <4/16/64/256/1k/4k/16k/more\n");
+   for (task = 0u; task < kFblMainRuntimeNumberOfTasks; task++)
+   {
+      record = &dump[task * kFblMainRuntimeRecordSize];
+      printf("  %-20s %12lu %9lu %9lu %9lu  ", taskName[task],
+             (unsigned long)BenchGetInteger(4u, &record[0]), (unsigned long)BenchGetInteger(4u, &record[4]),
+             (unsigned long)BenchGetInteger(4u, &record[8]), (unsigned long)BenchGetInteger(4u, &record[12]));
+      for (histClass = 0u; histClass < kFblMainRuntimeNumberOfClasses; histClass++)
+      {
+         printf(" %lu", (unsigned long)BenchGetInteger(2u, &record[16u + (2u * histClass)]));
+      }
+      printf("\n");
+   }
+}
+#endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
+
+/***********************************************************************************************************************
+ *  BenchReport
+ **********************************************************************************************************************/
+/*! \brief       Print results of the run
+ *  \return      0 if the programmed memory matches the image, 1 otherwise
+ **********************************************************************************************************************/
+static int BenchReport( void )
+{
+   tFblHostTime total;
+   tFblHostTime transfer;
+   vuintx i;
+   int result;
+
+   total = FblHostGetTime() - benchPhaseStart[BENCH_PHASE_SETUP];
+   transfer = benchPhaseTime[BENCH_PHASE_TRANSFER];
+
+   result = (memcmp((const void *)benchImage.address, benchImage.data, benchImage.length) == 0) ? 0 : 1;
+
+   printf("\nConfiguration\n");
+   printf("  pipelined programming   %s\n",
+#if defined( FBL_ENABLE_PIPELINED_PROGRAMMING )
+          "on"
+#else
+          "off"
+#endif
+         );
+   printf("  TransferData fast path  %s\n",
+#if defined( FBL_DIAG_ENABLE_TRANSFERDATA_FASTPATH )
+          "on"
+#else
+          "off"
+#endif
+         );
+   printf("  asynchronous flash API  %s\n",
+#if defined( FLASH_ENABLE_ASYNC_API )
+          "on"
+#else
+          "off"
+#endif
+         );
+   printf("  image                   %lu bytes at 0x%08lX\n", benchImage.length, benchImage.address);
+#if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+   printf("  delta patch stream      %lu bytes\n", benchImage.transferLength);
+#endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
+   printf("  CAN bit rate            %lu bit/s\n", fblHostParam.canBitrate);
+   printf("  flash erase / write     %lu us per 32 KB / %lu us per 256 bytes\n",
+          fblHostParam.flashEraseTimeUs, fblHostParam.flashWriteTimeUs);
+   printf("  poll time               %lu ns\n", fblHostParam.pollTimeNs);
+
+   printf("\nPhases (virtual time)\n");
+   for (i = 0u; i < BENCH_PHASE_COUNT; i++)
+   {
+      printf("  %-40s %12.3f ms\n", benchPhaseName[i], BenchMs(benchPhaseTime[i]));
+   }
+   printf("  %-40s %12.3f ms\n", "total", BenchMs(total));
+
+   printf("\nThroughput\n");
+   printf("  download (34/36/37)     %12.0f bytes/s\n", ((double)benchImage.length * 1e9) / (double)transfer);
+   printf("  total sequence          %12.0f bytes/s\n", ((double)benchImage.length * 1e9) / (double)total);
+
+   printf("\nCounters\n");
+   printf("  requests                %12lu\n", benchRequests);
+   printf("  TransferData blocks     %12lu (%lu bytes each)\n", benchTransferBlocks, benchBlockLength);
+   printf("  response pending (78)   %12lu\n", benchResponsePending);
+   printf("  max. P2 response time   %12.3f ms\n", BenchMs(benchP2Max));
+   printf("  FblMemTask calls        %12lu (%lu during download)\n", benchMemTaskCalls, benchMemTaskCallsTransfer);
+   printf("  CAN frames tester / ECU %12lu / %lu\n", fblHostStatistics.canFramesTester, fblHostStatistics.canFramesEcu);
+   printf("  CAN receive overruns    %12lu\n", fblHostStatistics.canRxOverruns);
+   printf("  CAN polls               %12lu\n", fblHostStatistics.canPolls);
+   printf("  flash erase blocks      %12lu\n", fblHostStatistics.flashEraseBlocks);
+   printf("  flash write units       %12lu\n", fblHostStatistics.flashWriteUnits);
+   printf("  flash library polls     %12lu\n", fblHostStatistics.flashPolls);
+   printf("  flash busy time         %12.3f ms\n", BenchMs(fblHostStatistics.flashBusyTime));
+
+#if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+   BenchReportRuntime();
+#endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
+
+   printf("\nHost run time             %12.3f s\n", BenchElapsedWallTime());
+   printf("Programmed memory         %s\n", (result == 0) ? "matches image" : "DIFFERS FROM IMAGE");
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  BenchFail
+ **********************************************************************************************************************/
+/*! \brief       Abort the run
+ **********************************************************************************************************************/
+static void BenchFail( const char * reason, unsigned long info )
+{
+   fprintf(stderr, "Bench: %s (0x%02lX) in step %lu at %.3f ms\n",
+           reason, info, (unsigned long)benchStep, BenchMs(FblHostGetTime()));
+   exit(1);
+}
+
+/***********************************************************************************************************************
+ *  BenchTransmitFrame
+ **********************************************************************************************************************/
+/*! \brief       Queue a frame of the tester, unused bytes are padded
+ **********************************************************************************************************************/
+static void BenchTransmitFrame( const vuint8 * data, vuintx length, tFblHostTime readyTime )
+{
+   vuint8 frame[8];
+
+   memset(frame, 0xAA, sizeof(frame));
+   memcpy(frame, data, length);
+
+   if (FblHostCanTesterTransmit(BENCH_CAN_ID_REQUEST, frame, 8u, readyTime) == 0u)
+   {
+      BenchFail("tester queue overflow", 0u);
+   }
+}
+
+/***********************************************************************************************************************
+ *  BenchTransmitConsecutiveFrame
+ **********************************************************************************************************************/
+/*! \brief       Queue the next consecutive frame of the current request
+ **********************************************************************************************************************/
+static void BenchTransmitConsecutiveFrame( tFblHostTime readyTime )
+{
+   vuint8 frame[8];
+   vuintx count;
+
+   count = benchTxLength - benchTxPos;
+   if (count > 7u)
+   {
+      count = 7u;
+   }
+
+   frame[0] = (vuint8)(0x20u | benchTxSn);
+   memcpy(&frame[1], &benchTxBuffer[benchTxPos], count);
+   benchTxPos += count;
+   benchTxSn = (vuint8)((benchTxSn + 1u) & 0x0Fu);
+   benchTxBlockCount++;
+   benchTxState = BENCH_TX_FRAME;
+
+   BenchTransmitFrame(frame, count + 1u, readyTime);
+}
+
+/***********************************************************************************************************************
+ *  BenchTransmitRequest
+ **********************************************************************************************************************/
+/*! \brief       Start transmission of the request in benchTxBuffer
+ **********************************************************************************************************************/
+static void BenchTransmitRequest( vuintx length, tFblHostTime readyTime )
+{
+   vuint8 frame[8];
+
+   benchTxLength = length;
+   benchRequests++;
+   benchWaitResponse = 0u;
+   benchWaitFirstFrame = 0u;
+
+   if (length <= 7u)
+   {
+      frame[0] = (vuint8)length;
+      memcpy(&frame[1], benchTxBuffer, length);
+      benchTxPos = length;
+   }
+   else
+   {
+      frame[0] = (vuint8)(0x10u | (length >> 8u));
+      frame[1] = (vuint8)(length & 0xFFu);
+      memcpy(&frame[2], benchTxBuffer, 6u);
+      benchTxPos = 6u;
+      benchTxSn = 1u;
+   }
+
+   benchTxState = BENCH_TX_FRAME;
+   BenchTransmitFrame(frame, (length <= 7u) ? (length + 1u) : 8u, readyTime);
+}
+
+/***********************************************************************************************************************
+ *  BenchEnterStep
+ **********************************************************************************************************************/
+/*! \brief       Continue with the given step and account the phase times
+ **********************************************************************************************************************/
+static void BenchEnterStep( vuintx step )
+{
+   vuint8 oldPhase;
+   vuint8 newPhase;
+
+   oldPhase = benchStepPhase[benchStep];
+   newPhase = benchStepPhase[step];
+
+   if (oldPhase != newPhase)
+   {
+      benchPhaseTime[oldPhase] += FblHostGetTime() - benchPhaseStart[oldPhase];
+      benchPhaseStart[newPhase] = FblHostGetTime();
+   }
+
+   benchStep = step;
+}
+
+/***********************************************************************************************************************
+ *  BenchBuildRequest
+ **********************************************************************************************************************/
+/*! \brief       Build the request of the current step
+ *  \return      Length of the request
+ **********************************************************************************************************************/
+static vuintx BenchBuildRequest( void )
+{
+   vuint8 * request;
+   vuintx length;
+   vuint32 key;
+   unsigned long count;
+
+   request = benchTxBuffer;
+   length = 0u;
+
+   switch (benchStep)
+   {
+      case BENCH_STEP_EXTENDED_SESSION:
+      {
+         request[length++] = 0x10u;
+         request[length++] = 0x03u;
+         break;
+      }
+      case BENCH_STEP_PRECONDITIONS:
+      {
+         request[length++] = 0x31u;
+         request[length++] = 0x01u;
+         request[length++] = 0x02u;
+         request[length++] = 0x03u;
+         break;
+      }
+      case BENCH_STEP_PROGRAMMING_SESSION:
+      {
+         request[length++] = 0x10u;
+         request[length++] = 0x02u;
+         break;
+      }
+      case BENCH_STEP_REQUEST_SEED:
+      {
+         request[length++] = 0x27u;
+         request[length++] = kFblDiagSubRequestSeed;
+         break;
+      }
+      case BENCH_STEP_SEND_KEY:
+      {
+         key = (benchSeed ^ BENCH_SEC_KEY_CONSTANT) & 0xFFFFFFFFul;
+         request[length++] = 0x27u;
+         request[length++] = kFblDiagSubSendKey;
+         BenchSetInteger(4u, key, &request[length]);
+         length += 4u;
+         break;
+      }
+      case BENCH_STEP_FINGERPRINT:
+      {
+         request[length++] = 0x2Eu;
+         request[length++] = 0xF1u;
+         request[length++] = 0x5Au;
+         /* Programming date (BCD, YY MM DD) and tester serial number */
+         request[length++] = 0x26u;
+         request[length++] = 0x10u;
+         request[length++] = 0x17u;
+         for (count = 0u; count < 6u; count++)
+         {
+            request[length++] = (vuint8)(0x01u + count);
+         }
+         break;
+      }
+      case BENCH_STEP_DRIVER_DOWNLOAD:
+      case BENCH_STEP_DOWNLOAD:
+      {
+         benchActive = (benchStep == BENCH_STEP_DOWNLOAD) ? &benchImage : &benchDriver;
+         benchOffset = 0u;
+         benchSequenceCounter = 1u;
+         request[length++] = 0x34u;
+         request[length++] = benchActive->dataFormat;
+         request[length++] = 0x44u;
+         BenchSetInteger(4u, (vuint32)benchActive->address, &request[length]);
+         length += 4u;
+         BenchSetInteger(4u, (vuint32)benchActive->length, &request[length]);
+         length += 4u;
+         break;
+      }
+      case BENCH_STEP_DRIVER_TRANSFER:
+      case BENCH_STEP_TRANSFER:
+      {
+         count = benchActive->transferLength - benchOffset;
+         if (count > benchBlockLength)
+         {
+            count = benchBlockLength;
+         }
+         request[length++] = 0x36u;
+         request[length++] = benchSequenceCounter;
+         memcpy(&request[length], &benchActive->transferData[benchOffset], count);
+         length += (vuintx)count;
+         break;
+      }
+      case BENCH_STEP_DRIVER_EXIT:
+      case BENCH_STEP_EXIT:
+      {
+         request[length++] = 0x37u;
+         break;
+      }
+      case BENCH_STEP_DRIVER_CHECKSUM:
+      case BENCH_STEP_CHECKSUM:
+      {
+         request[length++] = 0x31u;
+         request[length++] = 0x01u;
+         request[length++] = 0x02u;
+         request[length++] = 0x02u;
+         BenchSetInteger(4u, BenchCrc32(benchActive->data, benchActive->length), &request[length]);
+         length += 4u;
+         break;
+      }
+      case BENCH_STEP_ERASE:
+      {
+         request[length++] = 0x31u;
+         request[length++] = 0x01u;
+         request[length++] = 0xFFu;
+         request[length++] = 0x00u;
+         request[length++] = 0x44u;
+         BenchSetInteger(4u, (vuint32)benchImage.address, &request[length]);
+         length += 4u;
+         BenchSetInteger(4u, (vuint32)benchImage.length, &request[length]);
+         length += 4u;
+         break;
+      }
+      case BENCH_STEP_DEPENDENCIES:
+      {
+         request[length++] = 0x31u;
+         request[length++] = 0x01u;
+         request[length++] = 0xFFu;
+         request[length++] = 0x01u;
+         break;
+      }
+      case BENCH_STEP_RESET:
+      {
+         request[length++] = 0x11u;
+         request[length++] = 0x01u;
+         break;
+      }
+      default:
+      {
+         BenchFail("no request in step", 0u);
+         break;
+      }
+   }
+
+   return length;
+}
+
+/***********************************************************************************************************************
+ *  BenchSendRequest
+ **********************************************************************************************************************/
+/*! \brief       Send the request of the current step
+ **********************************************************************************************************************/
+static void BenchSendRequest( void )
+{
+   BenchTransmitRequest(BenchBuildRequest(), FblHostGetTime());
+}
+
+/***********************************************************************************************************************
+ *  BenchNextStep
+ **********************************************************************************************************************/
+/*! \brief       Evaluate positive response of the current step and start the next one
+ *  \param[in]   response Response message
+ *  \param[in]   length Length of response
+ **********************************************************************************************************************/
+static void BenchNextStep( const vuint8 * response, vuintx length )
+{
+   vuintx next;
+   vuintx lengthFormat;
+
+   next = benchStep + 1u;
+
+   switch (benchStep)
+   {
+      case BENCH_STEP_REQUEST_SEED:
+      {
+         if (length < 6u)
+         {
+            BenchFail("seed too short", length);
+         }
+         benchSeed = BenchGetInteger(4u, &response[2]);
+         break;
+      }
+      case BENCH_STEP_DRIVER_DOWNLOAD:
+      case BENCH_STEP_DOWNLOAD:
+      {
+         /* Maximum block length (including SID and sequence counter) */
+         lengthFormat = (vuintx)(response[1] >> 4u);
+         if ((lengthFormat == 0u) || (lengthFormat > 4u) || (length < (2u + lengthFormat)))
+         {
+            BenchFail("invalid RequestDownload response", response[1]);
+         }
+         benchBlockLength = BenchGetInteger(lengthFormat, &response[2]) - 2u;
+         if (benchBlockLength > (BENCH_MAX_MESSAGE_LENGTH - 2u))
+         {
+            benchBlockLength = BENCH_MAX_MESSAGE_LENGTH - 2u;
+         }
+         break;
+      }
+      case BENCH_STEP_DRIVER_TRANSFER:
+      case BENCH_STEP_TRANSFER:
+      {
+         if (response[1] != benchSequenceCounter)
+         {
+            BenchFail("wrong sequence counter in response", response[1]);
+         }
+         benchOffset += ((benchActive->transferLength - benchOffset) > benchBlockLength) ?
+                        benchBlockLength : (benchActive->transferLength - benchOffset);
+         benchSequenceCounter++;
+         benchTransferBlocks++;
+         if (benchOffset < benchActive->transferLength)
+         {
+            /* Repeat TransferData */
+            next = benchStep;
+         }
+         break;
+      }
+      case BENCH_STEP_DRIVER_CHECKSUM:
+      case BENCH_STEP_CHECKSUM:
+      case BENCH_STEP_ERASE:
+      case BENCH_STEP_DEPENDENCIES:
+      {
+         /* Routine status */
+         if ((length < 5u) || (response[4] != 0x00u))
+         {
+            BenchFail("routine failed", (length < 5u) ? 0xFFu : response[4]);
+         }
+         break;
+      }
+      default:
+      {
+         break;
+      }
+   }
+
+   BenchEnterStep(next);
+
+   if (benchStep == BENCH_STEP_DONE)
+   {
+      /* Bootloader resets after the response has been sent */
+      benchDeadline = FblHostGetTime() + BENCH_RESPONSE_TIMEOUT;
+   }
+   else
+   {
+      BenchSendRequest();
+   }
+}
+
+/***********************************************************************************************************************
+ *  BenchResponse
+ **********************************************************************************************************************/
+/*! \brief       Evaluate a complete response message
+ **********************************************************************************************************************/
+static void BenchResponse( const vuint8 * response, vuintx length )
+{
+   if (benchWaitResponse == 0u)
+   {
+      BenchFail("unexpected response", response[0]);
+   }
+
+   if ((length >= 3u) && (response[0] == 0x7Fu))
+   {
+      if (response[2] == BENCH_NRC_RESPONSE_PENDING)
+      {
+         benchResponsePending++;
+         benchDeadline = FblHostGetTime() + BENCH_RESPONSE_TIMEOUT;
+      }
+      else if (response[2] == BENCH_NRC_TIME_DELAY)
+      {
+         /* Security access delay after power on: repeat request later */
+         benchWaitResponse = 0u;
+         benchTxRequestPending = 1u;
+         benchDeadline = FblHostGetTime() + BENCH_RETRY_DELAY;
+      }
+      else
+      {
+         BenchFail("negative response", response[2]);
+      }
+   }
+   else if ((length >= 1u) && (response[0] == (vuint8)(benchTxBuffer[0] + 0x40u)))
+   {
+      benchWaitResponse = 0u;
+      BenchNextStep(response, length);
+   }
+   else
+   {
+      BenchFail("unexpected response", response[0]);
+   }
+}
+
+/***********************************************************************************************************************
+ *  BenchBuildDriver
+ **********************************************************************************************************************/
+/*! \brief       Build the downloadable flash driver: header and call table of the flash driver compiled into the host
+ *               executable
+ **********************************************************************************************************************/
+static void BenchBuildDriver( void )
+{
+   memset(benchDriverImage, 0x00, sizeof(benchDriverImage));
+
+   benchDriverImage[0] = FLASH_DRIVER_VERSION_INTERFACE;
+   benchDriverImage[1] = 0x00u;
+   benchDriverImage[2] = FLASH_DRIVER_VERSION_MASKTYPE;
+   benchDriverImage[3] = FLASH_DRIVER_VERSION_MCUTYPE;
+
+   /* Call table holds 32 bit addresses in target byte order */
+#define BENCH_SET_DRIVER_FCT(offset, fct) \
+   do { vuint32 a = (vuint32)(unsigned long)(fct); \
+        benchDriverImage[(offset)] = (vuint8)a; benchDriverImage[(offset) + 1u] = (vuint8)(a >> 8u); \
+        benchDriverImage[(offset) + 2u] = (vuint8)(a >> 16u); benchDriverImage[(offset) + 3u] = (vuint8)(a >> 24u); \
+   } while (0)
+
+   BENCH_SET_DRIVER_FCT(FLASH_DRIVER_INIT_OFFSET, ExpFlashInit);
+   BENCH_SET_DRIVER_FCT(FLASH_DRIVER_DEINIT_OFFSET, ExpFlashDeinit);
+   BENCH_SET_DRIVER_FCT(FLASH_DRIVER_ERASE_OFFSET, ExpFlashErase);
+   BENCH_SET_DRIVER_FCT(FLASH_DRIVER_WRITE_OFFSET, ExpFlashWrite);
+#if defined( FLASH_ENABLE_SET_RESETVECTOR_API )
+   BENCH_SET_DRIVER_FCT(FLASH_DRIVER_SETRESVEC_OFFSET, ExpFlashSetResetVector);
+#endif /* FLASH_ENABLE_SET_RESETVECTOR_API */
+#if defined( FLASH_ENABLE_ASYNC_API )
+   BENCH_SET_DRIVER_FCT(FLASH_DRIVER_ERASE_START_OFFSET, ExpFlashEraseStart);
+   BENCH_SET_DRIVER_FCT(FLASH_DRIVER_WRITE_START_OFFSET, ExpFlashWriteStart);
+   BENCH_SET_DRIVER_FCT(FLASH_DRIVER_POLL_OFFSET, ExpFlashPoll);
+#endif /* FLASH_ENABLE_ASYNC_API */
+
+#undef BENCH_SET_DRIVER_FCT
+
+   benchDriver.address = (unsigned long)flashCode;
+   benchDriver.length = 0x1000u;
+   benchDriver.data = benchDriverImage;
+   benchDriver.transferData = benchDriverImage;
+   benchDriver.transferLength = benchDriver.length;
+   benchDriver.dataFormat = 0x00u;
+}
+
+/***********************************************************************************************************************
+ *  BenchBuildImage
+ **********************************************************************************************************************/
+/*! \brief       Generate the application image (pseudo random, reproducible)
+ **********************************************************************************************************************/
+static void BenchBuildImage( unsigned long size )
+{
+   vuint8 * data;
+   vuint32 state;
+   unsigned long i;
+
+   data = (vuint8 *)malloc(size);
+   if (data == (vuint8 *)0)
+   {
+      BenchFail("out of memory", 0u);
+   }
+
+   state = 0x12345678ul;
+   for (i = 0u; i < size; i++)
+   {
+      state = ((state * 1103515245ul) + 12345ul) & 0xFFFFFFFFul;
+      data[i] = (vuint8)(state >> 16u);
+   }
+
+   benchImage.address = FblLogicalBlockTable.logicalBlock[0].blockStartAddress;
+   benchImage.length = size;
+   benchImage.data = data;
+   benchImage.transferData = data;
+   benchImage.transferLength = size;
+   benchImage.dataFormat = 0x00u;
+}
+
+#if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+/***********************************************************************************************************************
+ *  BenchBuildDelta
+ **********************************************************************************************************************/
+/*! \brief       Program reference data into the first optional logical block and download the image as patch stream
+ *  \details     The reference is derived from the start of the image: one byte is dropped every 4 KB (shifted copy
+ *               records) and one byte is changed every 2 KB (literal data). The rest of the image is sent as literal
+ *               data. The run checks that the bootloader reconstructs the image.
+ **********************************************************************************************************************/
+static void BenchBuildDelta( void )
+{
+   vuint8 * reference;
+   vuint8 * patch;
+   unsigned long refAddress;
+   unsigned long refLength;
+   unsigned long i;
+
+   refAddress = FblLogicalBlockTable.logicalBlock[1].blockStartAddress;
+   refLength = FblLogicalBlockTable.logicalBlock[1].blockLength;
+   if (refLength > (benchImage.length - (benchImage.length / 0x1000u)))
+   {
+      refLength = benchImage.length - (benchImage.length / 0x1000u);
+   }
+
+   /* Reference data is programmed directly into the code flash model */
+   reference = (vuint8 *)refAddress;
+   for (i = 0u; i < refLength; i++)
+   {
+      reference[i] = benchImage.data[i + (i / 0x1000u)];
+      if ((i & 0x7FFu) == 0x400u)
+      {
+         reference[i] ^= 0x5Au;
+      }
+   }
+
+   /* Worst case: complete image sent as literal data */
+   patch = (vuint8 *)malloc(benchImage.length + (((benchImage.length / 0xFFFFu) + 1u) * 3u));
+   if (patch == (vuint8 *)0)
+   {
+      BenchFail("out of memory", 0u);
+   }
+
+   benchImage.transferData = patch;
+   benchImage.transferLength = ExpDat_DeltaEncode(reference, refLength, refAddress,
+                                                  benchImage.data, benchImage.length, patch);
+   benchImage.dataFormat = FBL_MEM_DELTA_DATA_FORMAT;
+}
+#endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
+
+/***********************************************************************************************************************
+ *  BenchCrcWatchdog
+ **********************************************************************************************************************/
+/*! \brief       Watchdog trigger of the CRC throughput measurement
+ **********************************************************************************************************************/
+static void BenchCrcWatchdog( void )
+{
+   benchCrcWatchdogCalls++;
+}
+
+/***********************************************************************************************************************
+ *  BenchCrcThroughput
+ **********************************************************************************************************************/
+/*! \brief       Measure the throughput of SecM_ComputeCRC (host time) for the configured SEC_CRC_OPT
+ *  \details     Unaligned input data, the result is checked against the bitwise reference implementation.
+ *  \return      0 if all CRC values match, 1 otherwise
+ **********************************************************************************************************************/
+static int BenchCrcThroughput( void )
+{
+   SecM_CRCParamType crcParam;
+   vuint32 reference;
+   unsigned long offset;
+   vuintx i;
+   int result;
+   double seconds;
+
+   /* One additional byte: start of data is not word aligned */
+   BenchBuildImage(BENCH_CRC_DATA_SIZE + 1u);
+   reference = BenchCrc32(&benchImage.data[1], BENCH_CRC_DATA_SIZE);
+   result = 0;
+
+   SecM_InitPowerOnCRC();
+   crcParam.wdTriggerFct = BenchCrcWatchdog;
+
+   (void)clock_gettime(CLOCK_MONOTONIC, &benchWallStart);
+   for (i = 0u; i < BENCH_CRC_REPETITIONS; i++)
+   {
+      crcParam.crcState = SEC_CRC_INIT;
+      (void)SecM_ComputeCRC(&crcParam);
+      crcParam.crcState = SEC_CRC_COMPUTE;
+      for (offset = 0u; offset < BENCH_CRC_DATA_SIZE; offset += BENCH_CRC_SEGMENTATION)
+      {
+         crcParam.crcSourceBuffer = &benchImage.data[1u + offset];
+         crcParam.crcByteCount = BENCH_CRC_SEGMENTATION;
+         (void)SecM_ComputeCRC(&crcParam);
+      }
+      crcParam.crcState = SEC_CRC_FINALIZE;
+      (void)SecM_ComputeCRC(&crcParam);
+
+      if ((vuint32)crcParam.currentCRC != reference)
+      {
+         result = 1;
+      }
+   }
+   seconds = BenchElapsedWallTime();
+
+   printf("CRC-32 %-37s %8.1f MB/s, %lu watchdog calls per MB, %s\n",
+#if ( SEC_CRC_OPT == SEC_CRC_SIZE_OPTIMIZED )
+          "SEC_CRC_SIZE_OPTIMIZED (16 entries)",
+#elif ( SEC_CRC_OPT == SEC_CRC_ROM_OPTIMIZED )
+          "SEC_CRC_ROM_OPTIMIZED (256 entries)",
+#elif ( SEC_CRC_OPT == SEC_CRC_SLICE_OPTIMIZED )
+          "SEC_CRC_SLICE_OPTIMIZED (8 x 256)",
+#else
+          "SEC_CRC_SPEED_OPTIMIZED (256 entries)",
+#endif /* SEC_CRC_OPT */
+          ((double)BENCH_CRC_DATA_SIZE * BENCH_CRC_REPETITIONS) / (seconds * 1048576.0),
+          benchCrcWatchdogCalls / BENCH_CRC_REPETITIONS, (result == 0) ? "result ok" : "RESULT WRONG");
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  BenchRunBootloader
+ **********************************************************************************************************************/
+/*! \brief       Entry of the bootloader context, FblMain does not return
+ **********************************************************************************************************************/
+static void BenchRunBootloader( void )
+{
+   (void)FblMain();
+}
+
+/***********************************************************************************************************************
+ *  BenchUsage
+ **********************************************************************************************************************/
+/*! \brief       Print command line options and exit
+ **********************************************************************************************************************/
+static void BenchUsage( const char * name )
+{
+   fprintf(stderr,
+           "usage: %s [-s image size] [-b CAN bit rate] [-e erase us/32KB] [-w write us/256B] [-p poll ns]\n"
+           "       %s -c   (CRC-32 throughput)\n", name, name);
+   exit(2);
+}
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  FblBenchCanIndication
+ **********************************************************************************************************************/
+/*! \brief       Frame of the bootloader received by the tester
+ **********************************************************************************************************************/
+void FblBenchCanIndication( vuint32 id, const vuint8 * data, vuint8 dlc )
+{
+   vuint8 flowControl[3];
+   vuintx count;
+   vuint8 stmin;
+
+   if ((id != BENCH_CAN_ID_RESPONSE) || (dlc < 1u))
+   {
+      return;
+   }
+
+   if ((benchWaitFirstFrame != 0u) && ((data[0] >> 4u) <= 0x1u))
+   {
+      /* First frame of the response, P2server is met */
+      benchWaitFirstFrame = 0u;
+      if ((FblHostGetTime() - benchRequestEnd) > benchP2Max)
+      {
+         benchP2Max = FblHostGetTime() - benchRequestEnd;
+      }
+   }
+
+   switch (data[0] >> 4u)
+   {
+      case 0x0u:  /* Single frame */
+      {
+         benchRxLength = data[0] & 0x0Fu;
+         if ((benchRxLength == 0u) || (benchRxLength > 7u))
+         {
+            BenchFail("invalid single frame", data[0]);
+         }
+         memcpy(benchRxBuffer, &data[1], benchRxLength);
+         BenchResponse(benchRxBuffer, benchRxLength);
+         break;
+      }
+      case 0x1u:  /* First frame */
+      {
+         benchRxLength = ((vuintx)(data[0] & 0x0Fu) << 8u) | data[1];
+         memcpy(benchRxBuffer, &data[2], 6u);
+         benchRxPos = 6u;
+         benchRxSn = 1u;
+         benchDeadline = FblHostGetTime() + BENCH_RESPONSE_TIMEOUT;
+
+         /* Continue to send, no block size, no separation time */
+         flowControl[0] = 0x30u;
+         flowControl[1] = 0x00u;
+         flowControl[2] = 0x00u;
+         BenchTransmitFrame(flowControl, 3u, FblHostGetTime());
+         break;
+      }
+      case 0x2u:  /* Consecutive frame */
+      {
+         if ((data[0] & 0x0Fu) != benchRxSn)
+         {
+            BenchFail("wrong sequence number", data[0]);
+         }
+         benchRxSn = (vuint8)((benchRxSn + 1u) & 0x0Fu);
+         count = benchRxLength - benchRxPos;
+         if (count > 7u)
+         {
+            count = 7u;
+         }
+         memcpy(&benchRxBuffer[benchRxPos], &data[1], count);
+         benchRxPos += count;
+         if (benchRxPos >= benchRxLength)
+         {
+            BenchResponse(benchRxBuffer, benchRxLength);
+         }
+         break;
+      }
+      case 0x3u:  /* Flow control */
+      {
+         if (benchTxState != BENCH_TX_WAIT_FC)
+         {
+            break;
+         }
+
+         switch (data[0] & 0x0Fu)
+         {
+            case 0x0u:  /* Continue to send */
+            {
+               benchTxBlockSize = data[1];
+               benchTxBlockCount = 0u;
+               stmin = data[2];
+               if (stmin <= 0x7Fu)
+               {
+                  benchTxStmin = (tFblHostTime)stmin * 1000000ull;
+               }
+               else if ((stmin >= 0xF1u) && (stmin <= 0xF9u))
+               {
+                  benchTxStmin = (tFblHostTime)(stmin - 0xF0u) * 100000ull;
+               }
+               else
+               {
+                  benchTxStmin = 127ull * 1000000ull;
+               }
+               BenchTransmitConsecutiveFrame(FblHostGetTime() + benchTxStmin);
+               break;
+            }
+            case 0x1u:  /* Wait */
+            {
+               benchDeadline = FblHostGetTime() + BENCH_FLOW_CONTROL_TIMEOUT;
+               break;
+            }
+            default:
+            {
+               BenchFail("flow control overflow", data[0]);
+               break;
+            }
+         }
+         break;
+      }
+      default:
+      {
+         BenchFail("invalid frame", data[0]);
+         break;
+      }
+   }
+}
+
+/***********************************************************************************************************************
+ *  FblBenchCanConfirmation
+ **********************************************************************************************************************/
+/*! \brief       Frame of the tester has been sent
+ **********************************************************************************************************************/
+void FblBenchCanConfirmation( vuint32 id )
+{
+   (void)id;
+
+   if (benchTxState != BENCH_TX_FRAME)
+   {
+      /* Flow control frame of the tester */
+      return;
+   }
+
+   if (benchTxPos >= benchTxLength)
+   {
+      /* Request completely sent */
+      benchTxState = BENCH_TX_IDLE;
+      benchWaitResponse = 1u;
+      benchWaitFirstFrame = 1u;
+      benchRequestEnd = FblHostGetTime();
+      benchDeadline = benchRequestEnd + BENCH_P2_TIMEOUT;
+   }
+   else if ((benchTxPos <= 6u) || ((benchTxBlockSize != 0u) && (benchTxBlockCount >= benchTxBlockSize)))
+   {
+      /* First frame sent or block complete */
+      benchTxState = BENCH_TX_WAIT_FC;
+      benchDeadline = FblHostGetTime() + BENCH_FLOW_CONTROL_TIMEOUT;
+   }
+   else
+   {
+      BenchTransmitConsecutiveFrame(FblHostGetTime() + benchTxStmin);
+   }
+}
+
+/***********************************************************************************************************************
+ *  FblBenchCheckTimeout
+ **********************************************************************************************************************/
+/*! \brief       Supervise response and flow control timeouts, repeat delayed requests
+ **********************************************************************************************************************/
+void FblBenchCheckTimeout( void )
+{
+   if (FblHostGetTime() < benchDeadline)
+   {
+      return;
+   }
+
+   if (benchTxRequestPending != 0u)
+   {
+      benchTxRequestPending = 0u;
+      BenchSendRequest();
+   }
+   else if (benchWaitFirstFrame != 0u)
+   {
+      BenchFail("P2 timeout", (unsigned long)benchTxBuffer[0]);
+   }
+   else if ((benchWaitResponse != 0u) || (benchTxState == BENCH_TX_WAIT_FC) || (benchStep == BENCH_STEP_DONE))
+   {
+      BenchFail("timeout", (unsigned long)benchTxState);
+   }
+   else
+   {
+      /* Nothing to supervise */
+   }
+}
+
+/***********************************************************************************************************************
+ *  __wrap_FblMemTask
+ **********************************************************************************************************************/
+/*! \brief       Count iterations of the pipelined programming task
+ **********************************************************************************************************************/
+void __wrap_FblMemTask( void )
+{
+   benchMemTaskCalls++;
+   if (benchStepPhase[benchStep] == BENCH_PHASE_TRANSFER)
+   {
+      benchMemTaskCallsTransfer++;
+   }
+
+   __real_FblMemTask();
+}
+
+/***********************************************************************************************************************
+ *  __wrap_ApplFblReset
+ **********************************************************************************************************************/
+/*! \brief       Reset requested by the bootloader: end of the run
+ **********************************************************************************************************************/
+void __wrap_ApplFblReset( void )
+{
+   if (benchStep != BENCH_STEP_DONE)
+   {
+      BenchFail("unexpected reset", 0u);
+   }
+
+   BenchEnterStep(BENCH_STEP_DONE);
+   benchPhaseTime[BENCH_PHASE_FINISH] += FblHostGetTime() - benchPhaseStart[BENCH_PHASE_FINISH];
+
+   exit(BenchReport());
+}
+
+/***********************************************************************************************************************
+ *  __wrap_ApplFblFatalError
+ **********************************************************************************************************************/
+/*! \brief       Fatal error of the bootloader: abort the run
+ **********************************************************************************************************************/
+void __wrap_ApplFblFatalError( FBL_DECL_ASSERT_EXTENDED_INFO(vuint8 errorCode) )
+{
+   BenchFail("fatal error of bootloader", errorCode);
+}
+
+/***********************************************************************************************************************
+ *  main
+ **********************************************************************************************************************/
+/*! \brief       Parse the command line, prepare memory, tester and image and start the bootloader
+ **********************************************************************************************************************/
+int main( int argc, char ** argv )
+{
+   unsigned long imageSize;
+   int option;
+   void * stack;
+
+   imageSize = BENCH_DEFAULT_IMAGE_SIZE;
+
+   while ((option = getopt(argc, argv, "s:b:e:w:p:c")) != -1)
+   {
+      switch (option)
+      {
+         case 'c': return BenchCrcThroughput();
+         case 's': imageSize = strtoul(optarg, 0, 0); break;
+         case 'b': fblHostParam.canBitrate = strtoul(optarg, 0, 0); break;
+         case 'e': fblHostParam.flashEraseTimeUs = strtoul(optarg, 0, 0); break;
+         case 'w': fblHostParam.flashWriteTimeUs = strtoul(optarg, 0, 0); break;
+         case 'p': fblHostParam.pollTimeNs = strtoul(optarg, 0, 0); break;
+         default:  BenchUsage(argv[0]); break;
+      }
+   }
+
+   if ((imageSize == 0u) || (imageSize > FblLogicalBlockTable.logicalBlock[0].blockLength) ||
+       (fblHostParam.canBitrate == 0u))
+   {
+      BenchUsage(argv[0]);
+   }
+
+   (void)clock_gettime(CLOCK_MONOTONIC, &benchWallStart);
+
+   FblHostInitMemory();
+   BenchBuildDriver();
+   BenchBuildImage(imageSize);
+#if defined( FBL_MEM_ENABLE_DELTA_DOWNLOAD )
+   BenchBuildDelta();
+#endif /* FBL_MEM_ENABLE_DELTA_DOWNLOAD */
+
+   /* First request after start-up of the bootloader */
+   benchStep = BENCH_STEP_EXTENDED_SESSION;
+   benchPhaseStart[BENCH_PHASE_SETUP] = BENCH_START_TIME;
+   benchBlockLength = 7u;
+   BenchTransmitRequest(BenchBuildRequest(), BENCH_START_TIME);
+
+   /* Execute the bootloader on a stack below 4 GB */
+   stack = mmap((void *)0, BENCH_STACK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+   if (stack == MAP_FAILED)
+   {
+      BenchFail("cannot map stack", 0u);
+   }
+   (void)getcontext(&benchFblContext);
+   benchFblContext.uc_stack.ss_sp = stack;
+   benchFblContext.uc_stack.ss_size = BENCH_STACK_SIZE;
+   benchFblContext.uc_link = &benchMainContext;
+   makecontext(&benchFblContext, BenchRunBootloader, 0);
+   (void)swapcontext(&benchMainContext, &benchFblContext);
+
+   /* Bootloader returned, which is not expected */
+   BenchFail("bootloader terminated", 0u);
+
+   return 1;
+}
+
+/***********************************************************************************************************************
+ *  END OF FILE: FBL_BENCH.C
+ **********************************************************************************************************************/
@@ -0,0 +1,797 @@
+/***********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/** \file
+ *  \brief         Host build of the demo bootloader: replacement of fbl_hw.c
+ *  \details       Provides the interface of fbl_hw.c (timer, CAN driver, memory access) on a PC. The RS-CAN transmit
+ *                 buffer is kept as register image, so FblCanRetransmit() and the status checks of fbl_hw.c work
+ *                 unchanged. Reception is modelled by the receive FIFO and the receive rules of the configuration.
+ *                 Time only advances by polling the CAN controller or the flash library (see fcl_sim.c) and by the
+ *                 CAN bus. The bus transmits one frame at a time, the exact frame length including stuff bits is
+ *                 used and the lower identifier wins the arbitration.
+ */
+/**********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  INCLUDES
+ **********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "fbl_inc.h"
+#include "fbl_host.h"
+
+/***********************************************************************************************************************
+ *  DEFINES
+ **********************************************************************************************************************/
+
+#if defined( FBL_ENABLE_CAN_FD ) || \
+    defined( FBL_ENABLE_CAN_RX_QUEUE ) || \
+    defined( FBL_ENABLE_CAN_RX_DIRECT_ACCESS ) || \
+    defined( FBL_ENABLE_STAY_IN_BOOT ) || \
+    defined( FBL_ENABLE_SLEEPMODE )
+# error "Host build: configuration not supported by CAN model"
+#endif
+
+/** Length of one millisecond tick [ns] */
+#define FBL_HOST_TICK_NS               1000000ull
+/** Clock of free running timer TAUX0 channel 2 [MHz] */
+#define FBL_HOST_TIMER_CLOCK_MHZ       (FBL_SYSTEM_FREQUENCY / 2u)
+
+/** Frame bits which are not subject to bit stuffing: CRC delimiter, ACK slot and delimiter, EOF, intermission */
+#define FBL_HOST_CAN_UNSTUFFED_BITS    13u
+
+/***********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+/** CAN frame on the bus model */
+typedef struct
+{
+   vuint32      id;
+   vuint8       dlc;
+   vuint8       data[8];
+   tFblHostTime readyTime;          /**< Earliest start of transmission */
+} tFblHostCanFrame;
+
+/** Receive FIFO entry */
+typedef struct
+{
+   tFblHostCanFrame frame;
+   vuint8           handle;         /**< Label of matching receive rule */
+} tFblHostRxFifoEntry;
+
+/***********************************************************************************************************************
+ *  LOCAL DATA
+ **********************************************************************************************************************/
+
+/** Virtual time */
+static tFblHostTime fblHostTime;
+
+/** RS-CAN register image */
+static tCanCell fblHostCanCell;
+
+/** Frame in the transmit buffer of the bootloader */
+static tFblHostCanFrame fblHostEcuTxFrame;
+/** Transmit buffer of the bootloader holds a frame which has not been sent yet */
+static vuint8 fblHostEcuTxPending;
+
+/** Frames queued by the tester */
+static tFblHostCanFrame fblHostTesterQueue[FBL_HOST_CAN_TESTER_QUEUE_SIZE];
+static vuintx fblHostTesterQueueRead;
+static vuintx fblHostTesterQueueWrite;
+
+/** Frame currently transmitted on the bus */
+static tFblHostCanFrame fblHostBusFrame;
+static vuint8 fblHostBusBusy;
+static vuint8 fblHostBusFromEcu;
+static tFblHostTime fblHostBusFrameEnd;
+
+/** Receive FIFO of the bootloader */
+static tFblHostRxFifoEntry fblHostRxFifo[FBL_HOST_CAN_RX_FIFO_SIZE];
+static vuintx fblHostRxFifoRead;
+static vuintx fblHostRxFifoWrite;
+
+#  if defined( FBL_ENABLE_CAN_CONFIRMATION )
+static void (*confirmationFunction)(CanTransmitHandle txObject);
+#  endif
+
+/***********************************************************************************************************************
+ *  GLOBAL DATA
+ **********************************************************************************************************************/
+
+tFblHostParam fblHostParam =
+{
+   FBL_HOST_CAN_BITRATE,
+   FBL_HOST_POLL_TIME_NS,
+   FBL_HOST_FLASH_ERASE_TIME_US,
+   FBL_HOST_FLASH_WRITE_TIME_US
+};
+
+tFblHostStatistics fblHostStatistics;
+
+volatile tCanCellPtr Can;
+
+V_MEMRAM0 V_MEMRAM1 vuint32 V_MEMRAM2 CanRxActualId;        /* Current received ID */
+V_MEMRAM0 V_MEMRAM1 vuint8 V_MEMRAM2  CanRxActualDLC;       /* Current received DLC    */
+V_MEMRAM0 V_MEMRAM1 vuint8 V_MEMRAM2  CanRxActualData[kFblCanMaxDataLength];  /* Current received data   */
+
+/* Replaces fbl_applvect.c: the address of the start-up code does not fit into a 32 bit constant on the host */
+V_MEMROM0 V_MEMROM1 vuint32 V_MEMROM2 ApplIntJmpTable[2] = { APPLVECT_FROM_BOOT, 0u };
+
+/* Initialization data of the receive rules, same layout as in fbl_hw.c */
+V_MEMROM0 V_MEMROM1 tFblCanIdTable V_MEMROM2 kFblCanIdTable =
+{
+   CAN_BCFG,
+   {
+#    if (FBL_CAN_NUMBER_OF_RX_ID > 0)
+       FBL_CAN_RX_ID0
+#     if (FBL_CAN_NUMBER_OF_RX_ID > 1)
+      ,FBL_CAN_RX_ID1
+#     endif
+#     if (FBL_CAN_NUMBER_OF_RX_ID > 2)
+      ,FBL_CAN_RX_ID2
+#     endif
+#    endif /* FBL_CAN_NUMBER_OF_RX_ID > 0 */
+   },
+   {
+#    if (FBL_CAN_NUMBER_OF_RX_ID > 0)
+       FBL_CAN_RX_ID_MASK
+#     if (FBL_CAN_NUMBER_OF_RX_ID > 1)
+      ,FBL_CAN_RX_ID_MASK
+#     endif
+#     if (FBL_CAN_NUMBER_OF_RX_ID > 2)
+      ,FBL_CAN_RX_ID_MASK
+#     endif
+#    endif /* FBL_CAN_NUMBER_OF_RX_ID > 0 */
+   }
+};
+
+/***********************************************************************************************************************
+ *  EXTERNAL DATA
+ **********************************************************************************************************************/
+
+extern tFblCanIdTable fblCanIdTable;
+
+/***********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  FblHostMap
+ **********************************************************************************************************************/
+/*! \brief       Map memory at a fixed address of the target memory map
+ *  \param[in]   address Start address
+ *  \param[in]   size Size of the area
+ *  \param[in]   fillValue Initial value of all bytes
+ **********************************************************************************************************************/
+static void FblHostMap( unsigned long address, unsigned long size, vuint8 fillValue )
+{
+   void * area;
+
+   area = mmap((void *)address, size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+   if (area != (void *)address)
+   {
+      fprintf(stderr, "Host: cannot map 0x%08lX..0x%08lX\n", address, (address + size) - 1u);
+      exit(2);
+   }
+
+   memset(area, fillValue, size);
+}
+
+/***********************************************************************************************************************
+ *  FblHostSetTime
+ **********************************************************************************************************************/
+/*! \brief       Move virtual time forward and signal elapsed millisecond ticks to the timer interrupt flag
+ *  \param[in]   newTime New value of the virtual time
+ **********************************************************************************************************************/
+static void FblHostSetTime( tFblHostTime newTime )
+{
+   if ((newTime / FBL_HOST_TICK_NS) != (fblHostTime / FBL_HOST_TICK_NS))
+   {
+      /* Interrupt request flag of TAUX0 channel 0 (see FblTimerGet) */
+      FBL_ICTAUX0I0 |= (vuint16)0x1000u;
+   }
+
+   fblHostTime = newTime;
+}
+
+/***********************************************************************************************************************
+ *  FblHostCanFrameBits
+ **********************************************************************************************************************/
+/*! \brief       Number of bits of a standard data frame including stuff bits and intermission
+ *  \param[in]   frame CAN frame
+ *  \return      Frame length in bits
+ **********************************************************************************************************************/
+static vuintx FblHostCanFrameBits( const tFblHostCanFrame * frame )
+{
+   vuint8 bits[19u + 64u + 15u];
+   vuintx count;
+   vuintx i;
+   vuintx stuffBits;
+   vuintx runLength;
+   vuint8 lastBit;
+   vuint16 crc;
+
+   count = 0u;
+   bits[count++] = 0u;                                        /* SOF */
+   for (i = 0u; i < 11u; i++)
+   {
+      bits[count++] = (vuint8)((frame->id >> (10u - i)) & 0x01u);
+   }
+   bits[count++] = 0u;                                        /* RTR */
+   bits[count++] = 0u;                                        /* IDE */
+   bits[count++] = 0u;                                        /* r0 */
+   for (i = 0u; i < 4u; i++)
+   {
+      bits[count++] = (vuint8)((frame->dlc >> (3u - i)) & 0x01u);
+   }
+   for (i = 0u; i < (vuintx)(frame->dlc * 8u); i++)
+   {
+      bits[count++] = (vuint8)((frame->data[i >> 3u] >> (7u - (i & 0x07u))) & 0x01u);
+   }
+
+   /* CRC-15 over all preceding bits */
+   crc = 0u;
+   for (i = 0u; i < count; i++)
+   {
+      if ((((crc >> 14u) & 0x01u) ^ bits[i]) != 0u)
+      {
+         crc = (vuint16)(((crc << 1u) ^ 0x4599u) & 0x7FFFu);
+      }
+      else
+      {
+         crc = (vuint16)((crc << 1u) & 0x7FFFu);
+      }
+   }
+   for (i = 0u; i < 15u; i++)
+   {
+      bits[count++] = (vuint8)((crc >> (14u - i)) & 0x01u);
+   }
+
+   /* A stuff bit of inverted value is inserted after five equal bits and starts a new sequence */
+   stuffBits = 0u;
+   lastBit = bits[0];
+   runLength = 1u;
+   for (i = 1u; i < count; i++)
+   {
+      if (bits[i] == lastBit)
+      {
+         runLength++;
+      }
+      else
+      {
+         lastBit = bits[i];
+         runLength = 1u;
+      }
+
+      if (runLength == 5u)
+      {
+         stuffBits++;
+         lastBit ^= 0x01u;
+         runLength = 1u;
+      }
+   }
+
+   return count + stuffBits + FBL_HOST_CAN_UNSTUFFED_BITS;
+}
+
+/***********************************************************************************************************************
+ *  FblHostCanSync
+ **********************************************************************************************************************/
+/*! \brief       Take over a transmit request of the bootloader from the register image
+ **********************************************************************************************************************/
+static void FblHostCanSync( void )
+{
+   if ((fblHostCanCell.ChBC[kFblCanChannel].TBCR[0] & kCanCrTxBufReq) != 0u)
+   {
+      fblHostCanCell.ChBC[kFblCanChannel].TBCR[0] &= FblInvert8Bit(kCanCrTxBufReq);
+      fblHostCanCell.ChBS[kFblCanChannel].TBSR[0] |= kCanSrTxBufMaskTReq;
+      fblHostEcuTxFrame.readyTime = fblHostTime;
+      fblHostEcuTxPending = 1u;
+   }
+}
+
+/***********************************************************************************************************************
+ *  FblHostCanStartFrame
+ **********************************************************************************************************************/
+/*! \brief       Start transmission of the next frame, if one is ready
+ *  \param[in]   limit End of the current time step
+ *  \return      1 if a frame has been started, 0 otherwise
+ **********************************************************************************************************************/
+static vuint8 FblHostCanStartFrame( tFblHostTime limit )
+{
+   tFblHostTime startTime;
+   tFblHostCanFrame * tester;
+   vuint8 ecuReady;
+   vuint8 testerReady;
+
+   tester = (fblHostTesterQueueRead != fblHostTesterQueueWrite) ?
+            &fblHostTesterQueue[fblHostTesterQueueRead % FBL_HOST_CAN_TESTER_QUEUE_SIZE] : (tFblHostCanFrame *)0;
+
+   /* Earliest possible start of a transmission */
+   startTime = limit + 1u;
+   if (fblHostEcuTxPending != 0u)
+   {
+      startTime = fblHostEcuTxFrame.readyTime;
+   }
+   if ((tester != (tFblHostCanFrame *)0) && (tester->readyTime < startTime))
+   {
+      startTime = tester->readyTime;
+   }
+   if (startTime < fblHostTime)
+   {
+      startTime = fblHostTime;
+   }
+   if (startTime > limit)
+   {
+      return 0u;
+   }
+
+   FblHostSetTime(startTime);
+
+   /* Arbitration between all frames ready at this point in time */
+   ecuReady = (vuint8)((fblHostEcuTxPending != 0u) && (fblHostEcuTxFrame.readyTime <= startTime));
+   testerReady = (vuint8)((tester != (tFblHostCanFrame *)0) && (tester->readyTime <= startTime));
+   if ((ecuReady != 0u) && ((testerReady == 0u) || (fblHostEcuTxFrame.id < tester->id)))
+   {
+      fblHostBusFrame = fblHostEcuTxFrame;
+      fblHostBusFromEcu = 1u;
+      fblHostEcuTxPending = 0u;
+   }
+   else
+   {
+      fblHostBusFrame = *tester;
+      fblHostBusFromEcu = 0u;
+      fblHostTesterQueueRead++;
+   }
+
+   fblHostBusBusy = 1u;
+   fblHostBusFrameEnd = startTime +
+      (((tFblHostTime)FblHostCanFrameBits(&fblHostBusFrame) * 1000000000ull) / fblHostParam.canBitrate);
+
+   return 1u;
+}
+
+/***********************************************************************************************************************
+ *  FblHostCanEndFrame
+ **********************************************************************************************************************/
+/*! \brief       Complete transmission of the current frame and deliver it to the receivers
+ **********************************************************************************************************************/
+static void FblHostCanEndFrame( void )
+{
+   tFblHostRxFifoEntry * rxEntry;
+   vuintx i;
+
+   FblHostSetTime(fblHostBusFrameEnd);
+   fblHostBusBusy = 0u;
+
+   if (fblHostBusFromEcu != 0u)
+   {
+      fblHostStatistics.canFramesEcu++;
+
+      /* Transmit request completed */
+      fblHostCanCell.ChBS[kFblCanChannel].TBSR[0] &= FblInvert8Bit(kCanSrTxBufMaskTReq);
+      fblHostCanCell.ChBS[kFblCanChannel].TBSR[0] |= kCanSrTxBufMaskComplete;
+
+      FblBenchCanIndication(fblHostBusFrame.id, fblHostBusFrame.data, fblHostBusFrame.dlc);
+   }
+   else
+   {
+      fblHostStatistics.canFramesTester++;
+
+      /* Apply receive rules, first match is stored in the receive FIFO */
+      for (i = 0u; i < FBL_CAN_NUMBER_OF_ID_TABLE_ENTRIES; i++)
+      {
+         if (((fblHostBusFrame.id ^ fblCanIdTable.CanRxId[i]) & fblCanIdTable.CanRxMask[i]) == 0u)
+         {
+            if ((fblHostRxFifoWrite - fblHostRxFifoRead) < FBL_HOST_CAN_RX_FIFO_SIZE)
+            {
+               rxEntry = &fblHostRxFifo[fblHostRxFifoWrite % FBL_HOST_CAN_RX_FIFO_SIZE];
+               rxEntry->frame = fblHostBusFrame;
+               rxEntry->handle = (vuint8)(i + 1u);
+               fblHostRxFifoWrite++;
+            }
+            else
+            {
+               fblHostStatistics.canRxOverruns++;
+            }
+            break;
+         }
+      }
+
+      FblBenchCanConfirmation(fblHostBusFrame.id);
+   }
+}
+
+/***********************************************************************************************************************
+ *  FblHostPoll
+ **********************************************************************************************************************/
+/*! \brief       Account the execution time of one poll of the CAN controller
+ **********************************************************************************************************************/
+static void FblHostPoll( void )
+{
+   fblHostStatistics.canPolls++;
+   FblHostAdvanceTime(fblHostParam.pollTimeNs);
+}
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS (HOST MODEL)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  FblHostInitMemory
+ **********************************************************************************************************************/
+/*! \brief       Map peripheral registers and flash memory to their target addresses
+ *  \details     Code flash and user boot area are erased (0xFF). Clock status registers report a stable clock.
+ **********************************************************************************************************************/
+void FblHostInitMemory( void )
+{
+   FblHostMap(FBL_HOST_SFR_START, FBL_HOST_SFR_SIZE, 0x00u);
+   FblHostMap(FBL_HOST_CODE_FLASH_START, (FBL_HOST_CODE_FLASH_END - FBL_HOST_CODE_FLASH_START) + 1u, FBL_FLASH_DELETED);
+   FblHostMap(FBL_HOST_USER_AREA_START, (FBL_HOST_USER_AREA_END - FBL_HOST_USER_AREA_START) + 1u, FBL_FLASH_DELETED);
+
+   /* Clock selection and divider active, checked by ApplFblInit */
+   FBL_CKSC0STAT = 0x03ul;
+   FBL_CLKD0STAT = 0x03ul;
+}
+
+/***********************************************************************************************************************
+ *  FblHostGetTime
+ **********************************************************************************************************************/
+/*! \brief       Returns the virtual time
+ *  \return      Time since start [ns]
+ **********************************************************************************************************************/
+tFblHostTime FblHostGetTime( void )
+{
+   return fblHostTime;
+}
+
+/***********************************************************************************************************************
+ *  FblHostAdvanceTime
+ **********************************************************************************************************************/
+/*! \brief       Advance the virtual time and process all bus events in between
+ *  \param[in]   duration Time step [ns]
+ **********************************************************************************************************************/
+void FblHostAdvanceTime( tFblHostTime duration )
+{
+   tFblHostTime limit;
+
+   limit = fblHostTime + duration;
+
+   FblHostCanSync();
+
+   for (;;)
+   {
+      if (fblHostBusBusy != 0u)
+      {
+         if (fblHostBusFrameEnd > limit)
+         {
+            break;
+         }
+         FblHostCanEndFrame();
+      }
+      else if (FblHostCanStartFrame(limit) == 0u)
+      {
+         break;
+      }
+      else
+      {
+         /* Frame started */
+      }
+   }
+
+   FblHostSetTime(limit);
+   FblBenchCheckTimeout();
+}
+
+/***********************************************************************************************************************
+ *  FblHostCanTesterTransmit
+ **********************************************************************************************************************/
+/*! \brief       Queue a frame of the tester for transmission
+ *  \param[in]   id Standard CAN identifier
+ *  \param[in]   data Frame data
+ *  \param[in]   dlc Data length code (0..8)
+ *  \param[in]   readyTime Earliest start of transmission
+ *  \return      1 if the frame has been queued, 0 if the queue is full
+ **********************************************************************************************************************/
+vuint8 FblHostCanTesterTransmit( vuint32 id, const vuint8 * data, vuint8 dlc, tFblHostTime readyTime )
+{
+   tFblHostCanFrame * frame;
+
+   if ((fblHostTesterQueueWrite - fblHostTesterQueueRead) >= FBL_HOST_CAN_TESTER_QUEUE_SIZE)
+   {
+      return 0u;
+   }
+
+   frame = &fblHostTesterQueue[fblHostTesterQueueWrite % FBL_HOST_CAN_TESTER_QUEUE_SIZE];
+   frame->id = id;
+   frame->dlc = dlc;
+   memset(frame->data, 0, sizeof(frame->data));
+   memcpy(frame->data, data, dlc);
+   frame->readyTime = readyTime;
+   fblHostTesterQueueWrite++;
+
+   return 1u;
+}
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS (INTERFACE OF FBL_HW.C)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  FblTimerInit
+ **********************************************************************************************************************/
+/*! \brief       Initialize the timer for a 1ms-cycle
+ *  \details     The millisecond tick is generated by the virtual time.
+ **********************************************************************************************************************/
+void FblTimerInit( void )
+{
+   FblTimerReset();
+}
+
+/***********************************************************************************************************************
+ *  FblGetTimerValue
+ **********************************************************************************************************************/
+/*! \brief       Returns current timer value
+ *  \return      Value of free running 16 bit counter
+ **********************************************************************************************************************/
+vuint16 FblGetTimerValue( void )
+{
+   return (vuint16)((fblHostTime * FBL_HOST_TIMER_CLOCK_MHZ) / 1000u);
+}
+
+#if defined( FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT )
+/***********************************************************************************************************************
+ *  FblGetRuntimeTimerValue
+ **********************************************************************************************************************/
+/*! \brief       Returns a timer value with a resolution of one tick of the 1ms timer
+ *  \details     Derived from the virtual time, wraps around after kFblHwRuntimeTimerPeriod ticks like the target.
+ *  \return      Current timer value
+ **********************************************************************************************************************/
+vuint32 FblGetRuntimeTimerValue( void )
+{
+   return (vuint32)(((fblHostTime * ((tFblHostTime)(FBL_TIMER_RELOAD_VALUE) + 1u)) / FBL_HOST_TICK_NS)
+                    % (tFblHostTime)kFblHwRuntimeTimerPeriod);
+}
+#endif /* FBL_MAIN_ENABLE_RUNTIME_MEASUREMENT */
+
+/***********************************************************************************************************************
+ *  FblCanInit
+ **********************************************************************************************************************/
+/*! \brief       Initialize CAN model, discard pending frames of the bootloader
+ **********************************************************************************************************************/
+void FblCanInit( void )
+{
+   memset((void *)&fblHostCanCell, 0, sizeof(fblHostCanCell));
+   Can = &fblHostCanCell;
+
+   fblHostEcuTxPending = 0u;
+   fblHostRxFifoRead = fblHostRxFifoWrite;
+#  if defined( FBL_ENABLE_CAN_CONFIRMATION )
+   confirmationFunction = V_NULL;
+#  endif
+}
+
+/***********************************************************************************************************************
+ *  FblCanParamInit
+ **********************************************************************************************************************/
+/*! \brief       Initialize CAN initialization parameters
+ **********************************************************************************************************************/
+void FblCanParamInit( void )
+{
+}
+
+/***********************************************************************************************************************
+ *  FblCanTransmit
+ **********************************************************************************************************************/
+/*! \brief       This function transmits a CAN message
+ *  \pre         CAN interface must be initialized before call
+ *  \param[in]   tmtObject Pointer to TransmitObject
+ *  \return      The function returns kFblCanTxOk if CAN cell accepted transmit or kFblCanTxFailed if not
+ **********************************************************************************************************************/
+vuint8 FblCanTransmit( tMsgObject * tmtObject )
+{
+   vuint8 result = kFblCanTxOk;
+   vuintx i;
+
+   FblHostCanSync();
+
+   if (((Can->ChBS[kFblCanChannel].TBSR[0] & (kCanSrTxBufMaskAReq | kCanSrTxBufMaskTReq)) != 0u) ||
+       ((Can->ChBC[kFblCanChannel].TBCR[0] & kCanCrTxBufReq) != 0u))
+   {
+      /* Tx object used, quit with error */
+      result = kFblCanTxFailed;
+   }
+   else
+   {
+      if ((Can->ChBS[kFblCanChannel].TBSR[0] & kCanSrTxBufMaskPending) != 0u)
+      {
+#if defined( FBL_ENABLE_CAN_CONFIRMATION )
+         result = kFblCanTxFailed;
+#else
+         /* Clear complete or cancel flag and release the object */
+         Can->ChBS[kFblCanChannel].TBSR[0] &= FblInvert8Bit(kCanSrTxBufMaskPending);
+#endif
+      }
+   }
+
+   if (kFblCanTxOk == result)
+   {
+      fblHostEcuTxFrame.id = tmtObject->msgObject.Id & kCanStdIdMask;
+      fblHostEcuTxFrame.dlc = tmtObject->msgObject.DLC;
+      for (i = 0u; i < 8u; i++)
+      {
+         fblHostEcuTxFrame.data[i] = tmtObject->msgObject.DataFld[i];
+      }
+
+      /* Tx request */
+      Can->ChBC[kFblCanChannel].TBCR[0] |= kCanCrTxBufReq;
+
+#  if defined( FBL_ENABLE_CAN_CONFIRMATION )
+      confirmationFunction = tmtObject->ConfirmationFct;
+#  endif
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  FblCanMsgTransmitted
+ **********************************************************************************************************************/
+/*! \brief       This function returns kFblCanTxOk, if the message was transmitted.
+ *  \pre         CAN interface must be initialized before call
+ *  \return      kFblCanTxInProgress - ongoing transmission\n
+ *               kFblCanTxOk         - message transmitted\n
+ *               kFblCanTxFailed     - no TX in progress or finished
+ **********************************************************************************************************************/
+vuint8 FblCanMsgTransmitted( void )
+{
+   vuint8 result = kFblCanTxFailed;
+
+   FblHostPoll();
+
+   /* Check if message transmission is pending  */
+   if ((Can->ChBS[kFblCanChannel].TBSR[0] & (kCanSrTxBufMaskAReq | kCanSrTxBufMaskTReq)) != 0u)
+   {
+      /* Message transmission currently in progress */
+      result = kFblCanTxInProgress;
+   }
+   else
+   {
+      if ((Can->ChBS[kFblCanChannel].TBSR[0] & kCanSrTxBufMaskPending) != 0u)
+      {
+#  if defined( FBL_ENABLE_CAN_CONFIRMATION )
+         /* Call confirmation function if available */
+         if (confirmationFunction != V_NULL)
+         {
+            confirmationFunction(0);
+         }
+#  endif
+         /* Clear complete or cancel flag and release the object */
+         Can->ChBS[kFblCanChannel].TBSR[0] &= FblInvert8Bit(kCanSrTxBufMaskPending);
+         result = kFblCanTxOk;
+      }
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  FblCanReceive
+ **********************************************************************************************************************/
+/*! \brief       Function searches for new received can messages
+ *  \pre         CAN hardware has to be initialized before call
+ *  \return      New message received ( value !=0 )
+ **********************************************************************************************************************/
+vuint32 FblCanReceive( void )
+{
+   FblHostPoll();
+
+   return (vuint32)((fblHostRxFifoRead != fblHostRxFifoWrite) ? 0x01u : 0x00u);
+}
+
+/***********************************************************************************************************************
+ *  FblCanProcessRxMsg
+ **********************************************************************************************************************/
+/*! \brief       Pass the oldest message of the receive FIFO to FblHandleRxMsg()
+ *  \pre         CAN hardware has to be initialized before call
+ **********************************************************************************************************************/
+void FblCanProcessRxMsg( void )
+{
+   tFblHostRxFifoEntry * rxEntry;
+   vuintx i;
+
+   if (fblHostRxFifoRead != fblHostRxFifoWrite)
+   {
+      rxEntry = &fblHostRxFifo[fblHostRxFifoRead % FBL_HOST_CAN_RX_FIFO_SIZE];
+      for (i = 0u; i < 8u; i++)
+      {
+         CanRxActualData[i] = rxEntry->frame.data[i];
+      }
+      CanRxActualDLC = rxEntry->frame.dlc;
+      CanRxActualId  = rxEntry->frame.id;
+
+      /* Point to next msg in fifo */
+      fblHostRxFifoRead++;
+
+      FblHandleRxMsg(rxEntry->handle, CanRxActualData);
+   }
+}
+
+/***********************************************************************************************************************
+ *  FblCanErrorTask
+ **********************************************************************************************************************/
+/*! \brief       This function checks if the CAN hardware is in a bus-off state.
+ *  \details     Bus errors are not modelled.
+ **********************************************************************************************************************/
+void FblCanErrorTask( void )
+{
+}
+
+/***********************************************************************************************************************
+ *  FblReadByte
+ **********************************************************************************************************************/
+/*! \brief          This function can be used to read one byte from the given address.
+ *  \param[in]      Read address.
+ *  \return         Byte at memory location 'address'
+ **********************************************************************************************************************/
+vuint8 FblReadByte( FBL_ADDR_TYPE address )
+{
+   return *(V_MEMROM1_FAR vuint8 V_MEMROM2_FAR V_MEMROM3 *)(unsigned long)address;
+}
+
+/***********************************************************************************************************************
+ *  FblReadBlock
+ **********************************************************************************************************************/
+/*! \brief        This function copies a given amount of bytes.
+ *  \param[in]    address Memory address to read out
+ *  \param[out]   buffer Target buffer
+ *  \param[in]    length Number of bytes to read
+ *  \return       Number of actually copied bytes
+ **********************************************************************************************************************/
+FBL_MEMSIZE_TYPE FblReadBlock( FBL_ADDR_TYPE address, vuint8 * buffer, FBL_MEMSIZE_TYPE length )
+{
+   (void)MEMCPY (buffer, address, length);
+   return length;
+}
+
+#if defined( FBL_USE_OWN_MEMCPY )
+/***********************************************************************************************************************
+ *  ownmemcpy
+ **********************************************************************************************************************/
+/*! \brief       Bytewise copy of size bytes from source to destination
+ *  \param[out]  Dest Pointer to destination buffer
+ *  \param[in]   Source Pointer to source buffer
+ *  \param[in]   size Number of bytes to be copied
+ *  \return      Pointer to destination
+ **********************************************************************************************************************/
+void * ownmemcpy(void * dest, V_MEMRAM1_FAR void V_MEMRAM2_FAR V_MEMRAM3 const * source, tFblLength size)
+{
+   tFblLength i;
+   vuint8 * sd = (vuint8 *)dest;
+   vuint8 const * ss = (vuint8 const *)source;
+
+   (void)FblLookForWatchdog();
+
+   for(i = 0u; i < size; i++)
+   {
+      if ((i & (tFblLength)0x0Fu) == 0x00u)
+      {
+         (void)FblLookForWatchdog();
+      }
+
+      sd[i] = ss[i];
+   }
+
+   return dest;
+}
+#endif /* FBL_USE_OWN_MEMCPY */
+
+/***********************************************************************************************************************
+ *  END OF FILE: FBL_HW_HOST.C
+ **********************************************************************************************************************/
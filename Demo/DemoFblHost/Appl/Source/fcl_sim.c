@@ -0,0 +1,397 @@
+/***********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  ------------------------------------------------------------------------------------------------------------------*/
+/** \file
+ *  \brief         Host build of the demo bootloader: simulation of the Renesas code flash library (FCL)
+ *  \details       Implements the subset of the FCL interface used by BSW/Flash/flashdrv.c on the host memory map
+ *                 (see fbl_host.h). The code flash consists of uniform 32 KB blocks, the user boot area is one
+ *                 additional block. Erase and write operations are started by R_FCL_Execute and completed by
+ *                 R_FCL_Handler after the configured latency of virtual time. Every call of the handler consumes the
+ *                 poll time. Writes are only accepted on erased cells, the data is taken from the user buffer when
+ *                 the operation completes.
+ *                 Additionally the assembler functions of flashdrv.c for the context switch between bootloader and
+ *                 flash driver are provided, as the host build uses a single context.
+ */
+/**********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  INCLUDES
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "v_cfg.h"
+#include "v_def.h"
+#include "flashdrv.h"
+#include "r_typedefs.h"
+#include "fcl_cfg.h"
+#include "r_fcl_types.h"
+#include "r_fcl.h"
+#include "r_fcl_env.h"
+#include "fbl_host.h"
+
+/***********************************************************************************************************************
+ *  DEFINES
+ **********************************************************************************************************************/
+
+/** Number of code flash blocks */
+#define FCL_SIM_BLOCK_COUNT            ((FBL_HOST_CODE_FLASH_END + 1u) / R_FLI_BLOCK_SIZE)
+/** Unit of write operation */
+#define FCL_SIM_WRITE_UNIT             0x100u
+/** Selection of user boot area in erase request */
+#define FCL_SIM_USERBOOT_SELECT        0x80000000ul
+
+/** Duration of environment preparation and lock bit handling [ns] */
+#define FCL_SIM_PREPARE_ENV_NS         50000ull
+#define FCL_SIM_LOCKBITS_NS            5000ull
+
+/***********************************************************************************************************************
+ *  LOCAL DATA
+ **********************************************************************************************************************/
+
+/** Library initialized by R_FCL_Init */
+static vuint8 fclSimInitialized;
+/** Environment prepared by R_FCL_CMD_PREPARE_ENV */
+static vuint8 fclSimEnvPrepared;
+/** Request currently processed */
+static r_fcl_request_t * fclSimRequest;
+/** Start and end of the current operation */
+static tFblHostTime fclSimStartTime;
+static tFblHostTime fclSimDoneTime;
+
+/***********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  FclSimGetEraseArea
+ **********************************************************************************************************************/
+/*! \brief       Resolve blocks of an erase request to an address range
+ *  \param[in]   request Erase request
+ *  \param[out]  start Start address
+ *  \param[out]  length Length of the area
+ *  \return      R_FCL_OK if range is valid
+ **********************************************************************************************************************/
+static r_fcl_status_t FclSimGetEraseArea( const r_fcl_request_t * request, unsigned long * start, unsigned long * length )
+{
+   r_fcl_status_t result;
+
+   result = R_FCL_OK;
+
+   if ((request->idx_u32 & FCL_SIM_USERBOOT_SELECT) != 0u)
+   {
+      if (((request->idx_u32 & ~FCL_SIM_USERBOOT_SELECT) != 0u) || (request->cnt_u16 != 1u))
+      {
+         result = R_FCL_ERR_PARAMETER;
+      }
+      *start  = R_FLI_USERBOOT_AREA_START;
+      *length = R_FLI_BLOCK_SIZE;
+   }
+   else
+   {
+      if ((request->cnt_u16 == 0u) || ((request->idx_u32 + request->cnt_u16) > FCL_SIM_BLOCK_COUNT))
+      {
+         result = R_FCL_ERR_PARAMETER;
+      }
+      *start  = request->idx_u32 * R_FLI_BLOCK_SIZE;
+      *length = (unsigned long)request->cnt_u16 * R_FLI_BLOCK_SIZE;
+
+      /* Blocks of the bootloader are protected */
+      if ((R_FCL_OK == result) && (*start < FBL_HOST_CODE_FLASH_START))
+      {
+         result = R_FCL_ERR_PROTECTION;
+      }
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  FclSimCheckWriteArea
+ **********************************************************************************************************************/
+/*! \brief       Check address range of a write request
+ *  \param[in]   request Write request
+ *  \return      R_FCL_OK if range is valid
+ **********************************************************************************************************************/
+static r_fcl_status_t FclSimCheckWriteArea( const r_fcl_request_t * request )
+{
+   unsigned long start;
+   unsigned long end;
+   r_fcl_status_t result;
+
+   start = request->idx_u32;
+   end = (start + ((unsigned long)request->cnt_u16 * FCL_SIM_WRITE_UNIT)) - 1u;
+   result = R_FCL_ERR_PARAMETER;
+
+   if (((start & (FCL_SIM_WRITE_UNIT - 1u)) == 0u) && (request->cnt_u16 != 0u))
+   {
+      if ((start >= FBL_HOST_CODE_FLASH_START) && (end <= FBL_HOST_CODE_FLASH_END))
+      {
+         result = R_FCL_OK;
+      }
+      else if ((start >= R_FLI_USERBOOT_AREA_START) && (end <= R_FLI_USERBOOT_AREA_END))
+      {
+         result = R_FCL_OK;
+      }
+      else if (start < FBL_HOST_CODE_FLASH_START)
+      {
+         result = R_FCL_ERR_PROTECTION;
+      }
+      else
+      {
+         /* Invalid address */
+      }
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  FclSimComplete
+ **********************************************************************************************************************/
+/*! \brief       Apply the effect of the current erase or write operation to the flash memory
+ **********************************************************************************************************************/
+static void FclSimComplete( void )
+{
+   r_fcl_request_t * request;
+   unsigned long start;
+   unsigned long length;
+   unsigned long i;
+   vuint8 * flash;
+   const vuint8 * data;
+
+   request = fclSimRequest;
+   request->status_enu = R_FCL_OK;
+
+   if (R_FCL_CMD_ERASE == request->command_enu)
+   {
+      (void)FclSimGetEraseArea(request, &start, &length);
+      memset((void *)start, FBL_FLASH_DELETED, length);
+      fblHostStatistics.flashEraseBlocks += request->cnt_u16;
+   }
+   else if (R_FCL_CMD_WRITE == request->command_enu)
+   {
+      flash = (vuint8 *)request->idx_u32;
+      data = (const vuint8 *)request->bufferAdd_u32;
+      length = (unsigned long)request->cnt_u16 * FCL_SIM_WRITE_UNIT;
+
+      /* Cells have to be erased before programming */
+      for (i = 0u; i < length; i++)
+      {
+         if (flash[i] != FBL_FLASH_DELETED)
+         {
+            request->status_enu = R_FCL_ERR_WRITE;
+         }
+      }
+
+      if (R_FCL_OK == request->status_enu)
+      {
+         memcpy(flash, data, length);
+
+         /* Verify programmed data */
+         if (memcmp(flash, data, length) != 0)
+         {
+            request->status_enu = R_FCL_ERR_WRITE;
+         }
+      }
+      fblHostStatistics.flashWriteUnits += request->cnt_u16;
+   }
+   else
+   {
+      /* No effect on memory */
+   }
+
+   if ((R_FCL_CMD_ERASE == request->command_enu) || (R_FCL_CMD_WRITE == request->command_enu))
+   {
+      fblHostStatistics.flashBusyTime += fclSimDoneTime - fclSimStartTime;
+   }
+
+   fclSimRequest = (r_fcl_request_t *)0;
+}
+
+/***********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  R_FCL_Init
+ **********************************************************************************************************************/
+/*! \brief       Initialize the flash library
+ *  \param[in]   descriptor_pstr Library configuration
+ *  \return      R_FCL_OK, R_FCL_ERR_PARAMETER for an invalid CPU frequency
+ **********************************************************************************************************************/
+r_fcl_status_t R_FCL_Init( const r_fcl_descriptor_t * descriptor_pstr )
+{
+   r_fcl_status_t result;
+
+   fclSimRequest = (r_fcl_request_t *)0;
+   fclSimEnvPrepared = 0u;
+   fclSimInitialized = 0u;
+   result = R_FCL_ERR_PARAMETER;
+
+   if (descriptor_pstr->frequencyCpuMHz_u16 != 0u)
+   {
+      fclSimInitialized = 1u;
+      result = R_FCL_OK;
+   }
+
+   return result;
+}
+
+/***********************************************************************************************************************
+ *  R_FCL_Execute
+ **********************************************************************************************************************/
+/*! \brief       Start a flash library operation
+ *  \details     Information requests are completed immediately, all other requests remain busy until they are
+ *               finished by R_FCL_Handler.
+ *  \param[in,out] request_pstr Request structure
+ **********************************************************************************************************************/
+void R_FCL_Execute( r_fcl_request_t * request_pstr )
+{
+   unsigned long start;
+   unsigned long length;
+   tFblHostTime duration;
+   r_fcl_status_t status;
+
+   duration = 0u;
+   status = R_FCL_OK;
+
+   if (fclSimInitialized == 0u)
+   {
+      status = R_FCL_ERR_FLOW;
+   }
+   else if (fclSimRequest != (r_fcl_request_t *)0)
+   {
+      status = R_FCL_ERR_REJECTED;
+   }
+   else
+   {
+      switch (request_pstr->command_enu)
+      {
+         case R_FCL_CMD_PREPARE_ENV:
+         {
+            fclSimEnvPrepared = 1u;
+            duration = FCL_SIM_PREPARE_ENV_NS;
+            break;
+         }
+         case R_FCL_CMD_ENABLE_LOCKBITS:
+         case R_FCL_CMD_DISABLE_LOCKBITS:
+         {
+            duration = FCL_SIM_LOCKBITS_NS;
+            break;
+         }
+         case R_FCL_CMD_GET_BLOCK_CNT:
+         {
+            *(uint32_t *)request_pstr->bufferAdd_u32 = FCL_SIM_BLOCK_COUNT;
+            break;
+         }
+         case R_FCL_CMD_GET_BLOCK_END_ADDR:
+         {
+            if (request_pstr->idx_u32 < FCL_SIM_BLOCK_COUNT)
+            {
+               *(uint32_t *)request_pstr->bufferAdd_u32 = ((request_pstr->idx_u32 + 1u) * R_FLI_BLOCK_SIZE) - 1u;
+            }
+            else
+            {
+               status = R_FCL_ERR_PARAMETER;
+            }
+            break;
+         }
+         case R_FCL_CMD_ERASE:
+         {
+            status = FclSimGetEraseArea(request_pstr, &start, &length);
+            duration = (tFblHostTime)request_pstr->cnt_u16 * fblHostParam.flashEraseTimeUs * 1000u;
+            break;
+         }
+         case R_FCL_CMD_WRITE:
+         {
+            status = FclSimCheckWriteArea(request_pstr);
+            duration = (tFblHostTime)request_pstr->cnt_u16 * fblHostParam.flashWriteTimeUs * 1000u;
+            break;
+         }
+         default:
+         {
+            status = R_FCL_ERR_COMMAND;
+            break;
+         }
+      }
+
+      if ((R_FCL_OK == status) && (fclSimEnvPrepared == 0u))
+      {
+         status = R_FCL_ERR_FLOW;
+      }
+   }
+
+   if ((R_FCL_OK == status) && (duration != 0u))
+   {
+      fclSimRequest = request_pstr;
+      fclSimStartTime = FblHostGetTime();
+      fclSimDoneTime = fclSimStartTime + duration;
+      status = R_FCL_BUSY;
+   }
+
+   request_pstr->status_enu = status;
+}
+
+/***********************************************************************************************************************
+ *  R_FCL_Handler
+ **********************************************************************************************************************/
+/*! \brief       Forward the current operation, sets the final status of the request when it is finished
+ **********************************************************************************************************************/
+void R_FCL_Handler( void )
+{
+   fblHostStatistics.flashPolls++;
+   FblHostAdvanceTime(fblHostParam.pollTimeNs);
+
+   if ((fclSimRequest != (r_fcl_request_t *)0) && (FblHostGetTime() >= fclSimDoneTime))
+   {
+      FclSimComplete();
+   }
+}
+
+/***********************************************************************************************************************
+ *  Replacement of the assembler functions of flashdrv.c
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ *  FblDrvFlashSaveCurFblBasePtr
+ **********************************************************************************************************************/
+/*! \brief       Save base pointers of the bootloader context, nothing to do on the host
+ **********************************************************************************************************************/
+void FblDrvFlashSaveCurFblBasePtr( void )
+{
+}
+
+/***********************************************************************************************************************
+ *  FblDrvFlashSetCurFlashDrvBasePtr
+ **********************************************************************************************************************/
+/*! \brief       Switch to base pointers of the flash driver context, nothing to do on the host
+ **********************************************************************************************************************/
+void FblDrvFlashSetCurFlashDrvBasePtr( void )
+{
+}
+
+/***********************************************************************************************************************
+ *  FblDrvFlashRestoreCurFblBasePtr
+ **********************************************************************************************************************/
+/*! \brief       Switch back to base pointers of the bootloader context, nothing to do on the host
+ **********************************************************************************************************************/
+void FblDrvFlashRestoreCurFblBasePtr( void )
+{
+}
+
+/***********************************************************************************************************************
+ *  FblDrvFlashCallWatchdog
+ **********************************************************************************************************************/
+/*! \brief       Call watchdog function of the bootloader
+ *  \param[in]   wdTriggerFct Watchdog function
+ *  \return      Return value of watchdog function
+ **********************************************************************************************************************/
+tFlashUint8 FblDrvFlashCallWatchdog( tFlashUint8 (* wdTriggerFct)(void) )
+{
+   return wdTriggerFct();
+}
+
+/***********************************************************************************************************************
+ *  END OF FILE: FCL_SIM.C
+ **********************************************************************************************************************/
@@ -52,6 +52,8 @@
 
 #include "expdat.h"
 #include "expdat_datproc.h"
+#include "expdat_delta.h"
+#include "expdat_lzss.h"
 
 
 
@@ -98,6 +100,14 @@ typedef struct tXorParam
   BYTE *xorData;
 } tXorParam;
 
+/*! \brief Delta patch data structure */
+typedef struct tDeltaParam
+{
+  DWORD refAddress;
+  DWORD refLength;
+  BYTE *refData;
+} tDeltaParam;
+
 
 
 /**********************************************************************************************************************
@@ -109,6 +119,8 @@ typedef struct tXorParam
 static const char *dpFunctionName[] = {
     "No action"
    ,"XOR data with byte parameter"
+   ,"Delta patch against reference image (param: address,file)"
+   ,"LZSS compression"
 };
 
 
@@ -123,6 +135,9 @@ static const char *dpFunctionName[] = {
  **********************************************************************************************************************/
 
 static int StringToBytes(const char *textBuffer, unsigned char *data, const int maxDataLen);
+static bool InitDeltaOperation(TExportDataInfo *info, tDeltaParam *deltaParam);
+static bool DoDeltaOperation(TExportDataInfo *info, tDeltaParam *deltaParam);
+static bool DoLzssOperation(TExportDataInfo *info);
 
 
 /**********************************************************************************************************************
@@ -219,6 +234,203 @@ static int StringToBytes(const char *textBuffer, unsigned char *data, const int
 }
 
 
+/**********************************************************************************************************************
+ * InitDeltaOperation()
+ **********************************************************************************************************************/
+/*! \brief        Loads the reference image for the delta patch generation.
+ *  \details      The parameter contains the address of the reference image in the ECU memory and the name of a
+ *                binary file with the reference image contents, e.g. "0x20000,C:\\Images\\BankB.bin".
+ *                The bootloader reads the reference data from this address, thus it must not be located in the
+ *                memory area the new image is downloaded to.
+ *  \param[in]    info: Pointer to the complete dataprocessing workspace.
+ *  \param[out]   deltaParam: Pointer to the delta workspace.
+ *  \return       TRUE:  Initialisation successfully completed.
+ *                FALSE: Initialisation failed. Detailed error code in info->exState.
+ **********************************************************************************************************************/
+static bool InitDeltaOperation(TExportDataInfo *info, tDeltaParam *deltaParam)
+{
+   char     fileName[_MAX_PATH];
+   char    *pEnd;
+   FILE    *fp;
+   long     fileSize;
+
+
+   deltaParam->refData = NULL;
+   deltaParam->refLength = 0;
+
+   if ((info->generalParam==NULL) || (strlen(info->generalParam) == 0))
+   {
+      info->exState = ExportStateParamterMissingForDataProcessing;
+      return false;
+   }
+
+   deltaParam->refAddress = strtoul(info->generalParam, &pEnd, 0);
+
+   // Skip separator and blanks in front of the file name.
+   while ((*pEnd == ',') || (*pEnd == ' ') || (*pEnd == ';'))
+   {
+      pEnd++;
+   }
+   if ((pEnd == info->generalParam) || (*pEnd == '\0'))
+   {
+      info->exState = ExportStateParamterMissingForDataProcessing;
+      return false;
+   }
+   strncpy(fileName, pEnd, sizeof(fileName)-1 );
+   fileName[sizeof(fileName)-1] = '\0';
+
+   fp = fopen(fileName, "rb");
+   if (fp == NULL)
+   {
+      info->exState = ExportStateParamterMissingForDataProcessing;
+      return false;
+   }
+
+   fseek(fp, 0, SEEK_END);
+   fileSize = ftell(fp);
+   fseek(fp, 0, SEEK_SET);
+
+   if (fileSize > 0)
+   {
+      deltaParam->refData = (BYTE *)ExpDat_AllocWorkspace(fileSize);
+      if (deltaParam->refData != NULL)
+      {
+         deltaParam->refLength = (DWORD)fread(deltaParam->refData, 1, fileSize, fp);
+      }
+   }
+   fclose(fp);
+
+   if (deltaParam->refLength == 0)
+   {
+      info->exState = ExportStateParamterMissingForDataProcessing;
+      return false;
+   }
+
+   return true;
+}
+
+/**********************************************************************************************************************
+ * DoDeltaOperation()
+ **********************************************************************************************************************/
+/*! \brief        Replaces the segment data by the delta patch stream.
+ *  \details      The generated patch stream is decoded again and compared with the input data before it is
+ *                passed to the output. The segment has to be provided in one piece (no streaming).
+ *  \param[in]    info: Pointer to the complete dataprocessing workspace.
+ *  \param[in]    deltaParam: Pointer to the delta workspace.
+ *  \return       TRUE:  Patch stream available in info->segOutData.
+ *                FALSE: Operation failed. Detailed error code in info->exState.
+ **********************************************************************************************************************/
+static bool DoDeltaOperation(TExportDataInfo *info, tDeltaParam *deltaParam)
+{
+   BYTE    *patchData;
+   BYTE    *checkData;
+   DWORD    patchLength;
+   bool     rval=false;
+
+
+   if ( (info->HostAllocMemory == NULL)
+     || ((info->doDataOperation != 0) && (info->doDataOperation != DODATA_START_UPDATE_FINISH)) )
+   {
+      info->exState = ExportStateDynamicLengthOperationNotPossible;
+      return false;
+   }
+
+   patchData = (BYTE *)info->HostAllocMemory(ExpDat_DeltaMaxPatchSize(info->segInLength));
+   checkData = (BYTE *)ExpDat_AllocWorkspace(info->segInLength + 1);
+   if ((patchData == NULL) || (checkData == NULL))
+   {
+      if (patchData != NULL)
+      {
+         info->HostFreeMemory(patchData);
+      }
+      ExpDat_FreeWorkspace((void **)&checkData);
+      return false;
+   }
+
+   patchLength = ExpDat_DeltaEncode(deltaParam->refData, deltaParam->refLength, deltaParam->refAddress,
+                                    (const BYTE *)info->segInData, info->segInLength, patchData);
+
+   // Round-trip check of the patch stream.
+   if ( (patchLength > 0)
+     && (ExpDat_DeltaDecode(deltaParam->refData, deltaParam->refLength, deltaParam->refAddress,
+                            patchData, patchLength, checkData, info->segInLength) == info->segInLength)
+     && (memcmp(checkData, info->segInData, info->segInLength) == 0) )
+   {
+      info->segOutAddress = info->segInAddress;
+      info->segOutData = (char *)patchData;
+      info->segOutLength = patchLength;
+      rval = true;
+   }
+   else
+   {
+      info->HostFreeMemory(patchData);
+   }
+   ExpDat_FreeWorkspace((void **)&checkData);
+
+   return rval;
+}
+
+/**********************************************************************************************************************
+ * DoLzssOperation()
+ **********************************************************************************************************************/
+/*! \brief        Replaces the segment data by the LZSS compressed data.
+ *  \details      The compressed data is decompressed again and compared with the input data before it is
+ *                passed to the output. The segment has to be provided in one piece (no streaming).
+ *  \param[in]    info: Pointer to the complete dataprocessing workspace.
+ *  \return       TRUE:  Compressed data available in info->segOutData.
+ *                FALSE: Operation failed. Detailed error code in info->exState.
+ **********************************************************************************************************************/
+static bool DoLzssOperation(TExportDataInfo *info)
+{
+   BYTE    *outData;
+   BYTE    *checkData;
+   DWORD    outLength;
+   bool     rval=false;
+
+
+   if ( (info->HostAllocMemory == NULL)
+     || ((info->doDataOperation != 0) && (info->doDataOperation != DODATA_START_UPDATE_FINISH)) )
+   {
+      info->exState = ExportStateDynamicLengthOperationNotPossible;
+      return false;
+   }
+
+   info->exState = ExportStateDataCompressionCalculationError;
+
+   outData = (BYTE *)info->HostAllocMemory(ExpDat_LzssMaxCompressedSize(info->segInLength));
+   checkData = (BYTE *)ExpDat_AllocWorkspace(info->segInLength + 1);
+   if ((outData == NULL) || (checkData == NULL))
+   {
+      if (outData != NULL)
+      {
+         info->HostFreeMemory(outData);
+      }
+      ExpDat_FreeWorkspace((void **)&checkData);
+      return false;
+   }
+
+   outLength = ExpDat_LzssEncode((const BYTE *)info->segInData, info->segInLength, outData);
+
+   // Round-trip check of the compressed data.
+   if ( (outLength > 0)
+     && (ExpDat_LzssDecode(outData, outLength, checkData, info->segInLength) == info->segInLength)
+     && (memcmp(checkData, info->segInData, info->segInLength) == 0) )
+   {
+      info->segOutAddress = info->segInAddress;
+      info->segOutData = (char *)outData;
+      info->segOutLength = outLength;
+      rval = true;
+   }
+   else
+   {
+      info->HostFreeMemory(outData);
+   }
+   ExpDat_FreeWorkspace((void **)&checkData);
+
+   return rval;
+}
+
+
 /**********************************************************************************************************************
  **********************************************************************************************************************
  *  GLOBAL FUNCTIONS
@@ -306,6 +518,16 @@ DLL_FUNC(bool) InitDataProcessing( TExportDataInfo *info )
 
             break;
 
+      case kDatProcDeltaPatch:
+            info->voidPtr = ExpDat_AllocWorkspace(sizeof(tDeltaParam));
+            rval = InitDeltaOperation(info, (tDeltaParam *)info->voidPtr);
+
+            break;
+
+      case kDatProcLzssCompress:
+            rval = true;
+            break;
+
    } 
 
    return rval;
@@ -364,6 +586,14 @@ DLL_FUNC(bool) DoDataProcessing( TExportDataInfo *info )
          rval = true;
        break;
 
+      case kDatProcDeltaPatch:
+         rval = DoDeltaOperation(info, (tDeltaParam *)info->voidPtr);
+       break;
+
+      case kDatProcLzssCompress:
+         rval = DoLzssOperation(info);
+       break;
+
    } 
 
    return rval;
@@ -411,6 +641,20 @@ DLL_FUNC(bool) DeinitDataProcessing(TExportDataInfo *info )
             rval = true;
             break;
 
+      // Release reference image
+      case kDatProcDeltaPatch:
+            if (NULL!=info->voidPtr) {
+               ExpDat_FreeWorkspace((void **)&(((tDeltaParam *)(info->voidPtr))->refData));
+               ExpDat_FreeWorkspace((void **)&(info->voidPtr)); 
+            }  
+            rval = true;
+            break;
+
+      // No workspace
+      case kDatProcLzssCompress:
+            rval = true;
+            break;
+
    } 
 
    return rval;
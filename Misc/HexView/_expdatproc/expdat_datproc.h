@@ -52,6 +52,8 @@ typedef enum
 {
     kDatProcNoAction                     //0
    ,kDatProcXoring                       //1
+   ,kDatProcDeltaPatch                   //2
+   ,kDatProcLzssCompress                 //3
 
    ,kDatProcItems                        //52   /* Total number of items in Csum */
 } EDatProcMethodNames;
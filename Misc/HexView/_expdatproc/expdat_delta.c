@@ -0,0 +1,349 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  expdat_delta.c
+ *        \brief  Generation of delta patch streams.
+ *
+ *      \details  The new image is described as a sequence of copy records (data taken from the reference image
+ *                already programmed in the ECU) and insert records (literal data). Matches are searched with a
+ *                hash index over the reference image.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  REVISION HISTORY
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  Version   Date        Description
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  01.00.00  2026-10-17  Creation
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "expdat.h"
+#include "expdat_delta.h"
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ **********************************************************************************************************************/
+
+#ifndef min
+#define min(a, b)             ((a) < (b) ? (a) : (b)) 
+#endif
+
+#define DELTA_HASH_BITS          16
+#define DELTA_HASH_SIZE          (1ul << DELTA_HASH_BITS)
+#define DELTA_HASH_BYTES         4u       // Number of bytes used to calculate the hash value.
+#define DELTA_MIN_MATCH          12u      // A copy record is only worth it if it saves more than its header.
+#define DELTA_MAX_PROBES         32       // Max. number of candidates checked per position.
+#define DELTA_NO_ENTRY           0xFFFFFFFFul
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION MACROS
+ **********************************************************************************************************************/
+
+#define DeltaHash(p)    ((((DWORD)(p)[0] << 24) | ((DWORD)(p)[1] << 16) | ((DWORD)(p)[2] << 8) | (DWORD)(p)[3]) \
+                           * 2654435761ul >> (32 - DELTA_HASH_BITS)) & (DELTA_HASH_SIZE - 1ul)
+
+/**********************************************************************************************************************
+ *  LOCAL DATA TYPES AND STRUCTURES
+ **********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+
+static DWORD PutRecordHeader(BYTE *patchData, BYTE opcode, DWORD length, DWORD address);
+static DWORD FlushInsert(BYTE *patchData, const BYTE *literal, DWORD length);
+static DWORD MatchLength(const BYTE *a, const BYTE *b, DWORD maxLength);
+
+
+/**********************************************************************************************************************
+ **********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ **********************************************************************************************************************
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * PutRecordHeader()
+ **********************************************************************************************************************/
+/*! \brief        Writes the header of a patch record.
+ *  \param[out]   patchData: Output position in the patch stream.
+ *  \param[in]    opcode: EXPDAT_DELTA_OPCODE_COPY or EXPDAT_DELTA_OPCODE_INSERT.
+ *  \param[in]    length: Output length of the record (1..EXPDAT_DELTA_MAX_RECORD_LENGTH).
+ *  \param[in]    address: Source address of reference data (copy record only).
+ *  \return       Number of bytes written.
+ **********************************************************************************************************************/
+static DWORD PutRecordHeader(BYTE *patchData, BYTE opcode, DWORD length, DWORD address)
+{
+   patchData[0] = opcode;
+   patchData[1] = (BYTE)(length >> 8);
+   patchData[2] = (BYTE)(length);
+
+   if (opcode != EXPDAT_DELTA_OPCODE_COPY)
+   {
+      return EXPDAT_DELTA_HEADER_SIZE_INSERT;
+   }
+
+   patchData[3] = (BYTE)(address >> 24);
+   patchData[4] = (BYTE)(address >> 16);
+   patchData[5] = (BYTE)(address >> 8);
+   patchData[6] = (BYTE)(address);
+
+   return EXPDAT_DELTA_HEADER_SIZE_COPY;
+}
+
+/**********************************************************************************************************************
+ * FlushInsert()
+ **********************************************************************************************************************/
+/*! \brief        Writes pending literal data as one or more insert records.
+ *  \param[out]   patchData: Output position in the patch stream.
+ *  \param[in]    literal: Pointer to the literal data.
+ *  \param[in]    length: Number of literal bytes (may be 0).
+ *  \return       Number of bytes written.
+ **********************************************************************************************************************/
+static DWORD FlushInsert(BYTE *patchData, const BYTE *literal, DWORD length)
+{
+   DWORD rc=0;
+   DWORD chunk;
+
+   while (length > 0)
+   {
+      chunk = min(length, EXPDAT_DELTA_MAX_RECORD_LENGTH);
+      rc += PutRecordHeader(&patchData[rc], EXPDAT_DELTA_OPCODE_INSERT, chunk, 0);
+      memcpy(&patchData[rc], literal, chunk);
+      rc += chunk;
+      literal += chunk;
+      length -= chunk;
+   }
+   return rc;
+}
+
+/**********************************************************************************************************************
+ * MatchLength()
+ **********************************************************************************************************************/
+/*! \brief        Provides the number of identical bytes at the beginning of two buffers.
+ **********************************************************************************************************************/
+static DWORD MatchLength(const BYTE *a, const BYTE *b, DWORD maxLength)
+{
+   DWORD rc=0;
+
+   while ((rc < maxLength) && (a[rc] == b[rc]))
+   {
+      rc++;
+   }
+   return rc;
+}
+
+
+/**********************************************************************************************************************
+ **********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * ExpDat_DeltaEncode()
+ **********************************************************************************************************************/
+/*! \brief        Generates the patch stream which transforms the reference image into the new image.
+ *  \details      Greedy matching: The continuation of the previous copy record is checked first (unchanged code
+ *                after a modified area), then the hash index over the reference image is searched for the longest
+ *                match. Bytes without a suitable match are collected into insert records.
+ *  \param[in]    refData/refLength: Reference image as programmed in the ECU.
+ *  \param[in]    refAddress: Address of the reference image in the ECU memory.
+ *  \param[in]    newData/newLength: New image.
+ *  \param[out]   patchData: Patch stream, at least ExpDat_DeltaMaxPatchSize(newLength) bytes.
+ *  \return       Length of the patch stream, 0 if the workspace could not be allocated.
+ **********************************************************************************************************************/
+DWORD ExpDat_DeltaEncode(const BYTE *refData, DWORD refLength, DWORD refAddress,
+                         const BYTE *newData, DWORD newLength, BYTE *patchData)
+{
+   DWORD *hashHead;
+   DWORD *hashChain;
+   DWORD  i;
+   DWORD  pos=0;
+   DWORD  literalStart=0;
+   DWORD  patchLength=0;
+   DWORD  nextCopy=DELTA_NO_ENTRY;   // Reference position following the previous copy record.
+   DWORD  bestLength;
+   DWORD  bestPos;
+   DWORD  candidate;
+   DWORD  len;
+   int    probes;
+
+
+   hashHead  = (DWORD *)ExpDat_AllocWorkspace(sizeof(DWORD) * DELTA_HASH_SIZE);
+   hashChain = (DWORD *)ExpDat_AllocWorkspace(sizeof(DWORD) * (refLength + 1u));
+   if ((hashHead == NULL) || (hashChain == NULL))
+   {
+      ExpDat_FreeWorkspace((void **)&hashHead);
+      ExpDat_FreeWorkspace((void **)&hashChain);
+      return 0;
+   }
+
+   // Build hash index, the chain points to the previous occurrence of the same hash value.
+   for (i=0 ; i < DELTA_HASH_SIZE ; i++)
+   {
+      hashHead[i] = DELTA_NO_ENTRY;
+   }
+   for (i=0 ; (i + DELTA_HASH_BYTES) <= refLength ; i++)
+   {
+      DWORD h = DeltaHash(&refData[i]);
+      hashChain[i] = hashHead[h];
+      hashHead[h] = i;
+   }
+
+   while (pos < newLength)
+   {
+      bestLength = 0;
+      bestPos = 0;
+
+      // Continuation of previous copy record.
+      if (nextCopy < refLength)
+      {
+         bestLength = MatchLength(&refData[nextCopy], &newData[pos], min(refLength - nextCopy, newLength - pos));
+         bestPos = nextCopy;
+      }
+
+      if ((bestLength < DELTA_MIN_MATCH) && ((pos + DELTA_HASH_BYTES) <= newLength))
+      {
+         candidate = hashHead[DeltaHash(&newData[pos])];
+         for (probes=0 ; (candidate != DELTA_NO_ENTRY) && (probes < DELTA_MAX_PROBES) ; probes++)
+         {
+            len = MatchLength(&refData[candidate], &newData[pos], min(refLength - candidate, newLength - pos));
+            if (len > bestLength)
+            {
+               bestLength = len;
+               bestPos = candidate;
+            }
+            candidate = hashChain[candidate];
+         }
+      }
+
+      if (bestLength >= DELTA_MIN_MATCH)
+      {
+         patchLength += FlushInsert(&patchData[patchLength], &newData[literalStart], pos - literalStart);
+
+         // Split long matches into several copy records.
+         while (bestLength > 0)
+         {
+            len = min(bestLength, EXPDAT_DELTA_MAX_RECORD_LENGTH);
+            patchLength += PutRecordHeader(&patchData[patchLength], EXPDAT_DELTA_OPCODE_COPY, len, refAddress + bestPos);
+            pos += len;
+            bestPos += len;
+            bestLength -= len;
+         }
+         nextCopy = bestPos;
+         literalStart = pos;
+      }
+      else
+      {
+         // Keep reference position aligned with the new image (replaced bytes of same size).
+         if (nextCopy != DELTA_NO_ENTRY)
+         {
+            nextCopy++;
+         }
+         pos++;
+      }
+   }
+   patchLength += FlushInsert(&patchData[patchLength], &newData[literalStart], pos - literalStart);
+
+   ExpDat_FreeWorkspace((void **)&hashHead);
+   ExpDat_FreeWorkspace((void **)&hashChain);
+
+   return patchLength;
+}
+
+/**********************************************************************************************************************
+ * ExpDat_DeltaDecode()
+ **********************************************************************************************************************/
+/*! \brief        Reconstructs the new image from the reference image and the patch stream.
+ *  \details      Same operation as executed in the bootloader. Used to check the generated patch stream.
+ *  \param[in]    refData/refLength: Reference image as programmed in the ECU.
+ *  \param[in]    refAddress: Address of the reference image in the ECU memory.
+ *  \param[in]    patchData/patchLength: Patch stream.
+ *  \param[out]   newData: Reconstructed image.
+ *  \param[in]    maxNewLength: Size of the newData buffer.
+ *  \return       Length of the reconstructed image, EXPDAT_DELTA_INVALID if the patch stream is invalid.
+ **********************************************************************************************************************/
+DWORD ExpDat_DeltaDecode(const BYTE *refData, DWORD refLength, DWORD refAddress,
+                         const BYTE *patchData, DWORD patchLength, BYTE *newData, DWORD maxNewLength)
+{
+   DWORD pos=0;
+   DWORD newLength=0;
+   DWORD len;
+   DWORD source;
+
+   while (pos < patchLength)
+   {
+      if ((patchLength - pos) < EXPDAT_DELTA_HEADER_SIZE_INSERT)
+      {
+         return EXPDAT_DELTA_INVALID;
+      }
+      len = ((DWORD)patchData[pos + 1] << 8) | (DWORD)patchData[pos + 2];
+      if ((len == 0) || (len > (maxNewLength - newLength)))
+      {
+         return EXPDAT_DELTA_INVALID;
+      }
+
+      if (patchData[pos] == EXPDAT_DELTA_OPCODE_INSERT)
+      {
+         pos += EXPDAT_DELTA_HEADER_SIZE_INSERT;
+         if ((patchLength - pos) < len)
+         {
+            return EXPDAT_DELTA_INVALID;
+         }
+         memcpy(&newData[newLength], &patchData[pos], len);
+         pos += len;
+      }
+      else if (patchData[pos] == EXPDAT_DELTA_OPCODE_COPY)
+      {
+         if ((patchLength - pos) < EXPDAT_DELTA_HEADER_SIZE_COPY)
+         {
+            return EXPDAT_DELTA_INVALID;
+         }
+         source = ((DWORD)patchData[pos + 3] << 24) | ((DWORD)patchData[pos + 4] << 16)
+                | ((DWORD)patchData[pos + 5] << 8)  |  (DWORD)patchData[pos + 6];
+         source -= refAddress;
+         if ((source >= refLength) || ((refLength - source) < len))
+         {
+            return EXPDAT_DELTA_INVALID;
+         }
+         memcpy(&newData[newLength], &refData[source], len);
+         pos += EXPDAT_DELTA_HEADER_SIZE_COPY;
+      }
+      else
+      {
+         return EXPDAT_DELTA_INVALID;
+      }
+      newLength += len;
+   }
+
+   return newLength;
+}
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+/**********************************************************************************************************************
+ *  END OF FILE: expdat_delta.c
+ *********************************************************************************************************************/
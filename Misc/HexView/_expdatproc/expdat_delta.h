@@ -0,0 +1,98 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  expdat_delta.h
+ *        \brief  Generation of delta patch streams.
+ *
+ *      \details  This file contains the interface of the delta patch generator. The patch stream is reconstructed
+ *                by the bootloader (FblLib_Mem, FBL_MEM_ENABLE_DELTA_DOWNLOAD) from the reference data which is
+ *                currently programmed in the ECU.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  REVISION HISTORY
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  Version   Date        Description
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  01.00.00  2026-10-17  Creation
+ *********************************************************************************************************************/
+
+#if !defined (__EXPDAT_DELTA_H__)
+#define __EXPDAT_DELTA_H__
+
+
+/**********************************************************************************************************************
+ * INCLUDES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+   *  GLOBAL CONSTANT MACROS
+   *********************************************************************************************************************/
+
+/* Patch stream format, has to match the decoder in the bootloader (fbl_mem.c).
+ * Each record starts with a header:
+ *    Byte 0:     Opcode
+ *    Byte 1..2:  Length of output data produced by record (big endian, non-zero)
+ *    Byte 3..6:  Source address of reference data (big endian, copy record only)
+ * Insert records are followed by the literal output data.
+ */
+#define EXPDAT_DELTA_OPCODE_COPY             0x01u    // Output data read from reference data in ECU memory.
+#define EXPDAT_DELTA_OPCODE_INSERT           0x02u    // Output data contained in patch stream.
+
+#define EXPDAT_DELTA_HEADER_SIZE_INSERT      3u
+#define EXPDAT_DELTA_HEADER_SIZE_COPY        7u
+
+#define EXPDAT_DELTA_MAX_RECORD_LENGTH       0xFFFFu  // Max. output length of a single record.
+
+#define EXPDAT_DELTA_INVALID                 0xFFFFFFFFul   // Returned by ExpDat_DeltaDecode on a corrupt patch stream.
+
+/* Data format identifier to be used in RequestDownload for patch streams (FBL_MEM_DELTA_DATA_FORMAT) */
+#define EXPDAT_DELTA_DATA_FORMAT             0xD0u
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ *********************************************************************************************************************/
+
+/* Worst case size of patch stream: everything is sent as literal data */
+#define ExpDat_DeltaMaxPatchSize(newLength)  ((newLength) + \
+         (((newLength) / EXPDAT_DELTA_MAX_RECORD_LENGTH) + 1u) * EXPDAT_DELTA_HEADER_SIZE_INSERT)
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+DWORD ExpDat_DeltaEncode(const BYTE *refData, DWORD refLength, DWORD refAddress,
+                         const BYTE *newData, DWORD newLength, BYTE *patchData);
+DWORD ExpDat_DeltaDecode(const BYTE *refData, DWORD refLength, DWORD refAddress,
+                         const BYTE *patchData, DWORD patchLength, BYTE *newData, DWORD maxNewLength);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __EXPDAT_DELTA_H__ */
+
+/**********************************************************************************************************************
+ *  END OF FILE: expdat_delta.h
+ *********************************************************************************************************************/
@@ -0,0 +1,242 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  expdat_lzss.c
+ *        \brief  LZSS compression of download data.
+ *
+ *      \details  Repeated byte sequences within the last EXPDAT_LZSS_WINDOW_SIZE bytes are replaced by a reference
+ *                (distance/length). Matches are searched with hash chains over the window.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  REVISION HISTORY
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  Version   Date        Description
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  01.00.00  2026-10-17  Creation
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "expdat.h"
+#include "expdat_lzss.h"
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************************************************************************************************************
+ *  LOCAL CONSTANT MACROS
+ **********************************************************************************************************************/
+
+#ifndef min
+#define min(a, b)             ((a) < (b) ? (a) : (b)) 
+#endif
+
+#define LZSS_HASH_BITS           13
+#define LZSS_HASH_SIZE           (1ul << LZSS_HASH_BITS)
+#define LZSS_MAX_PROBES          64       // Max. number of candidates checked per position.
+#define LZSS_NO_ENTRY            0xFFFFFFFFul
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTION MACROS
+ **********************************************************************************************************************/
+
+#define LzssHash(p)     (((((DWORD)(p)[0] << 16) | ((DWORD)(p)[1] << 8) | (DWORD)(p)[2]) * 2654435761ul \
+                           >> (32 - LZSS_HASH_BITS)) & (LZSS_HASH_SIZE - 1ul))
+
+
+/**********************************************************************************************************************
+ **********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ **********************************************************************************************************************
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * ExpDat_LzssEncode()
+ **********************************************************************************************************************/
+/*! \brief        Compresses a data block.
+ *  \details      Greedy matching, the longest match found in the hash chain is taken.
+ *  \param[in]    inData/inLength: Uncompressed data.
+ *  \param[out]   outData: Compressed data, at least ExpDat_LzssMaxCompressedSize(inLength) bytes.
+ *  \return       Length of the compressed data, 0 if the workspace could not be allocated.
+ **********************************************************************************************************************/
+DWORD ExpDat_LzssEncode(const BYTE *inData, DWORD inLength, BYTE *outData)
+{
+   DWORD *hashHead;
+   DWORD *hashChain;
+   DWORD  i;
+   DWORD  pos=0;
+   DWORD  outLength=0;
+   DWORD  flagPos=0;
+   DWORD  flagCount=8;      // Forces a new flag byte on the first item.
+   DWORD  bestLength;
+   DWORD  bestDistance;
+   DWORD  candidate;
+   DWORD  len;
+   DWORD  token;
+   int    probes;
+
+
+   hashHead  = (DWORD *)ExpDat_AllocWorkspace(sizeof(DWORD) * LZSS_HASH_SIZE);
+   hashChain = (DWORD *)ExpDat_AllocWorkspace(sizeof(DWORD) * (inLength + 1u));
+   if ((hashHead == NULL) || (hashChain == NULL))
+   {
+      ExpDat_FreeWorkspace((void **)&hashHead);
+      ExpDat_FreeWorkspace((void **)&hashChain);
+      return 0;
+   }
+
+   for (i=0 ; i < LZSS_HASH_SIZE ; i++)
+   {
+      hashHead[i] = LZSS_NO_ENTRY;
+   }
+
+   while (pos < inLength)
+   {
+      bestLength = 0;
+      bestDistance = 0;
+
+      if ((pos + EXPDAT_LZSS_MIN_MATCH) <= inLength)
+      {
+         candidate = hashHead[LzssHash(&inData[pos])];
+         for (probes=0 ; (candidate != LZSS_NO_ENTRY) && ((pos - candidate) <= EXPDAT_LZSS_WINDOW_SIZE)
+                         && (probes < LZSS_MAX_PROBES) ; probes++)
+         {
+            len = 0;
+            while ((len < min(EXPDAT_LZSS_MAX_MATCH, inLength - pos)) && (inData[candidate + len] == inData[pos + len]))
+            {
+               len++;
+            }
+            if (len > bestLength)
+            {
+               bestLength = len;
+               bestDistance = pos - candidate;
+            }
+            candidate = hashChain[candidate];
+         }
+      }
+
+      // Start a new group.
+      if (flagCount == 8)
+      {
+         flagPos = outLength++;
+         outData[flagPos] = 0;
+         flagCount = 0;
+      }
+
+      if (bestLength >= EXPDAT_LZSS_MIN_MATCH)
+      {
+         token = ((bestDistance - 1) << 6) | (bestLength - EXPDAT_LZSS_MIN_MATCH);
+         outData[outLength++] = (BYTE)(token >> 8);
+         outData[outLength++] = (BYTE)(token);
+      }
+      else
+      {
+         bestLength = 1;
+         outData[flagPos] |= (BYTE)(1u << flagCount);
+         outData[outLength++] = inData[pos];
+      }
+      flagCount++;
+
+      // Add all covered positions to the hash index.
+      for (i=0 ; i < bestLength ; i++, pos++)
+      {
+         if ((pos + EXPDAT_LZSS_MIN_MATCH) <= inLength)
+         {
+            DWORD h = LzssHash(&inData[pos]);
+            hashChain[pos] = hashHead[h];
+            hashHead[h] = pos;
+         }
+      }
+   }
+
+   ExpDat_FreeWorkspace((void **)&hashHead);
+   ExpDat_FreeWorkspace((void **)&hashChain);
+
+   return outLength;
+}
+
+/**********************************************************************************************************************
+ * ExpDat_LzssDecode()
+ **********************************************************************************************************************/
+/*! \brief        Decompresses a data block.
+ *  \details      Same operation as executed in the bootloader. Used to check the compressed data.
+ *  \param[in]    inData/inLength: Compressed data.
+ *  \param[out]   outData: Decompressed data.
+ *  \param[in]    maxOutLength: Size of the outData buffer.
+ *  \return       Length of the decompressed data, EXPDAT_LZSS_INVALID if the stream is invalid.
+ **********************************************************************************************************************/
+DWORD ExpDat_LzssDecode(const BYTE *inData, DWORD inLength, BYTE *outData, DWORD maxOutLength)
+{
+   DWORD pos=0;
+   DWORD outLength=0;
+   DWORD flagCount=0;
+   DWORD distance;
+   DWORD len;
+   BYTE  flags=0;
+
+   while (pos < inLength)
+   {
+      if (flagCount == 0)
+      {
+         flags = inData[pos++];
+         flagCount = 8;
+         continue;
+      }
+
+      if ((flags & 0x01u) != 0)
+      {
+         if (outLength >= maxOutLength)
+         {
+            return EXPDAT_LZSS_INVALID;
+         }
+         outData[outLength++] = inData[pos++];
+      }
+      else
+      {
+         if ((inLength - pos) < 2)
+         {
+            return EXPDAT_LZSS_INVALID;
+         }
+         distance = ((((DWORD)inData[pos] << 8) | (DWORD)inData[pos + 1]) >> 6) + 1;
+         len = ((DWORD)inData[pos + 1] & 0x3Fu) + EXPDAT_LZSS_MIN_MATCH;
+         pos += 2;
+         if ((distance > outLength) || (len > (maxOutLength - outLength)))
+         {
+            return EXPDAT_LZSS_INVALID;
+         }
+         while (len-- > 0)
+         {
+            outData[outLength] = outData[outLength - distance];
+            outLength++;
+         }
+      }
+      flags >>= 1;
+      flagCount--;
+   }
+
+   return outLength;
+}
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+/**********************************************************************************************************************
+ *  END OF FILE: expdat_lzss.c
+ *********************************************************************************************************************/
@@ -0,0 +1,88 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -----------------------------------------------------------------------------------------------------------------*/
+/**        \file  expdat_lzss.h
+ *        \brief  LZSS compression of download data.
+ *
+ *      \details  This file contains the interface of the LZSS compressor. The data is decompressed by the
+ *                bootloader in ApplFblDataProcessing (compression routine "1").
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  REVISION HISTORY
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  Version   Date        Description
+ *  -------------------------------------------------------------------------------------------------------------------
+ *  01.00.00  2026-10-17  Creation
+ *********************************************************************************************************************/
+
+#if !defined (__EXPDAT_LZSS_H__)
+#define __EXPDAT_LZSS_H__
+
+
+/**********************************************************************************************************************
+ * INCLUDES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+   *  GLOBAL CONSTANT MACROS
+   *********************************************************************************************************************/
+
+/* Stream format, has to match the decompressor in the bootloader (fbl_ap.c).
+ * Groups of a flag byte followed by up to eight items. Flag bits are evaluated starting with the LSB:
+ *    1: Literal, one byte.
+ *    0: Match, two bytes (big endian): upper 10 bits distance - 1, lower 6 bits length - 3.
+ */
+#define EXPDAT_LZSS_WINDOW_SIZE              1024u
+#define EXPDAT_LZSS_MIN_MATCH                3u
+#define EXPDAT_LZSS_MAX_MATCH                (EXPDAT_LZSS_MIN_MATCH + 0x3Fu)
+
+#define EXPDAT_LZSS_INVALID                  0xFFFFFFFFul   // Returned by ExpDat_LzssDecode on a corrupt stream.
+
+/* Data format identifier to be used in RequestDownload for compressed data */
+#define EXPDAT_LZSS_DATA_FORMAT              0x10u
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION MACROS
+ *********************************************************************************************************************/
+
+/* Worst case size of compressed data: one flag byte per eight literals */
+#define ExpDat_LzssMaxCompressedSize(length)  ((length) + ((length) + 7u) / 8u)
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA PROTOTYPES
+ *********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+DWORD ExpDat_LzssEncode(const BYTE *inData, DWORD inLength, BYTE *outData);
+DWORD ExpDat_LzssDecode(const BYTE *inData, DWORD inLength, BYTE *outData, DWORD maxOutLength);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* __EXPDAT_LZSS_H__ */
+
+/**********************************************************************************************************************
+ *  END OF FILE: expdat_lzss.h
+ *********************************************************************************************************************/